@@ -9,6 +9,8 @@ LOCAL_ARM_MODE := arm
 
 LOCAL_SRC_FILES += $(SRC_DIR)/RenderAPI.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/RenderingPlugin.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/BlockCompression.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/BlockCompression_AVX2.cpp
 
 # OpenGL ES
 LOCAL_SRC_FILES += $(SRC_DIR)/RenderAPI_OpenGLCoreES.cpp
@@ -0,0 +1,688 @@
+#include "BlockCompression.h"
+#include "BlockCompressionKernels.h"
+#include "DirectGraphics.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// SSE2 is part of every x64 target, so the palette searches need no extra compiler flags. Other targets use the
+// scalar loops, which compilers vectorize for NEON.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define BC_ENCODER_SSE2 1
+	#include <emmintrin.h>
+#else
+	#define BC_ENCODER_SSE2 0
+#endif
+
+// x86 CPUs are asked through cpuid whether the AVX2 kernels may run
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	#define BC_ENCODER_CPUID 1
+	#include <intrin.h>
+	#include <immintrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+	#define BC_ENCODER_CPUID 1
+	#include <cpuid.h>
+#else
+	#define BC_ENCODER_CPUID 0
+#endif
+
+
+// --------------------------------------------------------------------------
+// Block encoding
+// The kernels below are the SSE2 and scalar versions, BlockCompression_AVX2.cpp has the AVX2 ones.
+
+static const float kBC7Weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+static inline float RoundFloat(float value)
+{
+	return floorf(value + 0.5f);
+}
+
+static inline float ClampFloat(float value, float low, float high)
+{
+	return value < low ? low : (value > high ? high : value);
+}
+
+static void LoadBlock(const unsigned char* rgba, int width, int height, int rgbaRowPitch, int blockX, int blockY, BlockPixels* pixels)
+{
+	for (int i = 0; i < 16; ++i)
+	{
+		const int x = std::min(blockX * 4 + (i & 3), width - 1);
+		const int y = std::min(blockY * 4 + (i >> 2), height - 1);
+		const unsigned char* pixel = rgba + (size_t)y * rgbaRowPitch + x * 4;
+		for (int c = 0; c < 4; ++c)
+			pixels->channels[c][i] = pixel[c];
+	}
+}
+
+// The principal axis is found by power iteration on the covariance of the colors.
+static void FindEndpoints(const BlockPixels& pixels, int quality, int channelCount, float* low, float* high)
+{
+	float mean[4];
+	for (int c = 0; c < 4; ++c)
+	{
+		low[c] = pixels.channels[c][0];
+		high[c] = pixels.channels[c][0];
+		mean[c] = 0.0f;
+		for (int i = 0; i < 16; ++i)
+		{
+			low[c] = std::min(low[c], pixels.channels[c][i]);
+			high[c] = std::max(high[c], pixels.channels[c][i]);
+			mean[c] += pixels.channels[c][i];
+		}
+		mean[c] /= 16.0f;
+	}
+	if (quality == kDGCompressFast)
+		return;
+
+	float covariance[4][4] = {};
+	for (int i = 0; i < 16; ++i)
+	{
+		for (int a = 0; a < channelCount; ++a)
+		{
+			for (int b = 0; b < channelCount; ++b)
+				covariance[a][b] += (pixels.channels[a][i] - mean[a]) * (pixels.channels[b][i] - mean[b]);
+		}
+	}
+
+	float axis[4] = {};
+	for (int c = 0; c < channelCount; ++c)
+		axis[c] = high[c] - low[c];
+	for (int iteration = 0; iteration < 8; ++iteration)
+	{
+		float next[4] = {};
+		float largest = 1e-6f;
+		for (int a = 0; a < channelCount; ++a)
+		{
+			for (int b = 0; b < channelCount; ++b)
+				next[a] += covariance[a][b] * axis[b];
+			largest = std::max(largest, fabsf(next[a]));
+		}
+		for (int c = 0; c < channelCount; ++c)
+			axis[c] = next[c] / largest;
+	}
+
+	float lengthSquared = 0.0f;
+	for (int c = 0; c < channelCount; ++c)
+		lengthSquared += axis[c] * axis[c];
+	if (lengthSquared < 1e-6f)
+		return;
+	const float length = sqrtf(lengthSquared);
+	for (int c = 0; c < channelCount; ++c)
+		axis[c] /= length;
+
+	float minT = 0.0f;
+	float maxT = 0.0f;
+	for (int i = 0; i < 16; ++i)
+	{
+		float t = 0.0f;
+		for (int c = 0; c < channelCount; ++c)
+			t += (pixels.channels[c][i] - mean[c]) * axis[c];
+		minT = std::min(minT, t);
+		maxT = std::max(maxT, t);
+	}
+	for (int c = 0; c < channelCount; ++c)
+	{
+		low[c] = ClampFloat(mean[c] + axis[c] * minT, 0.0f, 255.0f);
+		high[c] = ClampFloat(mean[c] + axis[c] * maxT, 0.0f, 255.0f);
+	}
+}
+
+static void FindNearest(const float (*values)[16], int channelCount, const float (*palette)[4], int paletteCount, unsigned int* indices)
+{
+#if BC_ENCODER_SSE2
+	for (int i = 0; i < 16; i += 4)
+	{
+		__m128 bestDistance = _mm_set1_ps(1e30f);
+		__m128i best = _mm_setzero_si128();
+		for (int j = 0; j < paletteCount; ++j)
+		{
+			__m128 distance = _mm_setzero_ps();
+			for (int c = 0; c < channelCount; ++c)
+			{
+				const __m128 d = _mm_sub_ps(_mm_loadu_ps(values[c] + i), _mm_set1_ps(palette[j][c]));
+				distance = _mm_add_ps(distance, _mm_mul_ps(d, d));
+			}
+			const __m128i closer = _mm_castps_si128(_mm_cmplt_ps(distance, bestDistance));
+			bestDistance = _mm_min_ps(distance, bestDistance);
+			best = _mm_or_si128(_mm_andnot_si128(closer, best), _mm_and_si128(closer, _mm_set1_epi32(j)));
+		}
+		_mm_storeu_si128((__m128i*)(indices + i), best);
+	}
+#else
+	for (int i = 0; i < 16; ++i)
+	{
+		float bestDistance = 1e30f;
+		unsigned int best = 0;
+		for (int j = 0; j < paletteCount; ++j)
+		{
+			float distance = 0.0f;
+			for (int c = 0; c < channelCount; ++c)
+			{
+				const float d = values[c][i] - palette[j][c];
+				distance += d * d;
+			}
+			if (distance < bestDistance)
+			{
+				bestDistance = distance;
+				best = (unsigned int)j;
+			}
+		}
+		indices[i] = best;
+	}
+#endif
+}
+
+// Both p-bits are tried, ties go to p-bit 0.
+static void QuantizeBC7Endpoints(const float (*endpoints)[4], uint32_t (*quantized)[4], uint32_t* pbits)
+{
+	for (int e = 0; e < 2; ++e)
+	{
+		float bestError = 1e30f;
+		for (uint32_t pbit = 0; pbit < 2; ++pbit)
+		{
+			uint32_t q[4];
+			float error = 0.0f;
+			for (int c = 0; c < 4; ++c)
+			{
+				q[c] = (uint32_t)ClampFloat(RoundFloat((endpoints[e][c] - (float)pbit) / 2.0f), 0.0f, 127.0f);
+				const float d = (float)((q[c] << 1) | pbit) - endpoints[e][c];
+				error += d * d;
+			}
+			if (error < bestError)
+			{
+				bestError = error;
+				memcpy(quantized[e], q, sizeof(q));
+				pbits[e] = pbit;
+			}
+		}
+	}
+}
+
+static const BCKernels s_DefaultKernels = { LoadBlock, FindEndpoints, FindNearest, QuantizeBC7Endpoints };
+
+static bool CpuSupportsAVX2()
+{
+#if BC_ENCODER_CPUID
+	// AVX2 needs the CPU flags and the OS saving the ymm registers, which xgetbv reports
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7)
+		return false;
+	__cpuid(info, 1);
+	const unsigned int features = (unsigned int)info[2];
+	__cpuidex(info, 7, 0);
+	const unsigned int extendedFeatures = (unsigned int)info[1];
+#else
+	unsigned int eax, ebx, ecx, edx;
+	if (__get_cpuid_max(0, NULL) < 7)
+		return false;
+	__cpuid(1, eax, ebx, ecx, edx);
+	const unsigned int features = ecx;
+	__cpuid_count(7, 0, eax, ebx, ecx, edx);
+	const unsigned int extendedFeatures = ebx;
+#endif
+	const unsigned int osxsaveAndAvx = (1u << 27) | (1u << 28);
+	if ((features & osxsaveAndAvx) != osxsaveAndAvx || (extendedFeatures & (1u << 5)) == 0)
+		return false;
+#if defined(_MSC_VER)
+	const unsigned long long enabledState = _xgetbv(0);
+#else
+	unsigned int stateLow, stateHigh;
+	__asm__ __volatile__("xgetbv" : "=a"(stateLow), "=d"(stateHigh) : "c"(0));
+	const unsigned long long enabledState = ((unsigned long long)stateHigh << 32) | stateLow;
+#endif
+	return (enabledState & 6) == 6;
+#else
+	return false;
+#endif
+}
+
+// Picked once on first use, the AVX2 kernels when the CPU runs them and BlockCompression_AVX2.cpp was built with them
+static const BCKernels& GetBCKernels()
+{
+	static const BCKernels* kernels = CpuSupportsAVX2() && GetBCKernelsAVX2() != NULL ? GetBCKernelsAVX2() : &s_DefaultKernels;
+	return *kernels;
+}
+
+static uint32_t PackRGB565(const float* color)
+{
+	const uint32_t r = (uint32_t)RoundFloat(ClampFloat(color[0], 0.0f, 255.0f) * 31.0f / 255.0f);
+	const uint32_t g = (uint32_t)RoundFloat(ClampFloat(color[1], 0.0f, 255.0f) * 63.0f / 255.0f);
+	const uint32_t b = (uint32_t)RoundFloat(ClampFloat(color[2], 0.0f, 255.0f) * 31.0f / 255.0f);
+	return (r << 11) | (g << 5) | b;
+}
+
+static void UnpackRGB565(uint32_t color, float* outColor)
+{
+	outColor[0] = (float)((color >> 11) & 31) * 255.0f / 31.0f;
+	outColor[1] = (float)((color >> 5) & 63) * 255.0f / 63.0f;
+	outColor[2] = (float)(color & 31) * 255.0f / 31.0f;
+	outColor[3] = 0.0f;
+}
+
+// BC1 block in 4 color mode, color0 above color1.
+static void EncodeColorBlock(const BCKernels& kernels, const BlockPixels& pixels, int quality, uint32_t* block)
+{
+	float low[4];
+	float high[4];
+	kernels.findEndpoints(pixels, quality, 3, low, high);
+
+	uint32_t color0 = PackRGB565(high);
+	uint32_t color1 = PackRGB565(low);
+	if (color0 < color1)
+		std::swap(color0, color1);
+	block[0] = color0 | (color1 << 16);
+	block[1] = 0;
+	if (color0 == color1)
+		return;
+
+	float palette[4][4];
+	UnpackRGB565(color0, palette[0]);
+	UnpackRGB565(color1, palette[1]);
+	for (int c = 0; c < 4; ++c)
+	{
+		palette[2][c] = (2.0f * palette[0][c] + palette[1][c]) / 3.0f;
+		palette[3][c] = (palette[0][c] + 2.0f * palette[1][c]) / 3.0f;
+	}
+
+	unsigned int indices[16];
+	kernels.findNearest(pixels.channels, 3, palette, 4, indices);
+	for (int i = 0; i < 16; ++i)
+		block[1] |= indices[i] << (i * 2);
+}
+
+// BC4 block of the alpha channel in 8 value mode, alpha0 above alpha1.
+static void EncodeAlphaBlock(const BlockPixels& pixels, uint32_t* block)
+{
+	float low = 255.0f;
+	float high = 0.0f;
+	for (int i = 0; i < 16; ++i)
+	{
+		low = std::min(low, pixels.channels[3][i]);
+		high = std::max(high, pixels.channels[3][i]);
+	}
+
+	const uint32_t alpha0 = (uint32_t)RoundFloat(high);
+	const uint32_t alpha1 = (uint32_t)RoundFloat(low);
+	uint64_t bits = alpha0 | (alpha1 << 8);
+	if (alpha0 != alpha1)
+	{
+		for (int i = 0; i < 16; ++i)
+		{
+			// Steps up from alpha1, index 0 is alpha0 and 1 is alpha1 with the steps between them counting down from 2
+			const uint32_t level = (uint32_t)ClampFloat(RoundFloat((pixels.channels[3][i] - (float)alpha1) / (float)(alpha0 - alpha1) * 7.0f), 0.0f, 7.0f);
+			const uint64_t index = level == 7 ? 0 : (level == 0 ? 1 : 8 - level);
+			bits |= index << (16 + i * 3);
+		}
+	}
+	block[0] = (uint32_t)bits;
+	block[1] = (uint32_t)(bits >> 32);
+}
+
+static void WriteBits(uint32_t* block, int* position, uint32_t value, int count)
+{
+	const int word = *position >> 5;
+	const int bit = *position & 31;
+	block[word] |= value << bit;
+	if (bit + count > 32)
+		block[word + 1] |= value >> (32 - bit);
+	*position += count;
+}
+
+// BC7 mode 6: one subset, 7 bit rgba endpoints with a p-bit each and 4 bit indices.
+static void EncodeBC7Mode6(const BCKernels& kernels, const BlockPixels& pixels, int quality, uint32_t* block)
+{
+	float ends[2][4];
+	kernels.findEndpoints(pixels, quality, 4, ends[0], ends[1]);
+
+	uint32_t quantized[2][4];
+	uint32_t pbits[2];
+	kernels.quantizeBC7Endpoints(ends, quantized, pbits);
+	float endpoints[2][4];
+	for (int e = 0; e < 2; ++e)
+	{
+		for (int c = 0; c < 4; ++c)
+			endpoints[e][c] = (float)((quantized[e][c] << 1) | pbits[e]);
+	}
+
+	unsigned int indices[16];
+	if (quality == kDGCompressFast)
+	{
+		// Position of every pixel along the line between the endpoints, matched against the interpolation weights
+		float axis[4];
+		float axisLength = 0.0f;
+		for (int c = 0; c < 4; ++c)
+		{
+			axis[c] = endpoints[1][c] - endpoints[0][c];
+			axisLength += axis[c] * axis[c];
+		}
+		axisLength = std::max(axisLength, 1e-6f);
+
+		float positions[1][16];
+		for (int i = 0; i < 16; ++i)
+		{
+			float t = 0.0f;
+			for (int c = 0; c < 4; ++c)
+				t += (pixels.channels[c][i] - endpoints[0][c]) * axis[c];
+			positions[0][i] = ClampFloat(t / axisLength, 0.0f, 1.0f) * 64.0f;
+		}
+
+		float weights[16][4];
+		for (int j = 0; j < 16; ++j)
+			weights[j][0] = kBC7Weights[j];
+		kernels.findNearest(positions, 1, weights, 16, indices);
+	}
+	else
+	{
+		float palette[16][4];
+		for (int j = 0; j < 16; ++j)
+		{
+			for (int c = 0; c < 4; ++c)
+				palette[j][c] = floorf((endpoints[0][c] * (64.0f - kBC7Weights[j]) + endpoints[1][c] * kBC7Weights[j] + 32.0f) / 64.0f);
+		}
+		kernels.findNearest(pixels.channels, 4, palette, 16, indices);
+	}
+
+	// The top bit of the first index is implied zero, swap the endpoints when it is set
+	int first = 0;
+	if (indices[0] >= 8)
+	{
+		first = 1;
+		for (int i = 0; i < 16; ++i)
+			indices[i] = 15 - indices[i];
+	}
+
+	memset(block, 0, 16);
+	int position = 0;
+	WriteBits(block, &position, 1 << 6, 7);
+	for (int c = 0; c < 4; ++c)
+	{
+		WriteBits(block, &position, quantized[first][c], 7);
+		WriteBits(block, &position, quantized[1 - first][c], 7);
+	}
+	WriteBits(block, &position, pbits[first], 1);
+	WriteBits(block, &position, pbits[1 - first], 1);
+	WriteBits(block, &position, indices[0], 3);
+	for (int i = 1; i < 16; ++i)
+		WriteBits(block, &position, indices[i], 4);
+}
+
+// Blocks are little endian like every platform the plugin runs on, so they are written as 32 bit words.
+static void EncodeBlock(const BCKernels& kernels, int format, int quality, const BlockPixels& pixels, unsigned char* out)
+{
+	uint32_t block[4];
+	if (format == kBCFormatBC1)
+	{
+		EncodeColorBlock(kernels, pixels, quality, block);
+		memcpy(out, block, 8);
+	}
+	else if (format == kBCFormatBC3)
+	{
+		EncodeAlphaBlock(pixels, block);
+		EncodeColorBlock(kernels, pixels, quality, block + 2);
+		memcpy(out, block, 16);
+	}
+	else
+	{
+		EncodeBC7Mode6(kernels, pixels, quality, block);
+		memcpy(out, block, 16);
+	}
+}
+
+// Endpoints of a 5 or 6 bit channel whose 2:1 interpolation comes closest to value, expanded to 8 bits like decoders do.
+static void MatchSolidChannel(int value, int bits, uint32_t* outColor0, uint32_t* outColor1)
+{
+	const int levels = 1 << bits;
+	float bestError = 1e30f;
+	*outColor0 = 0;
+	*outColor1 = 0;
+	for (int a = 0; a < levels; ++a)
+	{
+		for (int b = 0; b < levels; ++b)
+		{
+			const int expandedA = (a << (8 - bits)) | (a >> (2 * bits - 8));
+			const int expandedB = (b << (8 - bits)) | (b >> (2 * bits - 8));
+			const float error = fabsf((2.0f * expandedA + expandedB) / 3.0f - (float)value);
+			if (error < bestError)
+			{
+				bestError = error;
+				*outColor0 = (uint32_t)a;
+				*outColor1 = (uint32_t)b;
+			}
+		}
+	}
+}
+
+// BC1 block of a single color, every pixel takes the entry two thirds of the way from color1 to color0.
+static void EncodeSolidColorBlock(const float* color, uint32_t* block)
+{
+	uint32_t red0, red1, green0, green1, blue0, blue1;
+	MatchSolidChannel((int)color[0], 5, &red0, &red1);
+	MatchSolidChannel((int)color[1], 6, &green0, &green1);
+	MatchSolidChannel((int)color[2], 5, &blue0, &blue1);
+
+	uint32_t color0 = (red0 << 11) | (green0 << 5) | blue0;
+	uint32_t color1 = (red1 << 11) | (green1 << 5) | blue1;
+	uint32_t index = 2;
+	if (color0 < color1)
+	{
+		// Swapped the entry sits two thirds of the way from color0 to color1
+		std::swap(color0, color1);
+		index = 3;
+	}
+	else if (color0 == color1)
+		index = 0;
+
+	block[0] = color0 | (color1 << 16);
+	block[1] = 0;
+	for (int i = 0; i < 16; ++i)
+		block[1] |= index << (i * 2);
+}
+
+void EncodeBCSolidBlock(int format, const float* color, bool srgb, bool bc1Alpha, unsigned char* block)
+{
+	float bytes[4];
+	BlockPixels pixels;
+	for (int c = 0; c < 4; ++c)
+	{
+		float value = ClampFloat(color[c], 0.0f, 1.0f);
+		if (srgb && c < 3)
+			value = value <= 0.0031308f ? value * 12.92f : 1.055f * powf(value, 1.0f / 2.4f) - 0.055f;
+		bytes[c] = RoundFloat(value * 255.0f);
+		for (int i = 0; i < 16; ++i)
+			pixels.channels[c][i] = bytes[c];
+	}
+
+	uint32_t words[4];
+	if (format == kBCFormatBC1 && bc1Alpha && bytes[3] < 128.0f)
+	{
+		// color0 <= color1 selects three colors and transparent black, every pixel takes the transparent entry
+		words[0] = 0;
+		words[1] = 0xFFFFFFFF;
+		memcpy(block, words, 8);
+	}
+	else if (format == kBCFormatBC1)
+	{
+		EncodeSolidColorBlock(bytes, words);
+		memcpy(block, words, 8);
+	}
+	else if (format == kBCFormatBC3)
+	{
+		EncodeAlphaBlock(pixels, words);
+		EncodeSolidColorBlock(bytes, words + 2);
+		memcpy(block, words, 16);
+	}
+	else
+	{
+		EncodeBlock(GetBCKernels(), format, kDGCompressHigh, pixels, block);
+	}
+}
+
+
+// --------------------------------------------------------------------------
+// Worker pool
+// An encode is split into rows of blocks that the workers and the calling thread take in turn from an atomic counter.
+// The pool is created by the first encode that is large enough to share and is never destroyed by static destructors,
+// so a process exiting without ShutdownBCEncoder neither waits for nor terminates on the worker threads.
+
+struct EncodeJob
+{
+	int format;
+	int quality;
+	const unsigned char* rgba;
+	int width;
+	int height;
+	int rgbaRowPitch;
+	unsigned char* blocks;
+	int blockRowPitch;
+	int blocksWide;
+	int blocksHigh;
+	std::atomic<int> nextRow;
+};
+
+struct WorkerPool
+{
+	std::mutex mutex;
+	std::condition_variable workReady;
+	std::condition_variable workDone;
+	std::vector<std::thread> threads;
+	EncodeJob* job;				// job the workers may join, NULL once the calling thread ran out of rows
+	unsigned int jobGeneration;	// bumped for every job so a worker joins each job once
+	int busyWorkers;
+	bool stop;
+};
+
+// Encodes smaller than this many rows of blocks per thread stay on the calling thread
+static const int kMinRowsPerThread = 4;
+static const int kMaxWorkers = 15;
+
+static std::mutex s_EncodeMutex;	// one encode at a time, held by ShutdownBCEncoder while the workers stop
+static WorkerPool* s_Pool = NULL;
+
+static void EncodeRows(EncodeJob* job)
+{
+	const int blockBytes = GetBCBlockBytes(job->format);
+	const BCKernels& kernels = GetBCKernels();
+	BlockPixels pixels;
+	for (int row = job->nextRow.fetch_add(1, std::memory_order_relaxed); row < job->blocksHigh; row = job->nextRow.fetch_add(1, std::memory_order_relaxed))
+	{
+		unsigned char* out = job->blocks + (size_t)row * job->blockRowPitch;
+		for (int column = 0; column < job->blocksWide; ++column, out += blockBytes)
+		{
+			kernels.loadBlock(job->rgba, job->width, job->height, job->rgbaRowPitch, column, row, &pixels);
+			EncodeBlock(kernels, job->format, job->quality, pixels, out);
+		}
+	}
+}
+
+static void WorkerMain(WorkerPool* pool)
+{
+	unsigned int generation = 0;
+	std::unique_lock<std::mutex> lock(pool->mutex);
+	while (true)
+	{
+		while (!pool->stop && (pool->job == NULL || pool->jobGeneration == generation))
+			pool->workReady.wait(lock);
+		if (pool->stop)
+			return;
+
+		generation = pool->jobGeneration;
+		EncodeJob* job = pool->job;
+		++pool->busyWorkers;
+		lock.unlock();
+
+		EncodeRows(job);
+
+		lock.lock();
+		if (--pool->busyWorkers == 0)
+			pool->workDone.notify_all();
+	}
+}
+
+void EncodeBCBlocks(int format, int quality, const unsigned char* rgba, int width, int height, int rgbaRowPitch, unsigned char* blocks, int blockRowPitch)
+{
+	if (width <= 0 || height <= 0)
+		return;
+
+	EncodeJob job;
+	job.format = format;
+	job.quality = quality;
+	job.rgba = rgba;
+	job.width = width;
+	job.height = height;
+	job.rgbaRowPitch = rgbaRowPitch;
+	job.blocks = blocks;
+	job.blockRowPitch = blockRowPitch;
+	job.blocksWide = (width + 3) / 4;
+	job.blocksHigh = (height + 3) / 4;
+	job.nextRow.store(0, std::memory_order_relaxed);
+
+	std::lock_guard<std::mutex> encodeLock(s_EncodeMutex);
+
+	if (job.blocksHigh < kMinRowsPerThread * 2)
+	{
+		EncodeRows(&job);
+		return;
+	}
+
+	if (s_Pool == NULL)
+	{
+		s_Pool = new WorkerPool();
+		s_Pool->job = NULL;
+		s_Pool->jobGeneration = 0;
+		s_Pool->busyWorkers = 0;
+		s_Pool->stop = false;
+
+		const int hardwareThreads = (int)std::thread::hardware_concurrency();
+		const int workerCount = std::min(hardwareThreads - 1, kMaxWorkers);
+		for (int i = 0; i < workerCount; ++i)
+			s_Pool->threads.push_back(std::thread(WorkerMain, s_Pool));
+	}
+	if (s_Pool->threads.empty())
+	{
+		EncodeRows(&job);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(s_Pool->mutex);
+		s_Pool->job = &job;
+		++s_Pool->jobGeneration;
+	}
+	s_Pool->workReady.notify_all();
+
+	EncodeRows(&job);
+
+	// Workers that did not join in time must not find the job anymore, the ones that did are waited for
+	std::unique_lock<std::mutex> lock(s_Pool->mutex);
+	s_Pool->job = NULL;
+	while (s_Pool->busyWorkers > 0)
+		s_Pool->workDone.wait(lock);
+}
+
+void ShutdownBCEncoder()
+{
+	std::lock_guard<std::mutex> encodeLock(s_EncodeMutex);
+	if (s_Pool == NULL)
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(s_Pool->mutex);
+		s_Pool->stop = true;
+	}
+	s_Pool->workReady.notify_all();
+	for (size_t i = 0; i < s_Pool->threads.size(); ++i)
+		s_Pool->threads[i].join();
+
+	delete s_Pool;
+	s_Pool = NULL;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+// CPU encoders of the block compressed formats that can be created through DirectGraphics, for pixels generated on the
+// CPU. They follow the compute kernels of RenderAPI_Metal.mm, so GPU and CPU encoded textures look the same.
+
+
+// Block compressed formats the encoder writes.
+enum BCFormat
+{
+	kBCFormatBC1 = 0,	// 8 byte blocks, rgb with 4 colors per block
+	kBCFormatBC3 = 1,	// 16 byte blocks, a BC4 alpha block followed by a BC1 color block
+	kBCFormatBC7 = 2,	// 16 byte blocks, written in mode 6
+};
+
+inline int GetBCBlockBytes(int format)
+{
+	return format == kBCFormatBC1 ? 8 : 16;
+}
+
+// Encode width x height RGBA32 pixels, rows rgbaRowPitch bytes apart, into rows of blocks blockRowPitch bytes apart.
+// The edge blocks of sizes that are no multiple of 4 repeat the last row and column. quality is a DGCompressQuality.
+// Rows of blocks are spread over a pool of worker threads that the calling thread joins, calls from several threads
+// run one after the other.
+void EncodeBCBlocks(int format, int quality, const unsigned char* rgba, int width, int height, int rgbaRowPitch, unsigned char* blocks, int blockRowPitch);
+
+// One block of a single color, for clearing compressed textures. color is rgba from 0 to 1. srgb encodes rgb with the
+// sRGB curve first, like clears of sRGB textures do. BC1 colors are matched by interpolating between two endpoints, which
+// comes closer than rounding to 565. bc1Alpha is set for BC1 formats with punch-through alpha, where alpha below one
+// half clears to the transparent entry instead.
+void EncodeBCSolidBlock(int format, const float* color, bool srgb, bool bc1Alpha, unsigned char* block);
+
+// Stop the worker threads. The pool starts again on the next EncodeBCBlocks.
+void ShutdownBCEncoder();
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdint.h>
+
+// Kernels of the CPU block encoders that have a version for every instruction set BlockCompression.cpp picks from at
+// runtime. BlockCompression_AVX2.cpp is the only file built with AVX2 enabled. It must not share inline functions or
+// templates with the other files, the linker could keep its AVX2 copy for all of them.
+
+
+// The pixels of a block are kept as 16 floats per channel in the range 0 to 255, so the palette searches compare 4 or 8
+// pixels at once.
+struct BlockPixels
+{
+	float channels[4][16];
+};
+
+struct BCKernels
+{
+	// Pixels of the block at blockX, blockY of width x height RGBA32 pixels. Edge blocks repeat the last row and column.
+	void (*loadBlock)(const unsigned char* rgba, int width, int height, int rgbaRowPitch, int blockX, int blockY, BlockPixels* pixels);
+
+	// Endpoints of the first channelCount channels. Fast takes the bounding box of the block, High the extent of the
+	// block along its principal axis.
+	void (*findEndpoints)(const BlockPixels& pixels, int quality, int channelCount, float* low, float* high);
+
+	// Index of the palette entry nearest to every one of the 16 values, compared over the first channelCount channels.
+	// Ties go to the lower index.
+	void (*findNearest)(const float (*values)[16], int channelCount, const float (*palette)[4], int paletteCount, unsigned int* indices);
+
+	// 7 bit BC7 mode 6 endpoints and the p-bit of each, chosen by the least squared error to the two rgba endpoints.
+	void (*quantizeBC7Endpoints)(const float (*endpoints)[4], uint32_t (*quantized)[4], uint32_t* pbits);
+};
+
+// Kernels of BlockCompression_AVX2.cpp, NULL when it was built for a target or with a compiler without AVX2.
+// Only call them once the CPU reported AVX2 support.
+const BCKernels* GetBCKernelsAVX2();
@@ -0,0 +1,225 @@
+#include "BlockCompressionKernels.h"
+#include "DirectGraphics.h"
+
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+// The only file built with AVX2 enabled, -mavx2 or /arch:AVX2, see BlockCompressionKernels.h. Builds without it
+// compile to a GetBCKernelsAVX2 returning NULL and the encoders keep to the SSE2 kernels.
+#if defined(__AVX2__)
+	#define BC_ENCODER_AVX2 1
+	#include <immintrin.h>
+#else
+	#define BC_ENCODER_AVX2 0
+#endif
+
+#if BC_ENCODER_AVX2
+
+// --------------------------------------------------------------------------
+// AVX2 kernels
+// The 16 pixels of a channel fill two registers of 8 floats.
+
+static float ReduceMin(__m256 value)
+{
+	__m128 m = _mm_min_ps(_mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1));
+	m = _mm_min_ps(m, _mm_movehl_ps(m, m));
+	return _mm_cvtss_f32(_mm_min_ss(m, _mm_shuffle_ps(m, m, 1)));
+}
+
+static float ReduceMax(__m256 value)
+{
+	__m128 m = _mm_max_ps(_mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1));
+	m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+	return _mm_cvtss_f32(_mm_max_ss(m, _mm_shuffle_ps(m, m, 1)));
+}
+
+static float ReduceAdd(__m256 value)
+{
+	__m128 m = _mm_add_ps(_mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1));
+	m = _mm_add_ps(m, _mm_movehl_ps(m, m));
+	return _mm_cvtss_f32(_mm_add_ss(m, _mm_shuffle_ps(m, m, 1)));
+}
+
+static float ClampFloatAVX2(float value, float low, float high)
+{
+	return value < low ? low : (value > high ? high : value);
+}
+
+// 16 bytes of one channel widened to floats
+static void StoreChannel(__m128i bytes, float* out)
+{
+	_mm256_storeu_ps(out, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(bytes)));
+	_mm256_storeu_ps(out + 8, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(bytes, 8))));
+}
+
+static void LoadBlockAVX2(const unsigned char* rgba, int width, int height, int rgbaRowPitch, int blockX, int blockY, BlockPixels* pixels)
+{
+	const int left = blockX * 4;
+	const int top = blockY * 4;
+	if (left + 4 > width || top + 4 > height)
+	{
+		// Edge blocks repeat the last row and column
+		for (int i = 0; i < 16; ++i)
+		{
+			const int x = left + (i & 3) < width ? left + (i & 3) : width - 1;
+			const int y = top + (i >> 2) < height ? top + (i >> 2) : height - 1;
+			const unsigned char* pixel = rgba + (size_t)y * rgbaRowPitch + x * 4;
+			for (int c = 0; c < 4; ++c)
+				pixels->channels[c][i] = pixel[c];
+		}
+		return;
+	}
+
+	const unsigned char* row = rgba + (size_t)top * rgbaRowPitch + left * 4;
+	__m256i rows01 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)row)), _mm_loadu_si128((const __m128i*)(row + rgbaRowPitch)), 1);
+	__m256i rows23 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(row + 2 * rgbaRowPitch))), _mm_loadu_si128((const __m128i*)(row + 3 * rgbaRowPitch)), 1);
+
+	// Every row to its 4 red, 4 green, 4 blue and 4 alpha bytes
+	const __m256i channelMajor = _mm256_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15, 0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+	rows01 = _mm256_shuffle_epi8(rows01, channelMajor);
+	rows23 = _mm256_shuffle_epi8(rows23, channelMajor);
+
+	// Red and green of both rows to the low half, blue and alpha to the high half, then the rows of a channel side by side
+	const __m256i channelPairs = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+	rows01 = _mm256_permutevar8x32_epi32(rows01, channelPairs);
+	rows23 = _mm256_permutevar8x32_epi32(rows23, channelPairs);
+	const __m256i redBlue = _mm256_unpacklo_epi64(rows01, rows23);
+	const __m256i greenAlpha = _mm256_unpackhi_epi64(rows01, rows23);
+
+	StoreChannel(_mm256_castsi256_si128(redBlue), pixels->channels[0]);
+	StoreChannel(_mm256_castsi256_si128(greenAlpha), pixels->channels[1]);
+	StoreChannel(_mm256_extracti128_si256(redBlue, 1), pixels->channels[2]);
+	StoreChannel(_mm256_extracti128_si256(greenAlpha, 1), pixels->channels[3]);
+}
+
+static void FindEndpointsAVX2(const BlockPixels& pixels, int quality, int channelCount, float* low, float* high)
+{
+	__m256 centered[4][2];
+	float mean[4];
+	for (int c = 0; c < 4; ++c)
+	{
+		const __m256 first = _mm256_loadu_ps(pixels.channels[c]);
+		const __m256 second = _mm256_loadu_ps(pixels.channels[c] + 8);
+		low[c] = ReduceMin(_mm256_min_ps(first, second));
+		high[c] = ReduceMax(_mm256_max_ps(first, second));
+		mean[c] = ReduceAdd(_mm256_add_ps(first, second)) / 16.0f;
+		centered[c][0] = _mm256_sub_ps(first, _mm256_set1_ps(mean[c]));
+		centered[c][1] = _mm256_sub_ps(second, _mm256_set1_ps(mean[c]));
+	}
+	if (quality == kDGCompressFast)
+		return;
+
+	float covariance[4][4] = {};
+	for (int a = 0; a < channelCount; ++a)
+	{
+		for (int b = a; b < channelCount; ++b)
+		{
+			covariance[a][b] = ReduceAdd(_mm256_add_ps(_mm256_mul_ps(centered[a][0], centered[b][0]), _mm256_mul_ps(centered[a][1], centered[b][1])));
+			covariance[b][a] = covariance[a][b];
+		}
+	}
+
+	float axis[4] = {};
+	for (int c = 0; c < channelCount; ++c)
+		axis[c] = high[c] - low[c];
+	for (int iteration = 0; iteration < 8; ++iteration)
+	{
+		float next[4] = {};
+		float largest = 1e-6f;
+		for (int a = 0; a < channelCount; ++a)
+		{
+			for (int b = 0; b < channelCount; ++b)
+				next[a] += covariance[a][b] * axis[b];
+			if (fabsf(next[a]) > largest)
+				largest = fabsf(next[a]);
+		}
+		for (int c = 0; c < channelCount; ++c)
+			axis[c] = next[c] / largest;
+	}
+
+	float lengthSquared = 0.0f;
+	for (int c = 0; c < channelCount; ++c)
+		lengthSquared += axis[c] * axis[c];
+	if (lengthSquared < 1e-6f)
+		return;
+	const float length = sqrtf(lengthSquared);
+
+	__m256 first = _mm256_setzero_ps();
+	__m256 second = _mm256_setzero_ps();
+	for (int c = 0; c < channelCount; ++c)
+	{
+		axis[c] /= length;
+		first = _mm256_add_ps(first, _mm256_mul_ps(centered[c][0], _mm256_set1_ps(axis[c])));
+		second = _mm256_add_ps(second, _mm256_mul_ps(centered[c][1], _mm256_set1_ps(axis[c])));
+	}
+	const float minT = ReduceMin(_mm256_min_ps(_mm256_min_ps(first, second), _mm256_setzero_ps()));
+	const float maxT = ReduceMax(_mm256_max_ps(_mm256_max_ps(first, second), _mm256_setzero_ps()));
+	for (int c = 0; c < channelCount; ++c)
+	{
+		low[c] = ClampFloatAVX2(mean[c] + axis[c] * minT, 0.0f, 255.0f);
+		high[c] = ClampFloatAVX2(mean[c] + axis[c] * maxT, 0.0f, 255.0f);
+	}
+}
+
+static void FindNearestAVX2(const float (*values)[16], int channelCount, const float (*palette)[4], int paletteCount, unsigned int* indices)
+{
+	for (int i = 0; i < 16; i += 8)
+	{
+		__m256 bestDistance = _mm256_set1_ps(1e30f);
+		__m256i best = _mm256_setzero_si256();
+		for (int j = 0; j < paletteCount; ++j)
+		{
+			__m256 distance = _mm256_setzero_ps();
+			for (int c = 0; c < channelCount; ++c)
+			{
+				const __m256 d = _mm256_sub_ps(_mm256_loadu_ps(values[c] + i), _mm256_set1_ps(palette[j][c]));
+				distance = _mm256_add_ps(distance, _mm256_mul_ps(d, d));
+			}
+			const __m256 closer = _mm256_cmp_ps(distance, bestDistance, _CMP_LT_OQ);
+			bestDistance = _mm256_min_ps(distance, bestDistance);
+			best = _mm256_blendv_epi8(best, _mm256_set1_epi32(j), _mm256_castps_si256(closer));
+		}
+		_mm256_storeu_si256((__m256i*)(indices + i), best);
+	}
+}
+
+// Both p-bits of an endpoint are quantized at once, p-bit 0 in the low half. The errors are summed in channel order like
+// the SSE2 kernel does, so both pick the same p-bit.
+static void QuantizeBC7EndpointsAVX2(const float (*endpoints)[4], uint32_t (*quantized)[4], uint32_t* pbits)
+{
+	const __m256 pbit = _mm256_setr_ps(0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f);
+	const __m256 half = _mm256_set1_ps(0.5f);
+	for (int e = 0; e < 2; ++e)
+	{
+		const __m256 endpoint = _mm256_broadcast_ps((const __m128*)endpoints[e]);
+		__m256 q = _mm256_floor_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(endpoint, pbit), half), half));
+		q = _mm256_min_ps(_mm256_max_ps(q, _mm256_setzero_ps()), _mm256_set1_ps(127.0f));
+		const __m256 d = _mm256_sub_ps(_mm256_add_ps(_mm256_add_ps(q, q), pbit), endpoint);
+
+		float squares[8];
+		uint32_t levels[8];
+		_mm256_storeu_ps(squares, _mm256_mul_ps(d, d));
+		_mm256_storeu_si256((__m256i*)levels, _mm256_cvttps_epi32(q));
+		const float error0 = squares[0] + squares[1] + squares[2] + squares[3];
+		const float error1 = squares[4] + squares[5] + squares[6] + squares[7];
+		pbits[e] = error1 < error0 ? 1 : 0;
+		memcpy(quantized[e], levels + pbits[e] * 4, sizeof(quantized[e]));
+	}
+}
+
+static const BCKernels s_AVX2Kernels = { LoadBlockAVX2, FindEndpointsAVX2, FindNearestAVX2, QuantizeBC7EndpointsAVX2 };
+
+const BCKernels* GetBCKernelsAVX2()
+{
+	return &s_AVX2Kernels;
+}
+
+#else
+
+const BCKernels* GetBCKernelsAVX2()
+{
+	return NULL;
+}
+
+#endif // #if BC_ENCODER_AVX2
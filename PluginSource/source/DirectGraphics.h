@@ -0,0 +1,185 @@
+#pragma once
+
+// Plain data types shared by the exported plugin functions and the C# DirectGraphics wrapper.
+// The layouts here are mirrored in DirectGraphics.cs; keep both in sync when changing a field.
+
+
+enum DGCommandType
+{
+	kDGCommandCopy = 0,		// Copy a rectangle from source to destination
+	kDGCommandClear = 1,	// Set every pixel of destination to color
+	kDGCommandCreate = 2,	// Create a native texture, the new texture handle is written to outTextureIndex
+	kDGCommandDestroy = 3,	// Destroy the native texture with the handle in textureIndex
+	kDGCommandReadback = 4,	// Copy the rectangle of a RequestReadback ticket into CPU visible memory
+	kDGCommandGenerateMips = 5,	// Rebuild every mip level of destination below the top one from the top level
+	kDGCommandBlit = 6,		// Scale the source rectangle into the destination rectangle
+	kDGCommandConvert = 7,	// Copy a rectangle between textures of different formats, applying convertOptions on the way
+	kDGCommandCompress = 8,	// Encode a rectangle of an uncompressed source into the blocks of a BC1, BC3 or BC7 destination
+	kDGCommandUpload = 9,	// Copy the CPU pixel rows in data into a rectangle of destination, built by CreateUploadCommand
+	kDGCommandUploadCompressed = 10,	// Encode the RGBA32 rows in data into the blocks of a BC1, BC3 or BC7 destination, built by CreateCompressedUploadCommand
+	kDGCommandClearRect = 11,	// Set a rectangle of destination to color, clipped to the texture
+	kDGCommandGenerate = 12,	// Fill a rectangle of destination with the pattern of the DGGenerateParams in data, built by CreateGenerateCommand
+	kDGCommandTypeCount
+};
+
+// Filtering of kDGCommandBlit when the rectangles differ in size.
+enum DGFilter
+{
+	kDGFilterNearest = 0,
+	kDGFilterLinear = 1,
+};
+
+// Per pixel operations of kDGCommandConvert, applied in this order to the color read from the source.
+enum DGConvertOption
+{
+	kDGConvertSwizzle = 1,			// Reorder the channels as given by swizzle
+	kDGConvertSRGBToLinear = 2,		// Decode the rgb channels from the sRGB curve
+	kDGConvertPremultiplyAlpha = 4,	// Multiply the rgb channels by alpha
+	kDGConvertLinearToSRGB = 8,		// Encode the rgb channels with the sRGB curve
+	kDGConvertOptionsAll = 15,
+};
+
+// Channel sources of DGCommand::swizzle, 4 bits per destination channel starting with red in the lowest bits.
+enum DGSwizzleChannel
+{
+	kDGSwizzleRed = 0,
+	kDGSwizzleGreen = 1,
+	kDGSwizzleBlue = 2,
+	kDGSwizzleAlpha = 3,
+	kDGSwizzleZero = 4,
+	kDGSwizzleOne = 5,
+};
+
+// Encoder effort of kDGCommandCompress.
+enum DGCompressQuality
+{
+	kDGCompressFast = 0,	// Endpoints from the bounding box of the block colors
+	kDGCompressHigh = 1,	// Endpoints along the principal axis of the block colors, indices by nearest palette entry
+};
+
+// Patterns of kDGCommandGenerate. The noises and Voronoi go from colorA at 0 to colorB at 1.
+enum DGGenerator
+{
+	kDGGenerateValueNoise = 0,		// Random values at the cell corners, smoothly interpolated
+	kDGGeneratePerlinNoise = 1,		// Random gradients at the cell corners
+	kDGGenerateSimplexNoise = 2,	// Random gradients at the corners of triangular cells, fewer axis aligned artifacts
+	kDGGenerateLinearGradient = 3,	// colorA at start to colorB at end, constant across the line between them
+	kDGGenerateRadialGradient = 4,	// colorA at start to colorB at the distance of end from start
+	kDGGenerateCheckerboard = 5,	// Cells alternating between colorA and colorB
+	kDGGenerateVoronoi = 6,			// Distance to the nearest of one random point per cell
+	kDGGeneratorCount
+};
+
+// Parameters of a kDGCommandGenerate. Patterns are laid out in texture pixels, so neighbouring textures continue each
+// other when start is offset by the texture position.
+struct DGGenerateParams
+{
+	int generator;			// DGGenerator
+	int x;					// rectangle of the texture to fill
+	int y;
+	int width;
+	int height;
+	float colorA[4];		// rgba
+	float colorB[4];
+	float start[2];			// Gradients: start point in pixels, others: offset of the pattern in pixels
+	float end[2];			// Gradients: end point in pixels
+	float cellSize;			// Noises/Checkerboard/Voronoi: size of a cell in pixels
+	int octaves;			// Noises: layers of fractal Brownian motion, 1 for plain noise
+	float lacunarity;		// Noises: cell size divisor from one octave to the next
+	float gain;				// Noises: amplitude factor from one octave to the next
+	unsigned int seed;		// Noises/Voronoi: different seeds give unrelated patterns
+};
+
+// Event IDs understood by the callback returned from GetRenderEventFunc.
+enum DGRenderEvent
+{
+	kDGRenderEventFlushCommands = 1,	// Execute everything queued with EnqueueCommandBatch on the render thread
+};
+
+// A single operation inside a ValidateCommandBatch, SubmitCommandBatch or EnqueueCommandBatch call. Only the fields used by the command type are read.
+struct DGCommand
+{
+	int type;				// DGCommandType
+
+	void* source;			// Copy/Blit/Convert/Compress: native source texture
+	void* destination;		// Copy/Blit/Convert/Compress: native destination texture, Clear/ClearRect/GenerateMips/Upload/UploadCompressed/Generate: native target texture
+
+	int sourceX;			// Copy/Blit/Convert/Compress: source rectangle
+	int sourceY;
+	int width;				// Copy/Blit/Convert/Compress: source rectangle size, ClearRect/Upload/UploadCompressed: destination rectangle size, Create: texture size
+	int height;
+	int destinationX;		// Copy/Blit/Convert/Compress/ClearRect/Upload/UploadCompressed: position in destination, a multiple of 4 for Compress/UploadCompressed
+	int destinationY;
+
+	float color[4];			// Clear/ClearRect: rgba
+
+	int format;				// Create: native texture format
+	int textureIndex;		// Destroy: handle of the texture to destroy
+	int* outTextureIndex;	// Create: receives the new texture handle or -1, may be NULL
+	int ticket;				// Readback: ticket returned by RequestReadback
+
+	int destinationWidth;	// Blit: destination rectangle size
+	int destinationHeight;
+	int filter;				// Blit: DGFilter
+
+	int sourceLayer;		// Copy/Blit/Convert/Compress: array layer of source, 0 for textures that are no array
+	int destinationLayer;	// Copy/Blit/Convert/Compress/Clear/ClearRect/Upload/UploadCompressed/Generate: array layer of destination
+
+	int convertOptions;		// Convert: DGConvertOption flags
+	int swizzle;			// Convert: DGSwizzleChannel of every destination channel, read with kDGConvertSwizzle
+	int quality;			// Compress/UploadCompressed: DGCompressQuality
+
+	void* data;				// Upload/UploadCompressed: copy of the caller's pixel rows, Generate: copy of the caller's DGGenerateParams, owned by the plugin and released once recorded
+	int dataRowPitch;		// Upload/UploadCompressed: bytes from one row of data to the next
+};
+
+// One texture of a CreateNativeTextures call.
+struct DGTextureDesc
+{
+	int width;
+	int height;
+	int format;				// native texture format
+	int mipCount;			// mip levels, 0 or 1 for none and negative for the full chain down to 1x1
+};
+
+// One sprite of an AtlasAdd call, a rectangle of a native source texture.
+struct DGAtlasSprite
+{
+	void* source;
+	int x;
+	int y;
+	int width;
+	int height;
+};
+
+// Where AtlasAdd or AtlasRepack put a sprite.
+struct DGAtlasRect
+{
+	int entry;				// id of the sprite within its atlas, -1 when it could not be placed
+	int page;				// atlas page holding the sprite
+	int x;					// rectangle of the sprite within the page
+	int y;
+	int width;
+	int height;
+};
+
+// One rectangle of a texture, backends gather the rectangles of consecutive kDGCommandClearRect commands into these.
+struct DGRect
+{
+	int x;
+	int y;
+	int width;
+	int height;
+};
+
+// One rectangle of a copy between a pair of texture layers, consecutive kDGCommandCopy commands between the same pair
+// are recorded as a list of these.
+struct DGCopyRegion
+{
+	int sourceX;
+	int sourceY;
+	int width;
+	int height;
+	int destinationX;
+	int destinationY;
+};
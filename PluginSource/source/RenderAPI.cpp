@@ -1,7 +1,105 @@
 #include "RenderAPI.h"
+#include "BlockCompression.h"
 #include "PlatformBase.h"
 #include "Unity/IUnityGraphics.h"
 
+#include <string.h>
+#include <vector>
+
+
+void RenderAPI::SubmitCommands(const DGCommand* commands, int count)
+{
+	for (int i = 0; i < count; ++i)
+	{
+		const DGCommand& command = commands[i];
+		if (command.sourceLayer != 0 || command.destinationLayer != 0)
+			continue;
+		if (command.type == kDGCommandCopy)
+			DoCopyTexture(command.source, command.sourceX, command.sourceY, command.width, command.height, command.destination, command.destinationX, command.destinationY);
+		else if (command.type == kDGCommandClear)
+			SetTextureColor(command.color[0], command.color[1], command.color[2], command.color[3], command.destination);
+		else if (command.type == kDGCommandClearRect)
+		{
+			int width, height;
+			if (command.destinationX <= 0 && command.destinationY <= 0 && GetTextureSize(command.destination, &width, &height) &&
+				command.destinationX + command.width >= width && command.destinationY + command.height >= height)
+				SetTextureColor(command.color[0], command.color[1], command.color[2], command.color[3], command.destination);
+		}
+		else if (command.type == kDGCommandGenerateMips)
+			GenerateMips(command.destination);
+		else if (command.type == kDGCommandBlit)
+			BlitTexture(command.source, command.sourceX, command.sourceY, command.width, command.height, command.destination, command.destinationX, command.destinationY, command.destinationWidth, command.destinationHeight, command.filter);
+		else if (command.type == kDGCommandConvert && command.convertOptions == 0)
+			BlitTexture(command.source, command.sourceX, command.sourceY, command.width, command.height, command.destination, command.destinationX, command.destinationY, command.width, command.height, kDGFilterNearest);
+	}
+}
+
+void RenderAPI::BlitTexture(void* sourceTexture, int sourceX, int sourceY, int sourceWidth, int sourceHeight, void* destinationTexture, int destinationX, int destinationY, int destinationWidth, int destinationHeight, int filter)
+{
+	if (sourceWidth == destinationWidth && sourceHeight == destinationHeight)
+		DoCopyTexture(sourceTexture, sourceX, sourceY, sourceWidth, sourceHeight, destinationTexture, destinationX, destinationY);
+}
+
+void RenderAPI::CreateTextures(const DGTextureDesc* descs, int* textureIndices, int count)
+{
+	for (int i = 0; i < count; ++i)
+	{
+		if (textureIndices[i] >= 0 && !CreateTexture(descs[i].width, descs[i].height, descs[i].format, descs[i].mipCount, textureIndices[i]))
+			textureIndices[i] = -1;
+	}
+}
+
+void RenderAPI::DestroyTextures(const int* textureIndices, int count)
+{
+	for (int i = 0; i < count; ++i)
+	{
+		if (textureIndices[i] >= 0)
+			DestroyTexture(textureIndices[i]);
+	}
+}
+
+bool RenderAPI::UploadTexture(void* texture, int layer, int x, int y, int width, int height, const void* data, int dataRowPitch)
+{
+	if (layer != 0 || x != 0 || y != 0)
+		return false;
+
+	int rowPitch;
+	unsigned char* dst = (unsigned char*)BeginModifyTexture(texture, width, height, &rowPitch);
+	if (dst == NULL)
+		return false;
+
+	const int copyPitch = dataRowPitch < rowPitch ? dataRowPitch : rowPitch;
+	for (int row = 0; row < height; ++row)
+		memcpy(dst + row * rowPitch, (const unsigned char*)data + row * dataRowPitch, copyPitch);
+
+	EndModifyTexture(texture, width, height, rowPitch, dst);
+	return true;
+}
+
+bool RenderAPI::UploadCompressedTexture(void* texture, int layer, int x, int y, int width, int height, const void* rgba, int rgbaRowPitch, int quality)
+{
+	const int format = GetTextureBCFormat(texture);
+	if (format < 0)
+		return false;
+
+	const int blockRowPitch = (width + 3) / 4 * GetBCBlockBytes(format);
+	std::vector<unsigned char> blocks((size_t)blockRowPitch * ((height + 3) / 4));
+	EncodeBCBlocks(format, quality, (const unsigned char*)rgba, width, height, rgbaRowPitch, &blocks[0], blockRowPitch);
+	return UploadTexture(texture, layer, x, y, width, height, &blocks[0], blockRowPitch);
+}
+
+bool RenderAPI::GetTextureBlockInfo(void* texture, int* outBlockBytes, int* outBlockWidth, int* outBlockHeight)
+{
+	const int format = GetTextureBCFormat(texture);
+	if (format < 0)
+		return false;
+
+	*outBlockBytes = GetBCBlockBytes(format);
+	*outBlockWidth = 4;
+	*outBlockHeight = 4;
+	return true;
+}
+
 
 RenderAPI* CreateRenderAPI(UnityGfxRenderer apiType)
 {
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "Unity/IUnityGraphics.h"
+#include "DirectGraphics.h"
 
 #include <stddef.h>
+#include <atomic>
 
 struct IUnityInterfaces;
 
@@ -34,13 +36,187 @@ public:
 	virtual void EndModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr) = 0;
 
 	virtual void DoCopyTexture(void *sourceTexture, int sourceX, int sourceY, int sourceWidth, int sourceHeight, void *destinationTexture, int destinationX, int destinationY) = 0;
-    virtual bool CreateTexture(int width, int height, int format, int textureIndex) = 0;
+	// mipCount is at least 1 and never more than FullMipCount of the size.
+    virtual bool CreateTexture(int width, int height, int format, int mipCount, int textureIndex) = 0;
 	virtual void DestroyTexture(int textureIndex) = 0;
 	virtual void* GetTexturePointer(int textureIndex) = 0;
     virtual void SetTextureColor(float red, float green, float blue, float alpha, void* targetTexture) = 0;
+
+	// Create or destroy many textures in one call. Entries of textureIndices that are -1 are skipped, CreateTextures sets
+	// the entries whose texture could not be created to -1. The default implementations forward to CreateTexture/DestroyTexture.
+	virtual void CreateTextures(const DGTextureDesc* descs, int* textureIndices, int count);
+	virtual void DestroyTextures(const int* textureIndices, int count);
+
+	// Create a texture array of layers single level layers, destroyed and looked up like any other texture. Called on
+	// any thread like CreateTexture. Backends without texture arrays fail.
+	virtual bool CreateTextureArray(int width, int height, int layers, int format, int textureIndex) { return false; }
+
+	// Record a run of already validated copy/clear commands in order. Create/destroy commands are handled by the caller.
+	// The default implementation forwards every command to DoCopyTexture/SetTextureColor and skips the ones addressing an
+	// array layer above 0. Rectangle clears only go through when the rectangle covers the whole texture.
+	virtual void SubmitCommands(const DGCommand* commands, int count);
+
+	// Scale a rectangle of source into a rectangle of destination with DGFilter filtering, both already validated.
+	// The default implementation only handles rectangles of the same size, through DoCopyTexture.
+	virtual void BlitTexture(void* sourceTexture, int sourceX, int sourceY, int sourceWidth, int sourceHeight, void* destinationTexture, int destinationX, int destinationY, int destinationWidth, int destinationHeight, int filter);
+
+	// DGConvertOption flags the backend applies in kDGCommandConvert, convert commands asking for others are rejected.
+	// Converts without options are blits of the same size, which is all the default implementation handles.
+	virtual int GetSupportedConvertOptions() { return 0; }
+
+	// Whether the backend encodes kDGCommandCompress on the GPU, compress commands are rejected otherwise.
+	virtual bool SupportsCompressTexture() { return false; }
+
+	// Whether the backend fills textures with GenerateTexture on the GPU, generate commands are rejected otherwise.
+	virtual bool SupportsGenerateTexture() { return false; }
+
+	// Fill a rectangle of an array layer of a texture with the procedural pattern of params, already validated. Called on
+	// the render thread for kDGCommandGenerate.
+	virtual void GenerateTexture(void* texture, int layer, const DGGenerateParams& params) { }
+
+	// Rebuild mip levels 1 and up of a texture from its top level, called on the render thread. Copies and clears only
+	// touch the top level. Backends without mip support ignore it.
+	virtual void GenerateMips(void* texture) { }
+
+	// Size of the top mip level of a native texture. Returns false when the backend cannot tell, the default implementation always does.
+	virtual bool GetTextureSize(void* texture, int* outWidth, int* outHeight) { return false; }
+
+	// Asynchronous readback, called on the render thread. RecordReadback copies the rectangle into CPU visible memory,
+	// PollReadback returns the size in bytes and the data once the GPU finished (0 while pending, -1 on failure) and
+	// ReleaseReadback frees the memory of a recorded readback. Backends without readback support fail every request.
+	virtual bool RecordReadback(int ticket, void* texture, int x, int y, int width, int height) { return false; }
+	virtual int PollReadback(int ticket, const void** outData) { return -1; }
+	virtual void ReleaseReadback(int ticket) { }
+
+	// Copy CPU pixel data into a rectangle of an array layer of the texture, layer is 0 for textures that are no array.
+	// Rows of data are dataRowPitch bytes apart. Called on the render thread for kDGCommandUpload.
+	// The default implementation goes through BeginModifyTexture/EndModifyTexture and only supports whole textures.
+	virtual bool UploadTexture(void* texture, int layer, int x, int y, int width, int height, const void* data, int dataRowPitch);
+
+	// Encode RGBA32 pixels on the CPU into a rectangle of a BC1, BC3 or BC7 texture with the encoders of BlockCompression.h,
+	// x and y already validated to be multiples of 4. quality is a DGCompressQuality. Called on the render thread for kDGCommandUploadCompressed.
+	// The default implementation encodes into a temporary buffer and passes it on to UploadTexture.
+	virtual bool UploadCompressedTexture(void* texture, int layer, int x, int y, int width, int height, const void* rgba, int rgbaRowPitch, int quality);
+
+	// BCFormat of a texture, -1 for any other format or when the backend cannot tell, which the default always does.
+	virtual int GetTextureBCFormat(void* texture) { return -1; }
+
+	// Size in bytes of one block of the texture format and the block dimensions, 1x1 for uncompressed formats. Returns false
+	// when the backend cannot tell, the default implementation only knows the formats GetTextureBCFormat reports.
+	virtual bool GetTextureBlockInfo(void* texture, int* outBlockBytes, int* outBlockWidth, int* outBlockHeight);
+
+	// Destroyed textures are kept for reuse by a later CreateTexture with the same size and format, up to the pool capacity.
+	// TrimTexturePool frees pooled textures until at most maxPooled remain. Backends without a pool ignore both.
+	virtual void SetTexturePoolCapacity(int capacity) { }
+	virtual void TrimTexturePool(int maxPooled) { }
+
+	// Called on the render thread by every kDGRenderEventFlushCommands, at least once a frame. Destroyed textures and other
+	// resources are released here once the GPU has finished every frame that used them.
+	virtual void CollectGarbage() { }
 };
 
 
+// Number of destroyed textures a backend keeps for reuse until SetTexturePoolCapacity says otherwise.
+const int kDefaultTexturePoolCapacity = 64;
+
+// Number of mip levels of a full chain from width x height down to 1x1.
+inline int FullMipCount(int width, int height)
+{
+	int size = width > height ? width : height;
+	int count = 1;
+	while (size > 1)
+	{
+		size >>= 1;
+		++count;
+	}
+	return count;
+}
+
+// Whether command clears a rectangle of the same layer to the same color as previous. Backends clear such runs of
+// kDGCommandClearRect with one call.
+inline bool ContinuesClearRects(const DGCommand& previous, const DGCommand& command)
+{
+	return previous.type == kDGCommandClearRect && command.type == kDGCommandClearRect &&
+		previous.destination == command.destination && previous.destinationLayer == command.destinationLayer &&
+		previous.color[0] == command.color[0] && previous.color[1] == command.color[1] &&
+		previous.color[2] == command.color[2] && previous.color[3] == command.color[3];
+}
+
+// Texture indices passed to CreateTexture, DestroyTexture and GetTexturePointer are below 1 << kTextureIndexBits.
+// They are the low bits of the texture handles handed out by RenderingPlugin.cpp.
+const int kTextureIndexBits = 20;
+
+// Texture index to backend record map that any thread can read and write. Chunks are created on first use and never
+// move, so every index below 1 << kTextureIndexBits has a place without locking.
+template<typename T>
+class TextureIndexMap
+{
+public:
+	static const int kChunkBits = 12;
+	static const int kChunkCount = (1 << kTextureIndexBits) >> kChunkBits;
+
+	explicit TextureIndexMap(T empty) : m_Empty(empty)
+	{
+		for (int i = 0; i < kChunkCount; ++i)
+			m_Chunks[i].store(NULL, std::memory_order_relaxed);
+	}
+	~TextureIndexMap() { Clear(); }
+
+	T Get(int index) const
+	{
+		const Chunk* chunk = m_Chunks[index >> kChunkBits].load(std::memory_order_acquire);
+		return chunk != NULL ? chunk->values[index & ((1 << kChunkBits) - 1)].load(std::memory_order_acquire) : m_Empty;
+	}
+
+	void Set(int index, T value)
+	{
+		ChunkFor(index)->values[index & ((1 << kChunkBits) - 1)].store(value, std::memory_order_release);
+	}
+
+	// Replaces the value and returns the previous one, only one of several threads exchanging the same index gets it
+	T Exchange(int index, T value)
+	{
+		Chunk* chunk = m_Chunks[index >> kChunkBits].load(std::memory_order_acquire);
+		return chunk != NULL ? chunk->values[index & ((1 << kChunkBits) - 1)].exchange(value, std::memory_order_acq_rel) : m_Empty;
+	}
+
+	// Not thread safe, only call when no other thread uses the map
+	void Clear()
+	{
+		for (int i = 0; i < kChunkCount; ++i)
+		{
+			delete m_Chunks[i].load(std::memory_order_relaxed);
+			m_Chunks[i].store(NULL, std::memory_order_relaxed);
+		}
+	}
+
+private:
+	struct Chunk
+	{
+		std::atomic<T> values[1 << kChunkBits];
+	};
+
+	Chunk* ChunkFor(int index)
+	{
+		std::atomic<Chunk*>& slot = m_Chunks[index >> kChunkBits];
+		Chunk* chunk = slot.load(std::memory_order_acquire);
+		if (chunk != NULL)
+			return chunk;
+
+		// Two threads may race to create the chunk, the loser deletes its copy
+		Chunk* created = new Chunk();
+		for (int i = 0; i < (1 << kChunkBits); ++i)
+			created->values[i].store(m_Empty, std::memory_order_relaxed);
+		if (slot.compare_exchange_strong(chunk, created, std::memory_order_acq_rel, std::memory_order_acquire))
+			return created;
+		delete created;
+		return chunk;
+	}
+
+	std::atomic<Chunk*> m_Chunks[kChunkCount];
+	T m_Empty;
+};
+
 // Create a graphics API implementation instance for the given API type.
 RenderAPI* CreateRenderAPI(UnityGfxRenderer apiType);
 
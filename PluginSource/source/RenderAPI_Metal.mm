@@ -1,5 +1,6 @@
 
 #include "RenderAPI.h"
+#include "BlockCompression.h"
 #include "PlatformBase.h"
 
 
@@ -10,6 +11,8 @@
 
 #include "Unity/IUnityGraphicsMetal.h"
 #import <Metal/Metal.h>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 
@@ -27,13 +30,36 @@ public:
 	virtual void EndModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr);
 
     virtual void DoCopyTexture(void *sourceTexture, int sourceX, int sourceY, int sourceWidth, int sourceHeight, void *destinationTexture, int destinationX, int destinationY);
-    virtual bool CreateTexture(int width, int height, int format, int textureIndex);
+    virtual bool CreateTexture(int width, int height, int format, int mipCount, int textureIndex);
     virtual void DestroyTexture(int textureIndex);
     virtual void* GetTexturePointer(int textureIndex);
+    virtual void DestroyTextures(const int* textureIndices, int count);
+    virtual bool CreateTextureArray(int width, int height, int layers, int format, int textureIndex);
     virtual void SetTextureColor(float red, float green, float blue, float alpha, void* targetTexture);
+    virtual void SubmitCommands(const DGCommand* commands, int count);
+    virtual void GenerateMips(void* texture);
+    virtual void BlitTexture(void* sourceTexture, int sourceX, int sourceY, int sourceWidth, int sourceHeight, void* destinationTexture, int destinationX, int destinationY, int destinationWidth, int destinationHeight, int filter);
+    virtual int GetSupportedConvertOptions();
+    virtual bool SupportsCompressTexture();
+    virtual bool SupportsGenerateTexture() { return true; }
+    virtual void GenerateTexture(void* texture, int layer, const DGGenerateParams& params);
+    virtual bool GetTextureSize(void* texture, int* outWidth, int* outHeight);
+    virtual bool UploadTexture(void* texture, int layer, int x, int y, int width, int height, const void* data, int dataRowPitch);
+    virtual int GetTextureBCFormat(void* texture);
+    virtual bool GetTextureBlockInfo(void* texture, int* outBlockBytes, int* outBlockWidth, int* outBlockHeight);
+    virtual void SetTexturePoolCapacity(int capacity);
+    virtual void TrimTexturePool(int maxPooled);
+    virtual void CollectGarbage();
 
 private:
 	void CreateResources();
+	bool CreatePluginTexture(MTLTextureType textureType, int width, int height, int pixelFormat, int mipCount, int layers, int textureIndex);
+	void EncodeBlit(id<MTLCommandBuffer> commandBuffer, const DGCommand& command);
+	id<MTLRenderPipelineState> GetBlitPipeline(MTLPixelFormat pixelFormat, int fragment);
+	void EncodeCompress(id<MTLCommandBuffer> commandBuffer, const DGCommand& command);
+	bool ClearsByBlit(id<MTLTexture> texture);
+	void EncodeBlitClear(id<MTLBlitCommandEncoder> blitCommand, id<MTLTexture> texture, int layer, const float* color, const DGRect* rects, int count);
+	void EncodeClearRects(id<MTLCommandBuffer> commandBuffer, id<MTLTexture> texture, int layer, const float* color, const DGRect* rects, int count);
 
 private:
 	IUnityGraphicsMetal*	m_MetalGraphics;
@@ -42,9 +68,31 @@ private:
 
 	id<MTLDepthStencilState> m_DepthStencil;
 	id<MTLRenderPipelineState>	m_Pipeline;
+
+    // Scaling blits, converts and rectangle clears draw a triangle covering the destination rectangle, one pipeline per
+    // destination pixel format and BlitFragment
+    id<MTLLibrary> m_ShaderLibrary;
+    id<MTLSamplerState> m_BlitSamplers[2];  // indexed by DGFilter
+    std::unordered_map<int, id<MTLRenderPipelineState>> m_BlitPipelines;
+
+    // Rectangles of the run of kDGCommandClearRect being encoded, render thread only
+    std::vector<DGRect> m_ClearRects;
+
+    // BC1, BC3 and BC7 encoders, one compute thread per block, created on first use
+    id<MTLComputePipelineState> m_CompressPipelines[3];
     
-    std::vector<void*> m_Textures;
-    int m_UsedTextureCount;
+    // Texture of every index, created, destroyed and looked up from any thread
+    TextureIndexMap<void*> m_Textures;
+
+    // Destroyed textures waiting to be handed out again by CreateTexture, oldest first
+    std::mutex m_TexturePoolMutex;      // guards m_TexturePool, m_TexturePoolCapacity and m_DestroyedTextures
+    std::vector<void*> m_TexturePool;
+    int m_TexturePoolCapacity;
+
+    // Textures destroyed since the last flush event and, render thread only, those destroyed before it. Command buffers
+    // retain the textures they use, but commands still queued for the render thread only hold the raw pointer.
+    std::vector<void*> m_DestroyedTextures;
+    std::vector<void*> m_RetiringTextures;
     
     id<MTLCommandQueue> m_CommandQueue;
 };
@@ -61,7 +109,16 @@ static Class MTLRenderPipelineDescriptorClass;
 static Class MTLDepthStencilDescriptorClass;
 const int kVertexSize = 12 + 4;
 
-// Simple vertex & fragment shader source
+// Simple vertex & fragment shader source, followed by the shaders of scaling blits
+// Fragment functions of the pipelines returned by GetBlitPipeline
+enum BlitFragment
+{
+    kBlitFragmentCopy = 0,      // blitFragment
+    kBlitFragmentConvert = 1,   // convertFragment
+    kBlitFragmentClear = 2,     // clearFragment
+    kBlitFragmentGenerate = 3,  // generateFragment
+};
+
 static const char kShaderSource[] =
 "#include <metal_stdlib>\n"
 "using namespace metal;\n"
@@ -92,6 +149,403 @@ static const char kShaderSource[] =
 "{\n"
 "    FSOutput out = { input.color };\n"
 "    return out;\n"
+"}\n"
+"struct BlitVSOutput\n"
+"{\n"
+"    float4 pos [[position]];\n"
+"    float2 uv;\n"
+"};\n"
+"vertex BlitVSOutput blitVertex(uint id [[vertex_id]], constant float4& sourceRect [[buffer(0)]])\n"
+"{\n"
+"    float2 corner = float2((id << 1) & 2, id & 2);\n"
+"    BlitVSOutput out = { float4(corner * float2(2, -2) + float2(-1, 1), 0, 1), sourceRect.xy + corner * sourceRect.zw };\n"
+"    return out;\n"
+"}\n"
+"fragment float4 blitFragment(BlitVSOutput input [[stage_in]], texture2d<float> source [[texture(0)]], sampler sourceSampler [[sampler(0)]])\n"
+"{\n"
+"    return source.sample(sourceSampler, input.uv, level(0));\n"
+"}\n"
+"struct ConvertOptions\n"
+"{\n"
+"    uint flags;\n"
+"    uint swizzle;\n"
+"};\n"
+"fragment float4 convertFragment(BlitVSOutput input [[stage_in]], texture2d<float> source [[texture(0)]], sampler sourceSampler [[sampler(0)]], constant ConvertOptions& options [[buffer(0)]])\n"
+"{\n"
+"    float4 color = source.sample(sourceSampler, input.uv, level(0));\n"
+"    if (options.flags & 1)\n"
+"    {\n"
+"        float channels[6] = { color.r, color.g, color.b, color.a, 0, 1 };\n"
+"        color = float4(channels[options.swizzle & 15], channels[(options.swizzle >> 4) & 15], channels[(options.swizzle >> 8) & 15], channels[(options.swizzle >> 12) & 15]);\n"
+"    }\n"
+"    if (options.flags & 2)\n"
+"        color.rgb = select(pow((max(color.rgb, 0.0) + 0.055) / 1.055, 2.4), color.rgb / 12.92, color.rgb <= 0.04045);\n"
+"    if (options.flags & 4)\n"
+"        color.rgb *= color.a;\n"
+"    if (options.flags & 8)\n"
+"        color.rgb = select(1.055 * pow(max(color.rgb, 0.0), 1.0 / 2.4) - 0.055, color.rgb * 12.92, color.rgb <= 0.0031308);\n"
+"    return color;\n"
+"}\n"
+"fragment float4 clearFragment(BlitVSOutput input [[stage_in]], constant float4& color [[buffer(0)]])\n"
+"{\n"
+"    return color;\n"
+"}\n"
+"struct GenerateParams\n"
+"{\n"
+"    float4 colorA;\n"
+"    float4 colorB;\n"
+"    float4 points;\n"
+"    float cellSize;\n"
+"    float lacunarity;\n"
+"    float gain;\n"
+"    uint generator;\n"
+"    uint octaves;\n"
+"    uint seed;\n"
+"};\n"
+"uint hashCell(int2 cell, uint seed)\n"
+"{\n"
+"    uint h = uint(cell.x) * 0x8da6b343u ^ uint(cell.y) * 0xd8163841u ^ seed * 0xcb1ab31fu;\n"
+"    h ^= h >> 16;\n"
+"    h *= 0x7feb352du;\n"
+"    h ^= h >> 15;\n"
+"    h *= 0x846ca68bu;\n"
+"    h ^= h >> 16;\n"
+"    return h;\n"
+"}\n"
+"float randomCell(int2 cell, uint seed)\n"
+"{\n"
+"    return float(hashCell(cell, seed) >> 8) * (1.0 / 16777216.0);\n"
+"}\n"
+"float2 gradientCell(int2 cell, uint seed)\n"
+"{\n"
+"    float angle = randomCell(cell, seed) * 6.2831853;\n"
+"    return float2(cos(angle), sin(angle));\n"
+"}\n"
+"float2 fade(float2 t)\n"
+"{\n"
+"    return t * t * t * (t * (t * 6.0 - 15.0) + 10.0);\n"
+"}\n"
+"float valueNoise(float2 p, uint seed)\n"
+"{\n"
+"    int2 cell = int2(floor(p));\n"
+"    float2 u = fade(p - floor(p));\n"
+"    return mix(mix(randomCell(cell, seed), randomCell(cell + int2(1, 0), seed), u.x), mix(randomCell(cell + int2(0, 1), seed), randomCell(cell + int2(1, 1), seed), u.x), u.y);\n"
+"}\n"
+"float perlinNoise(float2 p, uint seed)\n"
+"{\n"
+"    int2 cell = int2(floor(p));\n"
+"    float2 f = p - floor(p);\n"
+"    float2 u = fade(f);\n"
+"    float n00 = dot(gradientCell(cell, seed), f);\n"
+"    float n10 = dot(gradientCell(cell + int2(1, 0), seed), f - float2(1, 0));\n"
+"    float n01 = dot(gradientCell(cell + int2(0, 1), seed), f - float2(0, 1));\n"
+"    float n11 = dot(gradientCell(cell + int2(1, 1), seed), f - float2(1, 1));\n"
+"    return mix(mix(n00, n10, u.x), mix(n01, n11, u.x), u.y) * 0.7071068 + 0.5;\n"
+"}\n"
+"float simplexNoise(float2 p, uint seed)\n"
+"{\n"
+"    const float F2 = 0.3660254;\n"
+"    const float G2 = 0.2113249;\n"
+"    float2 s = floor(p + (p.x + p.y) * F2);\n"
+"    float2 x0 = p - s + (s.x + s.y) * G2;\n"
+"    float2 o = x0.x > x0.y ? float2(1, 0) : float2(0, 1);\n"
+"    float2 x1 = x0 - o + G2;\n"
+"    float2 x2 = x0 - 1.0 + 2.0 * G2;\n"
+"    int2 cell = int2(s);\n"
+"    float3 t = max(0.5 - float3(dot(x0, x0), dot(x1, x1), dot(x2, x2)), 0.0);\n"
+"    t *= t;\n"
+"    t *= t;\n"
+"    float3 n = t * float3(dot(gradientCell(cell, seed), x0), dot(gradientCell(cell + int2(o), seed), x1), dot(gradientCell(cell + 1, seed), x2));\n"
+"    return (n.x + n.y + n.z) * 49.0 + 0.5;\n"
+"}\n"
+"float voronoi(float2 p, uint seed)\n"
+"{\n"
+"    int2 cell = int2(floor(p));\n"
+"    float nearest = 2.0;\n"
+"    for (int y = -1; y <= 1; y++)\n"
+"    {\n"
+"        for (int x = -1; x <= 1; x++)\n"
+"        {\n"
+"            int2 neighbour = cell + int2(x, y);\n"
+"            float2 feature = float2(neighbour) + float2(randomCell(neighbour, seed), randomCell(neighbour, seed ^ 0x9e3779b9u));\n"
+"            nearest = min(nearest, distance(p, feature));\n"
+"        }\n"
+"    }\n"
+"    return nearest;\n"
+"}\n"
+"float fractalNoise(float2 p, constant GenerateParams& params)\n"
+"{\n"
+"    float sum = 0.0;\n"
+"    float total = 0.0;\n"
+"    float amplitude = 1.0;\n"
+"    for (uint i = 0; i < params.octaves; i++)\n"
+"    {\n"
+"        uint seed = params.seed + i * 0x632be5abu;\n"
+"        float n = params.generator == 0 ? valueNoise(p, seed) : params.generator == 1 ? perlinNoise(p, seed) : simplexNoise(p, seed);\n"
+"        sum += n * amplitude;\n"
+"        total += amplitude;\n"
+"        p *= params.lacunarity;\n"
+"        amplitude *= params.gain;\n"
+"    }\n"
+"    return total > 0.0 ? sum / total : 0.0;\n"
+"}\n"
+"fragment float4 generateFragment(BlitVSOutput input [[stage_in]], constant GenerateParams& params [[buffer(0)]])\n"
+"{\n"
+"    float2 pixel = input.pos.xy;\n"
+"    float2 p = (pixel + params.points.xy) / params.cellSize;\n"
+"    float value;\n"
+"    if (params.generator <= 2)\n"
+"        value = fractalNoise(p, params);\n"
+"    else if (params.generator == 3)\n"
+"    {\n"
+"        float2 axis = params.points.zw - params.points.xy;\n"
+"        value = dot(pixel - params.points.xy, axis) / max(dot(axis, axis), 1e-6);\n"
+"    }\n"
+"    else if (params.generator == 4)\n"
+"        value = distance(pixel, params.points.xy) / max(distance(params.points.zw, params.points.xy), 1e-6);\n"
+"    else if (params.generator == 5)\n"
+"    {\n"
+"        int2 cell = int2(floor(p));\n"
+"        value = float((cell.x + cell.y) & 1);\n"
+"    }\n"
+"    else\n"
+"        value = voronoi(p, params.seed);\n"
+"    return mix(params.colorA, params.colorB, saturate(value));\n"
+"}\n"
+"constant uint kBC7Weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };\n"
+"struct CompressParams\n"
+"{\n"
+"    uint4 rect;\n"
+"    uint blocksWide;\n"
+"    uint blocksHigh;\n"
+"    uint quality;\n"
+"};\n"
+"void loadBlock(texture2d<float> source, constant CompressParams& params, uint2 block, thread float4* pixels)\n"
+"{\n"
+"    uint2 last = params.rect.xy + params.rect.zw - 1;\n"
+"    for (uint i = 0; i < 16; i++)\n"
+"        pixels[i] = source.read(min(params.rect.xy + block * 4 + uint2(i & 3, i >> 2), last)) * 255.0;\n"
+"}\n"
+"void findEndpoints(thread const float4* pixels, uint quality, float4 channels, thread float4& low, thread float4& high)\n"
+"{\n"
+"    float4 minColor = pixels[0];\n"
+"    float4 maxColor = pixels[0];\n"
+"    float4 mean = float4(0.0);\n"
+"    for (uint i = 0; i < 16; i++)\n"
+"    {\n"
+"        minColor = min(minColor, pixels[i]);\n"
+"        maxColor = max(maxColor, pixels[i]);\n"
+"        mean += pixels[i];\n"
+"    }\n"
+"    low = minColor;\n"
+"    high = maxColor;\n"
+"    if (quality == 0)\n"
+"        return;\n"
+"    mean /= 16.0;\n"
+"    float4x4 covariance = float4x4(float4(0.0), float4(0.0), float4(0.0), float4(0.0));\n"
+"    for (uint i = 0; i < 16; i++)\n"
+"    {\n"
+"        float4 d = (pixels[i] - mean) * channels;\n"
+"        covariance += float4x4(d * d.x, d * d.y, d * d.z, d * d.w);\n"
+"    }\n"
+"    float4 axis = (maxColor - minColor) * channels;\n"
+"    for (uint i = 0; i < 8; i++)\n"
+"    {\n"
+"        axis = covariance * axis;\n"
+"        axis /= max(max(max(abs(axis.x), abs(axis.y)), max(abs(axis.z), abs(axis.w))), 1e-6);\n"
+"    }\n"
+"    if (dot(axis, axis) < 1e-6)\n"
+"        return;\n"
+"    axis = normalize(axis);\n"
+"    float minT = 0.0;\n"
+"    float maxT = 0.0;\n"
+"    for (uint i = 0; i < 16; i++)\n"
+"    {\n"
+"        float t = dot((pixels[i] - mean) * channels, axis);\n"
+"        minT = min(minT, t);\n"
+"        maxT = max(maxT, t);\n"
+"    }\n"
+"    low = mix(low, clamp(mean + axis * minT, 0.0, 255.0), channels);\n"
+"    high = mix(high, clamp(mean + axis * maxT, 0.0, 255.0), channels);\n"
+"}\n"
+"uint packRGB565(float3 color)\n"
+"{\n"
+"    uint3 c = uint3(round(clamp(color, 0.0, 255.0) * float3(31.0, 63.0, 31.0) / 255.0));\n"
+"    return (c.x << 11) | (c.y << 5) | c.z;\n"
+"}\n"
+"float3 unpackRGB565(uint color)\n"
+"{\n"
+"    return float3(float((color >> 11) & 31), float((color >> 5) & 63), float(color & 31)) * 255.0 / float3(31.0, 63.0, 31.0);\n"
+"}\n"
+"uint2 encodeColorBlock(thread const float4* pixels, uint quality)\n"
+"{\n"
+"    float4 low;\n"
+"    float4 high;\n"
+"    findEndpoints(pixels, quality, float4(1.0, 1.0, 1.0, 0.0), low, high);\n"
+"    uint color0 = packRGB565(high.rgb);\n"
+"    uint color1 = packRGB565(low.rgb);\n"
+"    if (color0 < color1)\n"
+"    {\n"
+"        uint swapped = color0;\n"
+"        color0 = color1;\n"
+"        color1 = swapped;\n"
+"    }\n"
+"    if (color0 == color1)\n"
+"        return uint2(color0 | (color1 << 16), 0);\n"
+"    float3 end0 = unpackRGB565(color0);\n"
+"    float3 end1 = unpackRGB565(color1);\n"
+"    float3 palette[4] = { end0, end1, (2.0 * end0 + end1) / 3.0, (end0 + 2.0 * end1) / 3.0 };\n"
+"    uint indices = 0;\n"
+"    for (uint i = 0; i < 16; i++)\n"
+"    {\n"
+"        uint best = 0;\n"
+"        float bestDistance = 1e30;\n"
+"        for (uint j = 0; j < 4; j++)\n"
+"        {\n"
+"            float3 d = pixels[i].rgb - palette[j];\n"
+"            if (dot(d, d) < bestDistance)\n"
+"            {\n"
+"                best = j;\n"
+"                bestDistance = dot(d, d);\n"
+"            }\n"
+"        }\n"
+"        indices |= best << (i * 2);\n"
+"    }\n"
+"    return uint2(color0 | (color1 << 16), indices);\n"
+"}\n"
+"uint2 encodeAlphaBlock(thread const float4* pixels)\n"
+"{\n"
+"    float low = 255.0;\n"
+"    float high = 0.0;\n"
+"    for (uint i = 0; i < 16; i++)\n"
+"    {\n"
+"        low = min(low, pixels[i].a);\n"
+"        high = max(high, pixels[i].a);\n"
+"    }\n"
+"    uint alpha0 = uint(round(high));\n"
+"    uint alpha1 = uint(round(low));\n"
+"    uint2 block = uint2(alpha0 | (alpha1 << 8), 0);\n"
+"    if (alpha0 == alpha1)\n"
+"        return block;\n"
+"    for (uint i = 0; i < 16; i++)\n"
+"    {\n"
+"        uint level = uint(clamp(round((pixels[i].a - float(alpha1)) / float(alpha0 - alpha1) * 7.0), 0.0, 7.0));\n"
+"        uint index = level == 7 ? 0 : (level == 0 ? 1 : 8 - level);\n"
+"        uint bit = 16 + i * 3;\n"
+"        if (bit >= 32)\n"
+"            block.y |= index << (bit - 32);\n"
+"        else\n"
+"        {\n"
+"            block.x |= index << bit;\n"
+"            if (bit > 29)\n"
+"                block.y |= index >> (32 - bit);\n"
+"        }\n"
+"    }\n"
+"    return block;\n"
+"}\n"
+"void writeBits(thread uint4& block, thread uint& position, uint value, uint count)\n"
+"{\n"
+"    uint word = position >> 5;\n"
+"    uint bit = position & 31;\n"
+"    block[word] |= value << bit;\n"
+"    if (bit + count > 32)\n"
+"        block[word + 1] |= value >> (32 - bit);\n"
+"    position += count;\n"
+"}\n"
+"uint4 encodeBC7Mode6(thread const float4* pixels, uint quality)\n"
+"{\n"
+"    float4 ends[2];\n"
+"    findEndpoints(pixels, quality, float4(1.0), ends[0], ends[1]);\n"
+"    uint4 quantized[2];\n"
+"    uint pbits[2];\n"
+"    for (uint e = 0; e < 2; e++)\n"
+"    {\n"
+"        float bestError = 1e30;\n"
+"        for (uint pbit = 0; pbit < 2; pbit++)\n"
+"        {\n"
+"            uint4 q = uint4(clamp(round((ends[e] - float(pbit)) / 2.0), 0.0, 127.0));\n"
+"            float4 d = float4((q << 1) | pbit) - ends[e];\n"
+"            if (dot(d, d) < bestError)\n"
+"            {\n"
+"                bestError = dot(d, d);\n"
+"                quantized[e] = q;\n"
+"                pbits[e] = pbit;\n"
+"            }\n"
+"        }\n"
+"    }\n"
+"    float4 end0 = float4((quantized[0] << 1) | pbits[0]);\n"
+"    float4 end1 = float4((quantized[1] << 1) | pbits[1]);\n"
+"    float4 axis = end1 - end0;\n"
+"    float axisLength = max(dot(axis, axis), 1e-6);\n"
+"    uint indices[16];\n"
+"    for (uint i = 0; i < 16; i++)\n"
+"    {\n"
+"        float t = clamp(dot(pixels[i] - end0, axis) / axisLength, 0.0, 1.0) * 64.0;\n"
+"        uint best = 0;\n"
+"        float bestError = 1e30;\n"
+"        for (uint j = 0; j < 16; j++)\n"
+"        {\n"
+"            float error;\n"
+"            if (quality == 0)\n"
+"                error = abs(t - float(kBC7Weights[j]));\n"
+"            else\n"
+"            {\n"
+"                float4 d = floor((end0 * float(64 - kBC7Weights[j]) + end1 * float(kBC7Weights[j]) + 32.0) / 64.0) - pixels[i];\n"
+"                error = dot(d, d);\n"
+"            }\n"
+"            if (error < bestError)\n"
+"            {\n"
+"                best = j;\n"
+"                bestError = error;\n"
+"            }\n"
+"        }\n"
+"        indices[i] = best;\n"
+"    }\n"
+"    uint first = 0;\n"
+"    if (indices[0] >= 8)\n"
+"    {\n"
+"        first = 1;\n"
+"        for (uint i = 0; i < 16; i++)\n"
+"            indices[i] = 15 - indices[i];\n"
+"    }\n"
+"    uint4 block = uint4(0);\n"
+"    uint position = 0;\n"
+"    writeBits(block, position, 1 << 6, 7);\n"
+"    for (uint c = 0; c < 4; c++)\n"
+"    {\n"
+"        writeBits(block, position, quantized[first][c], 7);\n"
+"        writeBits(block, position, quantized[1 - first][c], 7);\n"
+"    }\n"
+"    writeBits(block, position, pbits[first], 1);\n"
+"    writeBits(block, position, pbits[1 - first], 1);\n"
+"    writeBits(block, position, indices[0], 3);\n"
+"    for (uint i = 1; i < 16; i++)\n"
+"        writeBits(block, position, indices[i], 4);\n"
+"    return block;\n"
+"}\n"
+"kernel void compressBC1(texture2d<float> source [[texture(0)]], device uint2* blocks [[buffer(0)]], constant CompressParams& params [[buffer(1)]], uint2 block [[thread_position_in_grid]])\n"
+"{\n"
+"    if (block.x >= params.blocksWide || block.y >= params.blocksHigh)\n"
+"        return;\n"
+"    float4 pixels[16];\n"
+"    loadBlock(source, params, block, pixels);\n"
+"    blocks[block.y * params.blocksWide + block.x] = encodeColorBlock(pixels, params.quality);\n"
+"}\n"
+"kernel void compressBC3(texture2d<float> source [[texture(0)]], device uint4* blocks [[buffer(0)]], constant CompressParams& params [[buffer(1)]], uint2 block [[thread_position_in_grid]])\n"
+"{\n"
+"    if (block.x >= params.blocksWide || block.y >= params.blocksHigh)\n"
+"        return;\n"
+"    float4 pixels[16];\n"
+"    loadBlock(source, params, block, pixels);\n"
+"    blocks[block.y * params.blocksWide + block.x] = uint4(encodeAlphaBlock(pixels), encodeColorBlock(pixels, params.quality));\n"
+"}\n"
+"kernel void compressBC7(texture2d<float> source [[texture(0)]], device uint4* blocks [[buffer(0)]], constant CompressParams& params [[buffer(1)]], uint2 block [[thread_position_in_grid]])\n"
+"{\n"
+"    if (block.x >= params.blocksWide || block.y >= params.blocksHigh)\n"
+"        return;\n"
+"    float4 pixels[16];\n"
+"    loadBlock(source, params, block, pixels);\n"
+"    blocks[block.y * params.blocksWide + block.x] = encodeBC7Mode6(pixels, params.quality);\n"
 "}\n";
 
 
@@ -111,6 +565,11 @@ void RenderAPI_Metal::CreateResources()
 		::fprintf(stderr, "%s\n%s\n\n", desc ? [desc UTF8String] : "<unknown>", reason ? [reason UTF8String] : "");
 	}
 
+	m_ShaderLibrary = shaderLibrary;
+	m_BlitPipelines.clear();
+	for (int i = 0; i < 3; i++)
+		m_CompressPipelines[i] = nil;
+
 	id<MTLFunction> vertexFunction = [shaderLibrary newFunctionWithName:@"vertexMain"];
 	id<MTLFunction> fragmentFunction = [shaderLibrary newFunctionWithName:@"fragmentMain"];
 
@@ -168,12 +627,25 @@ void RenderAPI_Metal::CreateResources()
 	depthDesc.depthCompareFunction = GetUsesReverseZ() ? MTLCompareFunctionGreaterEqual : MTLCompareFunctionLessEqual;
 	depthDesc.depthWriteEnabled = false;
 	m_DepthStencil = [metalDevice newDepthStencilStateWithDescriptor:depthDesc];
+
+	// Blit samplers
+	MTLSamplerDescriptor* samplerDesc = [[MTLSamplerDescriptor alloc] init];
+	samplerDesc.sAddressMode = MTLSamplerAddressModeClampToEdge;
+	samplerDesc.tAddressMode = MTLSamplerAddressModeClampToEdge;
+	samplerDesc.minFilter = MTLSamplerMinMagFilterNearest;
+	samplerDesc.magFilter = MTLSamplerMinMagFilterNearest;
+	m_BlitSamplers[kDGFilterNearest] = [metalDevice newSamplerStateWithDescriptor:samplerDesc];
+	samplerDesc.minFilter = MTLSamplerMinMagFilterLinear;
+	samplerDesc.magFilter = MTLSamplerMinMagFilterLinear;
+	m_BlitSamplers[kDGFilterLinear] = [metalDevice newSamplerStateWithDescriptor:samplerDesc];
     
-    m_UsedTextureCount = 0;
+    m_Textures.Clear();
 }
 
 
 RenderAPI_Metal::RenderAPI_Metal()
+    : m_Textures(nullptr)
+    , m_TexturePoolCapacity(kDefaultTexturePoolCapacity)
 {
 }
 
@@ -194,6 +666,12 @@ void RenderAPI_Metal::ProcessDeviceEvent(UnityGfxDeviceEventType type, IUnityInt
 	else if (type == kUnityGfxDeviceEventShutdown)
 	{
 		//@TODO: release resources
+		m_RetiringTextures.insert(m_RetiringTextures.end(), m_DestroyedTextures.begin(), m_DestroyedTextures.end());
+		m_DestroyedTextures.clear();
+		for (size_t i = 0; i < m_RetiringTextures.size(); ++i)
+			CFBridgingRelease(m_RetiringTextures[i]);
+		m_RetiringTextures.clear();
+		TrimTexturePool(0);
 	}
 }
 
@@ -233,45 +711,138 @@ void RenderAPI_Metal::DoCopyTexture(void *sourceTexture, int sourceX, int source
     //[commandBuffer commit];
 }
 
-bool RenderAPI_Metal::CreateTexture(int width, int height, int pixelFormat, int textureIndex)
+bool RenderAPI_Metal::CreateTexture(int width, int height, int pixelFormat, int mipCount, int textureIndex)
 {
-    
-    MTLTextureDescriptor *textureDescriptor = [[MTLTextureDescriptor alloc] init];
+    return CreatePluginTexture(MTLTextureType2D, width, height, pixelFormat, mipCount, 1, textureIndex);
+}
 
-    textureDescriptor.pixelFormat = pixelFormat;
-    textureDescriptor.width = (unsigned int)width;
-    textureDescriptor.height = (unsigned int)height;
-    
-    id<MTLTexture> t = [m_MetalGraphics->MetalDevice() newTextureWithDescriptor:textureDescriptor];
-    
-    if(textureIndex == m_UsedTextureCount)
+bool RenderAPI_Metal::CreateTextureArray(int width, int height, int layers, int pixelFormat, int textureIndex)
+{
+    return CreatePluginTexture(MTLTextureType2DArray, width, height, pixelFormat, 1, layers, textureIndex);
+}
+
+bool RenderAPI_Metal::CreatePluginTexture(MTLTextureType textureType, int width, int height, int pixelFormat, int mipCount, int layers, int textureIndex)
+{
+    // Newest first, the texture destroyed last is the most likely to match again
+    void* texture = nullptr;
     {
-        m_Textures.push_back((__bridge_retained void*)t);
-        m_UsedTextureCount++;
+        std::lock_guard<std::mutex> lock(m_TexturePoolMutex);
+        for (size_t i = m_TexturePool.size(); i-- > 0;)
+        {
+            id<MTLTexture> pooled = (__bridge id<MTLTexture>)m_TexturePool[i];
+            if (pooled.textureType == textureType && pooled.width == (NSUInteger)width && pooled.height == (NSUInteger)height && pooled.pixelFormat == (MTLPixelFormat)pixelFormat &&
+                pooled.mipmapLevelCount == (NSUInteger)mipCount && pooled.arrayLength == (NSUInteger)layers && pooled.usage == MTLTextureUsageShaderRead)
+            {
+                texture = m_TexturePool[i];
+                m_TexturePool.erase(m_TexturePool.begin() + i);
+                break;
+            }
+        }
     }
-    else
+
+    if (texture == nullptr)
     {
-        m_Textures[textureIndex] = (__bridge_retained void*)t;
+        // Job threads have no autorelease pool of their own
+        @autoreleasepool
+        {
+            MTLTextureDescriptor *textureDescriptor = [[MTLTextureDescriptor alloc] init];
+
+            textureDescriptor.textureType = textureType;
+            textureDescriptor.pixelFormat = pixelFormat;
+            textureDescriptor.width = (unsigned int)width;
+            textureDescriptor.height = (unsigned int)height;
+            textureDescriptor.mipmapLevelCount = (NSUInteger)mipCount;
+            textureDescriptor.arrayLength = (NSUInteger)layers;
+
+            id<MTLTexture> t = [m_MetalGraphics->MetalDevice() newTextureWithDescriptor:textureDescriptor];
+            if (t == nil)
+                return false;
+            texture = (__bridge_retained void*)t;
+        }
     }
     
+    m_Textures.Set(textureIndex, texture);
+    
     return true;
 }
 
 void RenderAPI_Metal::DestroyTexture(int textureIndex)
 {
-    if(m_Textures[textureIndex] == nullptr) return;
+    void* texture = m_Textures.Exchange(textureIndex, nullptr);
+    if(texture == nullptr) return;
     
-    CFBridgingRelease(m_Textures[textureIndex]);
-    m_Textures[textureIndex] = nullptr;
+    // Released or pooled by CollectGarbage once the commands queued before this call have been encoded
+    std::lock_guard<std::mutex> lock(m_TexturePoolMutex);
+    m_DestroyedTextures.push_back(texture);
+}
+
+void RenderAPI_Metal::DestroyTextures(const int* textureIndices, int count)
+{
+    std::lock_guard<std::mutex> lock(m_TexturePoolMutex);
+    for (int i = 0; i < count; ++i)
+    {
+        void* texture = textureIndices[i] >= 0 ? m_Textures.Exchange(textureIndices[i], nullptr) : nullptr;
+        if (texture != nullptr)
+            m_DestroyedTextures.push_back(texture);
+    }
+}
+
+void RenderAPI_Metal::CollectGarbage()
+{
+    std::lock_guard<std::mutex> lock(m_TexturePoolMutex);
+    for (size_t i = 0; i < m_RetiringTextures.size(); ++i)
+    {
+        if ((int)m_TexturePool.size() < m_TexturePoolCapacity)
+            m_TexturePool.push_back(m_RetiringTextures[i]);
+        else
+            CFBridgingRelease(m_RetiringTextures[i]);
+    }
+    m_RetiringTextures.clear();
+    m_RetiringTextures.swap(m_DestroyedTextures);
+}
+
+void RenderAPI_Metal::SetTexturePoolCapacity(int capacity)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_TexturePoolMutex);
+        m_TexturePoolCapacity = capacity > 0 ? capacity : 0;
+    }
+    TrimTexturePool(capacity);
+}
+
+void RenderAPI_Metal::TrimTexturePool(int maxPooled)
+{
+    std::lock_guard<std::mutex> lock(m_TexturePoolMutex);
+    const size_t keep = maxPooled > 0 ? (size_t)maxPooled : 0;
+    if (m_TexturePool.size() <= keep)
+        return;
+
+    const size_t trimmed = m_TexturePool.size() - keep;
+    for (size_t i = 0; i < trimmed; ++i)
+        CFBridgingRelease(m_TexturePool[i]);
+    m_TexturePool.erase(m_TexturePool.begin(), m_TexturePool.begin() + trimmed);
 }
 
 void* RenderAPI_Metal::GetTexturePointer(int textureIndex)
 {
-    return m_Textures[textureIndex];
+    return m_Textures.Get(textureIndex);
 }
 
 void RenderAPI_Metal::SetTextureColor(float red, float green, float blue, float alpha, void* targetTexture)
 {
+    id<MTLTexture> tex = (__bridge id<MTLTexture>)targetTexture;
+    if (ClearsByBlit(tex))
+    {
+        const float color[4] = { red, green, blue, alpha };
+        id<MTLCommandBuffer> buffer = [m_CommandQueue commandBuffer];
+        id<MTLBlitCommandEncoder> blitCommand = [buffer blitCommandEncoder];
+        const DGRect rect = { 0, 0, (int)tex.width, (int)tex.height };
+        EncodeBlitClear(blitCommand, tex, 0, color, &rect, 1);
+        [blitCommand endEncoding];
+        [buffer commit];
+        return;
+    }
+
     MTLRenderPassDescriptor *rpdesc = [MTLRenderPassDescriptor renderPassDescriptor];
     rpdesc.colorAttachments[0].clearColor = MTLClearColorMake((double)red, (double)green, (double)blue, (double)alpha);
     rpdesc.colorAttachments[0].loadAction = MTLLoadActionClear;
@@ -283,4 +854,597 @@ void RenderAPI_Metal::SetTextureColor(float red, float green, float blue, float
     [buffer commit];
 }
 
+// Whether the array layers addressed by command exist, textures that are no array only have layer 0.
+static bool HasCommandLayers(const DGCommand& command)
+{
+    if (command.source != nullptr && (NSUInteger)command.sourceLayer >= ((__bridge id<MTLTexture>)command.source).arrayLength)
+        return false;
+    return (NSUInteger)command.destinationLayer < ((__bridge id<MTLTexture>)command.destination).arrayLength;
+}
+
+// Blits that neither scale nor convert are plain copies.
+static bool IsCopyBlit(const DGCommand& command)
+{
+    id<MTLTexture> sourceTex = (__bridge id<MTLTexture>)command.source;
+    id<MTLTexture> destinationTex = (__bridge id<MTLTexture>)command.destination;
+    return command.width == command.destinationWidth && command.height == command.destinationHeight && sourceTex.pixelFormat == destinationTex.pixelFormat;
+}
+
+void RenderAPI_Metal::SubmitCommands(const DGCommand* commands, int count)
+{
+    // Record into Unity's command buffer so the commands are ordered with the rest of the frame.
+    // Consecutive copies share one blit encoder, clears need a render pass of their own.
+    m_MetalGraphics->EndCurrentCommandEncoder();
+    id<MTLCommandBuffer> commandBuffer = m_MetalGraphics->CurrentCommandBuffer();
+
+    id<MTLBlitCommandEncoder> blitCommand = nil;
+    for (int i = 0; i < count; i++)
+    {
+        const DGCommand& command = commands[i];
+        if (!HasCommandLayers(command))
+            continue;
+        if (command.type == kDGCommandCopy)
+        {
+            if (blitCommand == nil)
+                blitCommand = [commandBuffer blitCommandEncoder];
+
+            id<MTLTexture> sourceTex = (__bridge id<MTLTexture>)command.source;
+            id<MTLTexture> destinationTex = (__bridge id<MTLTexture>)command.destination;
+            [blitCommand copyFromTexture:sourceTex sourceSlice:command.sourceLayer sourceLevel:0 sourceOrigin:MTLOriginMake(command.sourceX,command.sourceY,0) sourceSize:MTLSizeMake(command.width, command.height, 1) toTexture:destinationTex destinationSlice:command.destinationLayer destinationLevel:0 destinationOrigin:MTLOriginMake(command.destinationX,command.destinationY,0)];
+        }
+        else if (command.type == kDGCommandBlit && IsCopyBlit(command))
+        {
+            if (blitCommand == nil)
+                blitCommand = [commandBuffer blitCommandEncoder];
+
+            id<MTLTexture> sourceTex = (__bridge id<MTLTexture>)command.source;
+            id<MTLTexture> destinationTex = (__bridge id<MTLTexture>)command.destination;
+            [blitCommand copyFromTexture:sourceTex sourceSlice:command.sourceLayer sourceLevel:0 sourceOrigin:MTLOriginMake(command.sourceX,command.sourceY,0) sourceSize:MTLSizeMake(command.width, command.height, 1) toTexture:destinationTex destinationSlice:command.destinationLayer destinationLevel:0 destinationOrigin:MTLOriginMake(command.destinationX,command.destinationY,0)];
+        }
+        else if (command.type == kDGCommandBlit || command.type == kDGCommandConvert)
+        {
+            if (blitCommand != nil)
+            {
+                [blitCommand endEncoding];
+                blitCommand = nil;
+            }
+            EncodeBlit(commandBuffer, command);
+        }
+        else if (command.type == kDGCommandCompress)
+        {
+            if (blitCommand != nil)
+            {
+                [blitCommand endEncoding];
+                blitCommand = nil;
+            }
+            EncodeCompress(commandBuffer, command);
+        }
+        else if (command.type == kDGCommandGenerateMips)
+        {
+            id<MTLTexture> tex = (__bridge id<MTLTexture>)command.destination;
+            if (tex.mipmapLevelCount <= 1)
+                continue;
+            if (blitCommand == nil)
+                blitCommand = [commandBuffer blitCommandEncoder];
+            [blitCommand generateMipmapsForTexture:tex];
+        }
+        else if (command.type == kDGCommandClear && ClearsByBlit((__bridge id<MTLTexture>)command.destination))
+        {
+            id<MTLTexture> tex = (__bridge id<MTLTexture>)command.destination;
+            const DGRect rect = { 0, 0, (int)tex.width, (int)tex.height };
+            if (blitCommand == nil)
+                blitCommand = [commandBuffer blitCommandEncoder];
+            EncodeBlitClear(blitCommand, tex, command.destinationLayer, command.color, &rect, 1);
+        }
+        else if (command.type == kDGCommandClearRect)
+        {
+            // Rectangles of the same layer and color share one pass
+            m_ClearRects.clear();
+            for (int end = i; end < count && (end == i || ContinuesClearRects(commands[end - 1], commands[end])); ++end)
+            {
+                const DGRect rect = { commands[end].destinationX, commands[end].destinationY, commands[end].width, commands[end].height };
+                m_ClearRects.push_back(rect);
+            }
+            i += (int)m_ClearRects.size() - 1;
+
+            id<MTLTexture> tex = (__bridge id<MTLTexture>)command.destination;
+            if (ClearsByBlit(tex))
+            {
+                if (blitCommand == nil)
+                    blitCommand = [commandBuffer blitCommandEncoder];
+                EncodeBlitClear(blitCommand, tex, command.destinationLayer, command.color, m_ClearRects.data(), (int)m_ClearRects.size());
+            }
+            else
+            {
+                if (blitCommand != nil)
+                {
+                    [blitCommand endEncoding];
+                    blitCommand = nil;
+                }
+                EncodeClearRects(commandBuffer, tex, command.destinationLayer, command.color, m_ClearRects.data(), (int)m_ClearRects.size());
+            }
+        }
+        else if (command.type == kDGCommandClear)
+        {
+            if (blitCommand != nil)
+            {
+                [blitCommand endEncoding];
+                blitCommand = nil;
+            }
+
+            MTLRenderPassDescriptor *rpdesc = [MTLRenderPassDescriptor renderPassDescriptor];
+            rpdesc.colorAttachments[0].clearColor = MTLClearColorMake((double)command.color[0], (double)command.color[1], (double)command.color[2], (double)command.color[3]);
+            rpdesc.colorAttachments[0].loadAction = MTLLoadActionClear;
+            rpdesc.colorAttachments[0].storeAction = MTLStoreActionStore;
+            rpdesc.colorAttachments[0].texture = (__bridge id<MTLTexture>)command.destination;
+            rpdesc.colorAttachments[0].slice = command.destinationLayer;
+
+            id <MTLRenderCommandEncoder> commandEncoder = [commandBuffer renderCommandEncoderWithDescriptor:rpdesc];
+            [commandEncoder endEncoding];
+        }
+    }
+
+    if (blitCommand != nil)
+        [blitCommand endEncoding];
+}
+
+void RenderAPI_Metal::GenerateMips(void* texture)
+{
+    id<MTLTexture> tex = (__bridge id<MTLTexture>)texture;
+    if (tex.mipmapLevelCount <= 1)
+        return;
+
+    m_MetalGraphics->EndCurrentCommandEncoder();
+    id<MTLBlitCommandEncoder> blitCommand = [m_MetalGraphics->CurrentCommandBuffer() blitCommandEncoder];
+    [blitCommand generateMipmapsForTexture:tex];
+    [blitCommand endEncoding];
+}
+
+void RenderAPI_Metal::BlitTexture(void* sourceTexture, int sourceX, int sourceY, int sourceWidth, int sourceHeight, void* destinationTexture, int destinationX, int destinationY, int destinationWidth, int destinationHeight, int filter)
+{
+    DGCommand command = {};
+    command.type = kDGCommandBlit;
+    command.source = sourceTexture;
+    command.destination = destinationTexture;
+    command.sourceX = sourceX;
+    command.sourceY = sourceY;
+    command.width = sourceWidth;
+    command.height = sourceHeight;
+    command.destinationX = destinationX;
+    command.destinationY = destinationY;
+    command.destinationWidth = destinationWidth;
+    command.destinationHeight = destinationHeight;
+    command.filter = filter;
+    SubmitCommands(&command, 1);
+}
+
+int RenderAPI_Metal::GetSupportedConvertOptions()
+{
+    return kDGConvertOptionsAll;
+}
+
+// Draws the source rectangle over the destination rectangle, keeping the rest of the destination. Converts are blits of
+// the same size that apply their options in the fragment shader.
+void RenderAPI_Metal::EncodeBlit(id<MTLCommandBuffer> commandBuffer, const DGCommand& command)
+{
+    const bool convert = command.type == kDGCommandConvert;
+    const int destinationWidth = convert ? command.width : command.destinationWidth;
+    const int destinationHeight = convert ? command.height : command.destinationHeight;
+    const int filter = convert ? kDGFilterNearest : command.filter;
+
+    id<MTLTexture> sourceTex = (__bridge id<MTLTexture>)command.source;
+    id<MTLTexture> destinationTex = (__bridge id<MTLTexture>)command.destination;
+    id<MTLRenderPipelineState> pipeline = GetBlitPipeline(destinationTex.pixelFormat, convert ? kBlitFragmentConvert : kBlitFragmentCopy);
+    if (pipeline == nil)
+        return;
+
+    MTLRenderPassDescriptor *rpdesc = [MTLRenderPassDescriptor renderPassDescriptor];
+    rpdesc.colorAttachments[0].loadAction = MTLLoadActionLoad;
+    rpdesc.colorAttachments[0].storeAction = MTLStoreActionStore;
+    rpdesc.colorAttachments[0].texture = destinationTex;
+    rpdesc.colorAttachments[0].slice = command.destinationLayer;
+
+    // The shader samples a plain 2D texture, layers of arrays are viewed as one
+    if (sourceTex.textureType == MTLTextureType2DArray)
+        sourceTex = [sourceTex newTextureViewWithPixelFormat:sourceTex.pixelFormat textureType:MTLTextureType2D levels:NSMakeRange(0, 1) slices:NSMakeRange(command.sourceLayer, 1)];
+
+    const MTLViewport viewport = { (double)command.destinationX, (double)command.destinationY, (double)destinationWidth, (double)destinationHeight, 0.0, 1.0 };
+    const MTLScissorRect scissor = { (NSUInteger)command.destinationX, (NSUInteger)command.destinationY, (NSUInteger)destinationWidth, (NSUInteger)destinationHeight };
+    const float sourceRect[4] =
+    {
+        (float)command.sourceX / (float)sourceTex.width,
+        (float)command.sourceY / (float)sourceTex.height,
+        (float)command.width / (float)sourceTex.width,
+        (float)command.height / (float)sourceTex.height,
+    };
+
+    id <MTLRenderCommandEncoder> commandEncoder = [commandBuffer renderCommandEncoderWithDescriptor:rpdesc];
+    [commandEncoder setRenderPipelineState:pipeline];
+    [commandEncoder setViewport:viewport];
+    [commandEncoder setScissorRect:scissor];
+    [commandEncoder setVertexBytes:sourceRect length:sizeof(sourceRect) atIndex:0];
+    [commandEncoder setFragmentTexture:sourceTex atIndex:0];
+    [commandEncoder setFragmentSamplerState:m_BlitSamplers[filter == kDGFilterLinear ? kDGFilterLinear : kDGFilterNearest] atIndex:0];
+    if (convert)
+    {
+        const uint32_t options[2] = { (uint32_t)command.convertOptions, (uint32_t)command.swizzle };
+        [commandEncoder setFragmentBytes:options length:sizeof(options) atIndex:0];
+    }
+    [commandEncoder drawPrimitives:MTLPrimitiveTypeTriangle vertexStart:0 vertexCount:3];
+    [commandEncoder endEncoding];
+}
+
+id<MTLRenderPipelineState> RenderAPI_Metal::GetBlitPipeline(MTLPixelFormat pixelFormat, int fragment)
+{
+    NSString* const fragmentNames[4] = { @"blitFragment", @"convertFragment", @"clearFragment", @"generateFragment" };
+    const int key = ((int)pixelFormat << 2) | fragment;
+    std::unordered_map<int, id<MTLRenderPipelineState>>::iterator it = m_BlitPipelines.find(key);
+    if (it != m_BlitPipelines.end())
+        return it->second;
+
+    MTLRenderPipelineDescriptor* pipeDesc = [[MTLRenderPipelineDescriptorClass alloc] init];
+    pipeDesc.colorAttachments[0].pixelFormat = pixelFormat;
+    pipeDesc.colorAttachments[0].blendingEnabled = NO;
+    pipeDesc.sampleCount = 1;
+    pipeDesc.vertexFunction = [m_ShaderLibrary newFunctionWithName:@"blitVertex"];
+    pipeDesc.fragmentFunction = [m_ShaderLibrary newFunctionWithName:fragmentNames[fragment]];
+
+    NSError* error = nil;
+    id<MTLRenderPipelineState> pipeline = [m_MetalGraphics->MetalDevice() newRenderPipelineStateWithDescriptor:pipeDesc error:&error];
+    if (error != nil)
+        ::fprintf(stderr, "Metal: Error creating blit pipeline state: %s\n%s\n", [[error localizedDescription] UTF8String], [[error localizedFailureReason] UTF8String]);
+
+    // Formats that can't be rendered to are remembered as nil
+    m_BlitPipelines[key] = pipeline;
+    return pipeline;
+}
+
+bool RenderAPI_Metal::SupportsCompressTexture()
+{
+    // BC formats are only guaranteed on macOS
+#if TARGET_OS_OSX
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Block compressed textures can't be written from shaders, so every 4x4 block of the rectangle is encoded by one
+// compute thread into a buffer and the blocks are copied into the destination from there.
+void RenderAPI_Metal::EncodeCompress(id<MTLCommandBuffer> commandBuffer, const DGCommand& command)
+{
+    id<MTLTexture> sourceTex = (__bridge id<MTLTexture>)command.source;
+    id<MTLTexture> destinationTex = (__bridge id<MTLTexture>)command.destination;
+
+    // The kernels are indexed by BCFormat
+    const int encoder = GetTextureBCFormat(command.destination);
+    if (encoder < 0)
+        return;
+    const NSUInteger blockBytes = GetBCBlockBytes(encoder);
+    NSString* const functionNames[3] = { @"compressBC1", @"compressBC3", @"compressBC7" };
+
+    if (m_CompressPipelines[encoder] == nil)
+    {
+        NSError* error = nil;
+        m_CompressPipelines[encoder] = [m_MetalGraphics->MetalDevice() newComputePipelineStateWithFunction:[m_ShaderLibrary newFunctionWithName:functionNames[encoder]] error:&error];
+        if (error != nil)
+        {
+            ::fprintf(stderr, "Metal: Error creating compress pipeline state: %s\n%s\n", [[error localizedDescription] UTF8String], [[error localizedFailureReason] UTF8String]);
+            return;
+        }
+    }
+
+    // Partial blocks are only allowed at the right and bottom edge of the destination
+    if ((NSUInteger)command.destinationX >= destinationTex.width || (NSUInteger)command.destinationY >= destinationTex.height ||
+        (NSUInteger)command.sourceX >= sourceTex.width || (NSUInteger)command.sourceY >= sourceTex.height)
+        return;
+    const NSUInteger width = MIN(((NSUInteger)command.width + 3) & ~(NSUInteger)3, destinationTex.width - command.destinationX);
+    const NSUInteger height = MIN(((NSUInteger)command.height + 3) & ~(NSUInteger)3, destinationTex.height - command.destinationY);
+    const NSUInteger blocksWide = (width + 3) / 4;
+    const NSUInteger blocksHigh = (height + 3) / 4;
+
+    // The kernel reads a plain 2D texture, layers of arrays are viewed as one
+    if (sourceTex.textureType == MTLTextureType2DArray)
+        sourceTex = [sourceTex newTextureViewWithPixelFormat:sourceTex.pixelFormat textureType:MTLTextureType2D levels:NSMakeRange(0, 1) slices:NSMakeRange(command.sourceLayer, 1)];
+
+    // Source pixels past the rectangle repeat its last row and column
+    const uint32_t params[8] =
+    {
+        (uint32_t)command.sourceX,
+        (uint32_t)command.sourceY,
+        (uint32_t)MIN((NSUInteger)command.width, sourceTex.width - command.sourceX),
+        (uint32_t)MIN((NSUInteger)command.height, sourceTex.height - command.sourceY),
+        (uint32_t)blocksWide,
+        (uint32_t)blocksHigh,
+        (uint32_t)command.quality,
+        0,
+    };
+
+    id<MTLBuffer> blocks = [m_MetalGraphics->MetalDevice() newBufferWithLength:blocksWide * blocksHigh * blockBytes options:MTLResourceStorageModePrivate];
+
+    id<MTLComputeCommandEncoder> computeCommand = [commandBuffer computeCommandEncoder];
+    [computeCommand setComputePipelineState:m_CompressPipelines[encoder]];
+    [computeCommand setTexture:sourceTex atIndex:0];
+    [computeCommand setBuffer:blocks offset:0 atIndex:0];
+    [computeCommand setBytes:params length:sizeof(params) atIndex:1];
+    [computeCommand dispatchThreadgroups:MTLSizeMake((blocksWide + 7) / 8, (blocksHigh + 7) / 8, 1) threadsPerThreadgroup:MTLSizeMake(8, 8, 1)];
+    [computeCommand endEncoding];
+
+    id<MTLBlitCommandEncoder> blitCommand = [commandBuffer blitCommandEncoder];
+    [blitCommand copyFromBuffer:blocks sourceOffset:0 sourceBytesPerRow:blocksWide * blockBytes sourceBytesPerImage:blocksWide * blocksHigh * blockBytes sourceSize:MTLSizeMake(width, height, 1) toTexture:destinationTex destinationSlice:command.destinationLayer destinationLevel:0 destinationOrigin:MTLOriginMake(command.destinationX, command.destinationY, 0)];
+    [blitCommand endEncoding];
+}
+
+// Compressed and alpha only textures can't be render targets, so they are cleared by copying from a buffer instead
+bool RenderAPI_Metal::ClearsByBlit(id<MTLTexture> texture)
+{
+    return texture.pixelFormat == MTLPixelFormatA8Unorm || GetTextureBCFormat((__bridge void*)texture) >= 0;
+}
+
+// Size of the buffer a blit clear repeats down the texture
+static const NSUInteger kClearBandBytes = 64 * 1024;
+
+// The clear color is encoded once into a block, or a byte of alpha, and a band of copies of it as wide as the widest
+// rectangle is copied down every rectangle. Rectangles of compressed textures that are not aligned to blocks are skipped,
+// only those touching the right or bottom edge may end in a partial block.
+void RenderAPI_Metal::EncodeBlitClear(id<MTLBlitCommandEncoder> blitCommand, id<MTLTexture> texture, int layer, const float* color, const DGRect* rects, int count)
+{
+    unsigned char block[16];
+    NSUInteger blockBytes = 1;
+    NSUInteger blockSize = 1;
+    const int format = GetTextureBCFormat((__bridge void*)texture);
+    if (format >= 0)
+    {
+        bool srgb = false;
+#if TARGET_OS_OSX
+        srgb = texture.pixelFormat == MTLPixelFormatBC1_RGBA_sRGB || texture.pixelFormat == MTLPixelFormatBC3_RGBA_sRGB || texture.pixelFormat == MTLPixelFormatBC7_RGBAUnorm_sRGB;
+#endif
+        // Metal's BC1 formats all carry punch-through alpha
+        EncodeBCSolidBlock(format, color, srgb, true, block);
+        blockBytes = GetBCBlockBytes(format);
+        blockSize = 4;
+    }
+    else
+    {
+        block[0] = (unsigned char)(MAX(0.0f, MIN(1.0f, color[3])) * 255.0f + 0.5f);
+    }
+
+    std::vector<MTLRegion> regions;
+    regions.reserve(count);
+    NSUInteger width = 0;
+    NSUInteger height = 0;
+    for (int i = 0; i < count; i++)
+    {
+        const NSInteger x = MAX(rects[i].x, 0);
+        const NSInteger y = MAX(rects[i].y, 0);
+        const NSInteger right = MIN((NSInteger)rects[i].x + rects[i].width, (NSInteger)texture.width);
+        const NSInteger bottom = MIN((NSInteger)rects[i].y + rects[i].height, (NSInteger)texture.height);
+        if (right <= x || bottom <= y)
+            continue;
+        const MTLRegion region = MTLRegionMake2D(x, y, right - x, bottom - y);
+        if (region.origin.x % blockSize != 0 || region.origin.y % blockSize != 0 ||
+            (region.size.width % blockSize != 0 && (NSUInteger)right != texture.width) || (region.size.height % blockSize != 0 && (NSUInteger)bottom != texture.height))
+            continue;
+        regions.push_back(region);
+        width = MAX(width, region.size.width);
+        height = MAX(height, region.size.height);
+    }
+    if (regions.empty())
+        return;
+
+    const NSUInteger blocksWide = (width + blockSize - 1) / blockSize;
+    const NSUInteger blocksHigh = (height + blockSize - 1) / blockSize;
+    const NSUInteger rowBytes = blocksWide * blockBytes;
+    const NSUInteger bandBlocks = MAX((NSUInteger)1, MIN(blocksHigh, kClearBandBytes / rowBytes));
+    const NSUInteger bandHeight = MIN(height, bandBlocks * blockSize);
+
+    id<MTLBuffer> band = [m_MetalGraphics->MetalDevice() newBufferWithLength:rowBytes * bandBlocks options:MTLResourceStorageModeShared];
+    unsigned char* bandData = (unsigned char*)band.contents;
+    for (NSUInteger i = 0; i < blocksWide * bandBlocks; i++)
+        memcpy(bandData + i * blockBytes, block, blockBytes);
+
+    for (size_t i = 0; i < regions.size(); i++)
+    {
+        const MTLRegion& region = regions[i];
+        for (NSUInteger y = 0; y < region.size.height; y += bandHeight)
+            [blitCommand copyFromBuffer:band sourceOffset:0 sourceBytesPerRow:rowBytes sourceBytesPerImage:rowBytes * bandBlocks sourceSize:MTLSizeMake(region.size.width, MIN(bandHeight, region.size.height - y), 1) toTexture:texture destinationSlice:layer destinationLevel:0 destinationOrigin:MTLOriginMake(region.origin.x, region.origin.y + y, 0)];
+    }
+}
+
+// Metal has no partial clears, so one render pass keeps the contents and draws the color once per rectangle, clipped by
+// its scissor.
+void RenderAPI_Metal::EncodeClearRects(id<MTLCommandBuffer> commandBuffer, id<MTLTexture> texture, int layer, const float* color, const DGRect* rects, int count)
+{
+    id<MTLRenderPipelineState> pipeline = GetBlitPipeline(texture.pixelFormat, kBlitFragmentClear);
+    if (pipeline == nil)
+        return;
+
+    MTLRenderPassDescriptor *rpdesc = [MTLRenderPassDescriptor renderPassDescriptor];
+    rpdesc.colorAttachments[0].loadAction = MTLLoadActionLoad;
+    rpdesc.colorAttachments[0].storeAction = MTLStoreActionStore;
+    rpdesc.colorAttachments[0].texture = texture;
+    rpdesc.colorAttachments[0].slice = layer;
+
+    const MTLViewport viewport = { 0.0, 0.0, (double)texture.width, (double)texture.height, 0.0, 1.0 };
+    const float sourceRect[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+
+    id <MTLRenderCommandEncoder> commandEncoder = [commandBuffer renderCommandEncoderWithDescriptor:rpdesc];
+    [commandEncoder setRenderPipelineState:pipeline];
+    [commandEncoder setViewport:viewport];
+    [commandEncoder setVertexBytes:sourceRect length:sizeof(sourceRect) atIndex:0];
+    [commandEncoder setFragmentBytes:color length:sizeof(float) * 4 atIndex:0];
+    for (int i = 0; i < count; i++)
+    {
+        const NSInteger x = MAX(rects[i].x, 0);
+        const NSInteger y = MAX(rects[i].y, 0);
+        const NSInteger right = MIN((NSInteger)rects[i].x + rects[i].width, (NSInteger)texture.width);
+        const NSInteger bottom = MIN((NSInteger)rects[i].y + rects[i].height, (NSInteger)texture.height);
+        if (right <= x || bottom <= y)
+            continue;
+        const MTLScissorRect scissor = { (NSUInteger)x, (NSUInteger)y, (NSUInteger)(right - x), (NSUInteger)(bottom - y) };
+        [commandEncoder setScissorRect:scissor];
+        [commandEncoder drawPrimitives:MTLPrimitiveTypeTriangle vertexStart:0 vertexCount:3];
+    }
+    [commandEncoder endEncoding];
+}
+
+// Mirrors GenerateParams of kShaderSource
+struct GenerateConstants
+{
+    float colorA[4];
+    float colorB[4];
+    float points[4];
+    float cellSize;
+    float lacunarity;
+    float gain;
+    uint32_t generator;
+    uint32_t octaves;
+    uint32_t seed;
+    uint32_t padding[2];
+};
+
+// The patterns are drawn by a fragment shader into the rectangle, the same way converts are. Compressed formats can't be
+// render targets and are left as they are.
+void RenderAPI_Metal::GenerateTexture(void* texture, int layer, const DGGenerateParams& params)
+{
+    id<MTLTexture> tex = (__bridge id<MTLTexture>)texture;
+    if ((NSUInteger)layer >= tex.arrayLength || (NSUInteger)params.x >= tex.width || (NSUInteger)params.y >= tex.height)
+        return;
+    id<MTLRenderPipelineState> pipeline = GetBlitPipeline(tex.pixelFormat, kBlitFragmentGenerate);
+    if (pipeline == nil)
+        return;
+
+    GenerateConstants constants;
+    memcpy(constants.colorA, params.colorA, sizeof(constants.colorA));
+    memcpy(constants.colorB, params.colorB, sizeof(constants.colorB));
+    constants.points[0] = params.start[0];
+    constants.points[1] = params.start[1];
+    constants.points[2] = params.end[0];
+    constants.points[3] = params.end[1];
+    constants.cellSize = params.cellSize;
+    constants.lacunarity = params.lacunarity;
+    constants.gain = params.gain;
+    constants.generator = (uint32_t)params.generator;
+    constants.octaves = (uint32_t)params.octaves;
+    constants.seed = params.seed;
+    constants.padding[0] = constants.padding[1] = 0;
+
+    const NSUInteger width = MIN((NSUInteger)params.width, tex.width - params.x);
+    const NSUInteger height = MIN((NSUInteger)params.height, tex.height - params.y);
+    const MTLViewport viewport = { (double)params.x, (double)params.y, (double)width, (double)height, 0.0, 1.0 };
+    const MTLScissorRect scissor = { (NSUInteger)params.x, (NSUInteger)params.y, width, height };
+    const float sourceRect[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+
+    m_MetalGraphics->EndCurrentCommandEncoder();
+    id<MTLCommandBuffer> commandBuffer = m_MetalGraphics->CurrentCommandBuffer();
+
+    MTLRenderPassDescriptor *rpdesc = [MTLRenderPassDescriptor renderPassDescriptor];
+    rpdesc.colorAttachments[0].loadAction = MTLLoadActionLoad;
+    rpdesc.colorAttachments[0].storeAction = MTLStoreActionStore;
+    rpdesc.colorAttachments[0].texture = tex;
+    rpdesc.colorAttachments[0].slice = layer;
+
+    id <MTLRenderCommandEncoder> commandEncoder = [commandBuffer renderCommandEncoderWithDescriptor:rpdesc];
+    [commandEncoder setRenderPipelineState:pipeline];
+    [commandEncoder setViewport:viewport];
+    [commandEncoder setScissorRect:scissor];
+    [commandEncoder setVertexBytes:sourceRect length:sizeof(sourceRect) atIndex:0];
+    [commandEncoder setFragmentBytes:&constants length:sizeof(constants) atIndex:0];
+    [commandEncoder drawPrimitives:MTLPrimitiveTypeTriangle vertexStart:0 vertexCount:3];
+    [commandEncoder endEncoding];
+}
+
+bool RenderAPI_Metal::GetTextureSize(void* texture, int* outWidth, int* outHeight)
+{
+    id<MTLTexture> tex = (__bridge id<MTLTexture>)texture;
+    *outWidth = (int)tex.width;
+    *outHeight = (int)tex.height;
+    return true;
+}
+
+// replaceRegion writes on the CPU right away, ahead of the commands before it that are still waiting in the command buffer.
+// The rows are staged in a shared buffer instead and copied into the texture by a blit in command order.
+bool RenderAPI_Metal::UploadTexture(void* texture, int layer, int x, int y, int width, int height, const void* data, int dataRowPitch)
+{
+    id<MTLTexture> tex = (__bridge id<MTLTexture>)texture;
+    if ((NSUInteger)layer >= tex.arrayLength)
+        return false;
+    int blockBytes = 0, blockWidth = 1, blockHeight = 1;
+    GetTextureBlockInfo(texture, &blockBytes, &blockWidth, &blockHeight);
+    const NSUInteger rows = ((NSUInteger)height + blockHeight - 1) / blockHeight;
+    id<MTLBuffer> staging = [m_MetalGraphics->MetalDevice() newBufferWithBytes:data length:rows * dataRowPitch options:MTLResourceStorageModeShared];
+    if (staging == nil)
+        return false;
+
+    m_MetalGraphics->EndCurrentCommandEncoder();
+    id<MTLBlitCommandEncoder> blitCommand = [m_MetalGraphics->CurrentCommandBuffer() blitCommandEncoder];
+    [blitCommand copyFromBuffer:staging sourceOffset:0 sourceBytesPerRow:dataRowPitch sourceBytesPerImage:rows * dataRowPitch sourceSize:MTLSizeMake(width, height, 1) toTexture:tex destinationSlice:layer destinationLevel:0 destinationOrigin:MTLOriginMake(x, y, 0)];
+    [blitCommand endEncoding];
+    return true;
+}
+
+int RenderAPI_Metal::GetTextureBCFormat(void* texture)
+{
+    id<MTLTexture> tex = (__bridge id<MTLTexture>)texture;
+    switch (tex.pixelFormat)
+    {
+#if TARGET_OS_OSX
+    case MTLPixelFormatBC1_RGBA:
+    case MTLPixelFormatBC1_RGBA_sRGB:
+        return kBCFormatBC1;
+    case MTLPixelFormatBC3_RGBA:
+    case MTLPixelFormatBC3_RGBA_sRGB:
+        return kBCFormatBC3;
+    case MTLPixelFormatBC7_RGBAUnorm:
+    case MTLPixelFormatBC7_RGBAUnorm_sRGB:
+        return kBCFormatBC7;
+#endif
+    default:
+        return -1;
+    }
+}
+
+bool RenderAPI_Metal::GetTextureBlockInfo(void* texture, int* outBlockBytes, int* outBlockWidth, int* outBlockHeight)
+{
+    id<MTLTexture> tex = (__bridge id<MTLTexture>)texture;
+    switch (tex.pixelFormat)
+    {
+    case MTLPixelFormatA8Unorm:
+    case MTLPixelFormatR8Unorm:
+        *outBlockBytes = 1;
+        break;
+    case MTLPixelFormatRG8Unorm:
+    case MTLPixelFormatR16Unorm:
+    case MTLPixelFormatR16Float:
+        *outBlockBytes = 2;
+        break;
+    case MTLPixelFormatRGBA8Unorm:
+    case MTLPixelFormatRGBA8Unorm_sRGB:
+    case MTLPixelFormatBGRA8Unorm:
+    case MTLPixelFormatBGRA8Unorm_sRGB:
+    case MTLPixelFormatRGB10A2Unorm:
+    case MTLPixelFormatRG11B10Float:
+    case MTLPixelFormatRGB9E5Float:
+    case MTLPixelFormatRG16Unorm:
+    case MTLPixelFormatRG16Float:
+    case MTLPixelFormatR32Uint:
+    case MTLPixelFormatR32Float:
+        *outBlockBytes = 4;
+        break;
+    case MTLPixelFormatRGBA16Unorm:
+    case MTLPixelFormatRGBA16Float:
+    case MTLPixelFormatRG32Float:
+        *outBlockBytes = 8;
+        break;
+    case MTLPixelFormatRGBA32Float:
+        *outBlockBytes = 16;
+        break;
+    default:
+        return RenderAPI::GetTextureBlockInfo(texture, outBlockBytes, outBlockWidth, outBlockHeight);
+    }
+    *outBlockWidth = 1;
+    *outBlockHeight = 1;
+    return true;
+}
+
 #endif // #if SUPPORT_METAL
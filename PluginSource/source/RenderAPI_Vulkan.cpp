@@ -3,8 +3,14 @@
 
 #if SUPPORT_VULKAN
 
+#include "BlockCompression.h"
+
 #include <string.h>
-#include <map>
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <unordered_map>
 #include <vector>
 #include <math.h>
 
@@ -17,6 +23,8 @@
     apply(vkCmdBeginRenderPass); \
     apply(vkCreateBuffer); \
     apply(vkGetPhysicalDeviceMemoryProperties); \
+    apply(vkGetPhysicalDeviceProperties); \
+    apply(vkGetPhysicalDeviceFormatProperties); \
     apply(vkGetBufferMemoryRequirements); \
     apply(vkMapMemory); \
     apply(vkBindBufferMemory); \
@@ -32,6 +40,9 @@
     apply(vkDeviceWaitIdle); \
     apply(vkCmdCopyBufferToImage); \
     apply(vkCmdCopyImage); \
+    apply(vkCmdCopyImageToBuffer); \
+    apply(vkInvalidateMappedMemoryRanges); \
+    apply(vkCmdPipelineBarrier); \
     apply(vkCmdBlitImage); \
     apply(vkCreateImage); \
     apply(vkGetImageMemoryRequirements); \
@@ -45,7 +56,17 @@
     apply(vkCmdPushConstants); \
     apply(vkCmdBindVertexBuffers); \
     apply(vkDestroyPipeline); \
-    apply(vkDestroyPipelineLayout);
+    apply(vkDestroyPipelineLayout); \
+    apply(vkCreateDescriptorSetLayout); \
+    apply(vkDestroyDescriptorSetLayout); \
+    apply(vkCreateDescriptorPool); \
+    apply(vkDestroyDescriptorPool); \
+    apply(vkResetDescriptorPool); \
+    apply(vkAllocateDescriptorSets); \
+    apply(vkUpdateDescriptorSets); \
+    apply(vkCreateComputePipelines); \
+    apply(vkCmdBindDescriptorSets); \
+    apply(vkCmdDispatch);
     
 #define VULKAN_DEFINE_API_FUNCPTR(func) static PFN_##func func
 VULKAN_DEFINE_API_FUNCPTR(vkGetInstanceProcAddr);
@@ -120,6 +141,225 @@ static int FindMemoryTypeIndex(VkPhysicalDeviceMemoryProperties const & physical
     return -1;
 }
 
+// Size in bytes of one texel block and the block dimensions, 1x1 for uncompressed formats. Returns false for unknown formats.
+static bool GetFormatBlockInfo(VkFormat format, int* outBlockBytes, int* outBlockWidth, int* outBlockHeight)
+{
+    *outBlockWidth = 1;
+    *outBlockHeight = 1;
+    switch (format)
+    {
+    case VK_FORMAT_R4G4_UNORM_PACK8:
+    case VK_FORMAT_R8_UNORM:
+    case VK_FORMAT_R8_SRGB:
+        *outBlockBytes = 1;
+        return true;
+    case VK_FORMAT_R4G4B4A4_UNORM_PACK16:
+    case VK_FORMAT_B4G4R4A4_UNORM_PACK16:
+    case VK_FORMAT_R5G6B5_UNORM_PACK16:
+    case VK_FORMAT_B5G6R5_UNORM_PACK16:
+    case VK_FORMAT_R5G5B5A1_UNORM_PACK16:
+    case VK_FORMAT_A1R5G5B5_UNORM_PACK16:
+    case VK_FORMAT_R8G8_UNORM:
+    case VK_FORMAT_R8G8_SRGB:
+    case VK_FORMAT_R16_UNORM:
+    case VK_FORMAT_R16_SFLOAT:
+        *outBlockBytes = 2;
+        return true;
+    case VK_FORMAT_R8G8B8_UNORM:
+    case VK_FORMAT_B8G8R8_UNORM:
+        *outBlockBytes = 3;
+        return true;
+    case VK_FORMAT_R8G8B8A8_UNORM:
+    case VK_FORMAT_R8G8B8A8_SRGB:
+    case VK_FORMAT_B8G8R8A8_UNORM:
+    case VK_FORMAT_B8G8R8A8_SRGB:
+    case VK_FORMAT_A8B8G8R8_UNORM_PACK32:
+    case VK_FORMAT_A2B10G10R10_UNORM_PACK32:
+    case VK_FORMAT_B10G11R11_UFLOAT_PACK32:
+    case VK_FORMAT_E5B9G9R9_UFLOAT_PACK32:
+    case VK_FORMAT_R16G16_UNORM:
+    case VK_FORMAT_R16G16_SFLOAT:
+    case VK_FORMAT_R32_UINT:
+    case VK_FORMAT_R32_SFLOAT:
+        *outBlockBytes = 4;
+        return true;
+    case VK_FORMAT_R16G16B16A16_UNORM:
+    case VK_FORMAT_R16G16B16A16_SFLOAT:
+    case VK_FORMAT_R32G32_SFLOAT:
+        *outBlockBytes = 8;
+        return true;
+    case VK_FORMAT_R32G32B32_SFLOAT:
+        *outBlockBytes = 12;
+        return true;
+    case VK_FORMAT_R32G32B32A32_SFLOAT:
+        *outBlockBytes = 16;
+        return true;
+    case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+    case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+    case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+    case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+    case VK_FORMAT_BC4_UNORM_BLOCK:
+    case VK_FORMAT_BC4_SNORM_BLOCK:
+        *outBlockBytes = 8;
+        *outBlockWidth = 4;
+        *outBlockHeight = 4;
+        return true;
+    case VK_FORMAT_BC2_UNORM_BLOCK:
+    case VK_FORMAT_BC2_SRGB_BLOCK:
+    case VK_FORMAT_BC3_UNORM_BLOCK:
+    case VK_FORMAT_BC3_SRGB_BLOCK:
+    case VK_FORMAT_BC5_UNORM_BLOCK:
+    case VK_FORMAT_BC5_SNORM_BLOCK:
+    case VK_FORMAT_BC6H_UFLOAT_BLOCK:
+    case VK_FORMAT_BC6H_SFLOAT_BLOCK:
+    case VK_FORMAT_BC7_UNORM_BLOCK:
+    case VK_FORMAT_BC7_SRGB_BLOCK:
+        *outBlockBytes = 16;
+        *outBlockWidth = 4;
+        *outBlockHeight = 4;
+        return true;
+    default:
+        return false;
+    }
+}
+
+// BCFormat the CPU encoder writes for a format, -1 for formats it can't encode
+static int GetBCFormat(VkFormat format)
+{
+    switch (format)
+    {
+    case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+    case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+    case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+    case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+        return kBCFormatBC1;
+    case VK_FORMAT_BC3_UNORM_BLOCK:
+    case VK_FORMAT_BC3_SRGB_BLOCK:
+        return kBCFormatBC3;
+    case VK_FORMAT_BC7_UNORM_BLOCK:
+    case VK_FORMAT_BC7_SRGB_BLOCK:
+        return kBCFormatBC7;
+    default:
+        return -1;
+    }
+}
+
+// The sRGB format sharing the bits of an 8 bit unorm format, VK_FORMAT_UNDEFINED for formats without one
+static VkFormat GetSRGBFormat(VkFormat format)
+{
+    switch (format)
+    {
+    case VK_FORMAT_R8_UNORM: return VK_FORMAT_R8_SRGB;
+    case VK_FORMAT_R8G8_UNORM: return VK_FORMAT_R8G8_SRGB;
+    case VK_FORMAT_R8G8B8A8_UNORM: return VK_FORMAT_R8G8B8A8_SRGB;
+    case VK_FORMAT_B8G8R8A8_UNORM: return VK_FORMAT_B8G8R8A8_SRGB;
+    default: return VK_FORMAT_UNDEFINED;
+    }
+}
+
+// Texel format code the compute shaders read and write storage buffer texels with: bits 0-1 are the layout (RGBA8, BGRA8,
+// RGBA16F, RGBA32F) and bit 2 is set for 8 bit sRGB. -1 for formats the shaders don't know.
+static int GetComputeTexelFormat(VkFormat format)
+{
+    switch (format)
+    {
+    case VK_FORMAT_R8G8B8A8_UNORM: return 0;
+    case VK_FORMAT_B8G8R8A8_UNORM: return 1;
+    case VK_FORMAT_R16G16B16A16_SFLOAT: return 2;
+    case VK_FORMAT_R32G32B32A32_SFLOAT: return 3;
+    case VK_FORMAT_R8G8B8A8_SRGB: return 4;
+    case VK_FORMAT_B8G8R8A8_SRGB: return 5;
+    default: return -1;
+    }
+}
+
+static void RecordImageBlit(VkCommandBuffer commandBuffer, VkImage source, VkImageLayout sourceLayout, int sourceLayer, const VkRect2D& sourceRect, VkImage destination, VkImageLayout destinationLayout, int destinationLayer, const VkRect2D& destinationRect, VkFilter filter)
+{
+    VkImageBlit blit;
+    blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    blit.srcSubresource.mipLevel = 0;
+    blit.srcSubresource.baseArrayLayer = (uint32_t)sourceLayer;
+    blit.srcSubresource.layerCount = 1;
+    blit.srcOffsets[0].x = sourceRect.offset.x;
+    blit.srcOffsets[0].y = sourceRect.offset.y;
+    blit.srcOffsets[0].z = 0;
+    blit.srcOffsets[1].x = sourceRect.offset.x + (int32_t)sourceRect.extent.width;
+    blit.srcOffsets[1].y = sourceRect.offset.y + (int32_t)sourceRect.extent.height;
+    blit.srcOffsets[1].z = 1;
+    blit.dstSubresource = blit.srcSubresource;
+    blit.dstSubresource.baseArrayLayer = (uint32_t)destinationLayer;
+    blit.dstOffsets[0].x = destinationRect.offset.x;
+    blit.dstOffsets[0].y = destinationRect.offset.y;
+    blit.dstOffsets[0].z = 0;
+    blit.dstOffsets[1].x = destinationRect.offset.x + (int32_t)destinationRect.extent.width;
+    blit.dstOffsets[1].y = destinationRect.offset.y + (int32_t)destinationRect.extent.height;
+    blit.dstOffsets[1].z = 1;
+    vkCmdBlitImage(commandBuffer, source, sourceLayout, destination, destinationLayout, 1, &blit, filter);
+}
+
+static void RecordImageCopy(VkCommandBuffer commandBuffer, VkImage source, VkImageLayout sourceLayout, int sourceLayer, const VkRect2D& sourceRect, VkImage destination, VkImageLayout destinationLayout, int destinationLayer, const VkOffset2D& destinationOffset)
+{
+    VkImageCopy region;
+    region.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.srcSubresource.mipLevel = 0;
+    region.srcSubresource.baseArrayLayer = (uint32_t)sourceLayer;
+    region.srcSubresource.layerCount = 1;
+    region.dstSubresource = region.srcSubresource;
+    region.dstSubresource.baseArrayLayer = (uint32_t)destinationLayer;
+    region.srcOffset.x = sourceRect.offset.x;
+    region.srcOffset.y = sourceRect.offset.y;
+    region.srcOffset.z = 0;
+    region.dstOffset.x = destinationOffset.x;
+    region.dstOffset.y = destinationOffset.y;
+    region.dstOffset.z = 0;
+    region.extent.width = sourceRect.extent.width;
+    region.extent.height = sourceRect.extent.height;
+    region.extent.depth = 1;
+    vkCmdCopyImage(commandBuffer, source, sourceLayout, destination, destinationLayout, 1, &region);
+}
+
+// Makes the transfer writes recorded so far visible to the transfers recorded next
+static void RecordTransferBarrier(VkCommandBuffer commandBuffer)
+{
+    VkMemoryBarrier barrier;
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.pNext = NULL;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0, NULL, 0, NULL);
+}
+
+// Makes the writes of one stage visible to the accesses of another, for the compute passes between transfers
+static void RecordMemoryBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags sourceStage, VkAccessFlags sourceAccess, VkPipelineStageFlags destinationStage, VkAccessFlags destinationAccess)
+{
+    VkMemoryBarrier barrier;
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.pNext = NULL;
+    barrier.srcAccessMask = sourceAccess;
+    barrier.dstAccessMask = destinationAccess;
+    vkCmdPipelineBarrier(commandBuffer, sourceStage, destinationStage, 0, 1, &barrier, 0, NULL, 0, NULL);
+}
+
+// Copy between a rectangle of an array layer and buffer rows rowLength texels apart, 0 for tightly packed rows
+static VkBufferImageCopy BufferImageRegion(VkDeviceSize bufferOffset, uint32_t rowLength, int layer, const VkRect2D& rect)
+{
+    VkBufferImageCopy region;
+    region.bufferOffset = bufferOffset;
+    region.bufferRowLength = rowLength;
+    region.bufferImageHeight = 0;
+    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.mipLevel = 0;
+    region.imageSubresource.baseArrayLayer = (uint32_t)layer;
+    region.imageSubresource.layerCount = 1;
+    region.imageOffset.x = rect.offset.x;
+    region.imageOffset.y = rect.offset.y;
+    region.imageOffset.z = 0;
+    region.imageExtent.width = rect.extent.width;
+    region.imageExtent.height = rect.extent.height;
+    region.imageExtent.depth = 1;
+    return region;
+}
+
 static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL Hook_vkGetInstanceProcAddr(VkInstance device, const char* funcName)
 {
     if (!funcName)
@@ -153,6 +393,444 @@ struct VulkanBuffer
     VkMemoryPropertyFlags deviceMemoryFlags;
 };
 
+// Suballocates a persistently mapped VulkanBuffer front to back. Allocations can be released in any order, either right
+// away or once a frame number is safe, but their space is only handed out again once every older allocation is released as well.
+class StagingRing
+{
+public:
+    StagingRing() : m_Buffer(), m_Head(0), m_NextId(0) { }
+
+    VulkanBuffer& Buffer() { return m_Buffer; }
+    bool IsEmpty() const { return m_Allocations.empty(); }
+
+    void Reset(const VulkanBuffer& buffer)
+    {
+        m_Buffer = buffer;
+        m_Allocations.clear();
+        m_Head = 0;
+    }
+
+    bool Allocate(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize* outOffset, unsigned int* outId)
+    {
+        if (m_Buffer.buffer == VK_NULL_HANDLE)
+            return false;
+
+        VkDeviceSize offset = (m_Head + alignment - 1) / alignment * alignment;
+        if (!m_Allocations.empty())
+        {
+            const VkDeviceSize tail = m_Allocations.front().begin;
+            if (m_Head >= tail)
+            {
+                // Wrap around when the end of the buffer is too small
+                if (offset + size > m_Buffer.sizeInBytes)
+                    offset = 0;
+                if (offset == 0 && size > tail)
+                    return false;
+            }
+            else if (offset + size > tail)
+            {
+                return false;
+            }
+        }
+        else
+        {
+            offset = 0;
+        }
+        if (offset + size > m_Buffer.sizeInBytes)
+            return false;
+
+        Allocation allocation;
+        allocation.begin = offset;
+        allocation.id = m_NextId++;
+        allocation.released = false;
+        allocation.retired = false;
+        allocation.frameNumber = 0;
+        m_Allocations.push_back(allocation);
+        m_Head = offset + size;
+
+        *outOffset = offset;
+        *outId = allocation.id;
+        return true;
+    }
+
+    void Release(unsigned int id)
+    {
+        for (size_t i = 0; i < m_Allocations.size(); ++i)
+        {
+            if (m_Allocations[i].id == id)
+            {
+                m_Allocations[i].released = true;
+                break;
+            }
+        }
+        Reclaim(0);
+    }
+
+    // The allocation is released once frameNumber is no longer used by the GPU, see Reclaim
+    void Retire(unsigned int id, unsigned long long frameNumber)
+    {
+        for (size_t i = 0; i < m_Allocations.size(); ++i)
+        {
+            if (m_Allocations[i].id == id)
+            {
+                m_Allocations[i].retired = true;
+                m_Allocations[i].frameNumber = frameNumber;
+                break;
+            }
+        }
+    }
+
+    void Reclaim(unsigned long long safeFrameNumber)
+    {
+        while (!m_Allocations.empty() && (m_Allocations.front().released || (m_Allocations.front().retired && m_Allocations.front().frameNumber <= safeFrameNumber)))
+            m_Allocations.pop_front();
+        if (m_Allocations.empty())
+            m_Head = 0;
+    }
+
+private:
+    struct Allocation
+    {
+        VkDeviceSize begin;
+        unsigned int id;
+        bool released;
+        bool retired;
+        unsigned long long frameNumber;
+    };
+
+    VulkanBuffer m_Buffer;
+    std::deque<Allocation> m_Allocations;
+    VkDeviceSize m_Head;
+    unsigned int m_NextId;
+};
+
+// Device memory handed out by DeviceMemoryAllocator
+struct DeviceMemoryBlock
+{
+    VkDeviceMemory memory;
+    VkDeviceSize offset;
+    VkDeviceSize size;
+    int page;       // index of the page the block lives in, -1 when the block has a vkAllocateMemory of its own
+    int order;      // the block spans 1 << order bytes of its page
+};
+
+// Buddy allocator over large device memory pages. Drivers limit the number of live vkAllocateMemory calls
+// (maxMemoryAllocationCount is 4096 on many of them) and every call is a trip into the kernel, so images are
+// placed in power of two blocks of shared pages instead. Freed blocks merge with their buddy right away.
+class DeviceMemoryAllocator
+{
+public:
+    static const int kMinOrder = 12;    // 4KB, smallest block handed out
+    static const int kPageOrder = 26;   // 64MB, requests bigger than a page get memory of their own
+
+    DeviceMemoryAllocator() : m_Device(VK_NULL_HANDLE), m_MemoryProperties(), m_Granularity(1) { }
+
+    void Initialize(VkDevice device, const VkPhysicalDeviceMemoryProperties& memoryProperties, VkDeviceSize bufferImageGranularity)
+    {
+        m_Device = device;
+        m_MemoryProperties = memoryProperties;
+        m_Granularity = bufferImageGranularity > 0 ? bufferImageGranularity : 1;
+    }
+
+    const VkPhysicalDeviceMemoryProperties& MemoryProperties() const { return m_MemoryProperties; }
+
+    bool Allocate(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties, DeviceMemoryBlock* outBlock)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        *outBlock = DeviceMemoryBlock();
+        outBlock->page = -1;
+
+        const int memoryTypeIndex = FindMemoryTypeIndex(m_MemoryProperties, requirements, properties);
+        if (memoryTypeIndex < 0)
+            return false;
+
+        // Blocks are aligned to their own size, so rounding up to bufferImageGranularity as well keeps optimal images from
+        // sharing a granularity page with linear resources placed in the same memory.
+        const VkDeviceSize alignment = requirements.alignment > m_Granularity ? requirements.alignment : m_Granularity;
+        const int order = BlockOrder(requirements.size > alignment ? requirements.size : alignment);
+
+        if (order <= kPageOrder)
+        {
+            for (size_t i = 0; i < m_Pages.size(); ++i)
+            {
+                Page& page = m_Pages[i];
+                if (page.memory != VK_NULL_HANDLE && page.memoryTypeIndex == (uint32_t)memoryTypeIndex && AllocateFromPage(page, order, &outBlock->offset))
+                {
+                    outBlock->page = (int)i;
+                    break;
+                }
+            }
+            if (outBlock->page < 0)
+            {
+                const int pageIndex = CreatePage(memoryTypeIndex);
+                if (pageIndex >= 0)
+                {
+                    AllocateFromPage(m_Pages[pageIndex], order, &outBlock->offset);
+                    outBlock->page = pageIndex;
+                }
+            }
+        }
+
+        if (outBlock->page >= 0)
+        {
+            outBlock->memory = m_Pages[outBlock->page].memory;
+            outBlock->size = (VkDeviceSize)1 << order;
+            outBlock->order = order;
+            return true;
+        }
+
+        // Too big for a page or out of room for a new one, try a dedicated allocation of the exact size
+        VkMemoryAllocateInfo memoryAllocateInfo;
+        memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        memoryAllocateInfo.pNext = NULL;
+        memoryAllocateInfo.memoryTypeIndex = memoryTypeIndex;
+        memoryAllocateInfo.allocationSize = requirements.size;
+        if (vkAllocateMemory(m_Device, &memoryAllocateInfo, NULL, &outBlock->memory) != VK_SUCCESS)
+            return false;
+        outBlock->offset = 0;
+        outBlock->size = requirements.size;
+        return true;
+    }
+
+    void Free(const DeviceMemoryBlock& block)
+    {
+        if (block.memory == VK_NULL_HANDLE)
+            return;
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (block.page < 0)
+        {
+            vkFreeMemory(m_Device, block.memory, NULL);
+            return;
+        }
+
+        Page& page = m_Pages[block.page];
+        VkDeviceSize offset = block.offset;
+        int order = block.order;
+        while (order < kPageOrder)
+        {
+            std::set<VkDeviceSize>& freeBlocks = page.freeBlocks[order - kMinOrder];
+            std::set<VkDeviceSize>::iterator buddy = freeBlocks.find(offset ^ ((VkDeviceSize)1 << order));
+            if (buddy == freeBlocks.end())
+                break;
+            freeBlocks.erase(buddy);
+            offset &= ~((VkDeviceSize)1 << order);
+            ++order;
+        }
+        page.freeBlocks[order - kMinOrder].insert(offset);
+
+        // Keep one empty page per memory type around so creating and destroying a single texture does not allocate every time
+        if (--page.allocationCount == 0)
+        {
+            for (size_t i = 0; i < m_Pages.size(); ++i)
+            {
+                if ((int)i != block.page && m_Pages[i].memory != VK_NULL_HANDLE && m_Pages[i].memoryTypeIndex == page.memoryTypeIndex && m_Pages[i].allocationCount == 0)
+                {
+                    DestroyPage(page);
+                    break;
+                }
+            }
+        }
+    }
+
+    // Frees every page, blocks still in use become invalid
+    void Destroy()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        for (size_t i = 0; i < m_Pages.size(); ++i)
+            DestroyPage(m_Pages[i]);
+        m_Pages.clear();
+        m_Device = VK_NULL_HANDLE;
+    }
+
+private:
+    struct Page
+    {
+        VkDeviceMemory memory;              // VK_NULL_HANDLE for a destroyed page waiting to be reused
+        uint32_t memoryTypeIndex;
+        int allocationCount;
+        std::set<VkDeviceSize> freeBlocks[kPageOrder - kMinOrder + 1];   // offsets of free blocks by order
+    };
+
+    static int BlockOrder(VkDeviceSize size)
+    {
+        int order = kMinOrder;
+        while (((VkDeviceSize)1 << order) < size)
+            ++order;
+        return order;
+    }
+
+    bool AllocateFromPage(Page& page, int order, VkDeviceSize* outOffset)
+    {
+        int freeOrder = order;
+        while (freeOrder <= kPageOrder && page.freeBlocks[freeOrder - kMinOrder].empty())
+            ++freeOrder;
+        if (freeOrder > kPageOrder)
+            return false;
+
+        std::set<VkDeviceSize>& freeBlocks = page.freeBlocks[freeOrder - kMinOrder];
+        const VkDeviceSize offset = *freeBlocks.begin();
+        freeBlocks.erase(freeBlocks.begin());
+
+        // Split down to the requested size, keeping the upper halves free
+        while (freeOrder > order)
+        {
+            --freeOrder;
+            page.freeBlocks[freeOrder - kMinOrder].insert(offset + ((VkDeviceSize)1 << freeOrder));
+        }
+
+        ++page.allocationCount;
+        *outOffset = offset;
+        return true;
+    }
+
+    int CreatePage(int memoryTypeIndex)
+    {
+        VkMemoryAllocateInfo memoryAllocateInfo;
+        memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        memoryAllocateInfo.pNext = NULL;
+        memoryAllocateInfo.memoryTypeIndex = memoryTypeIndex;
+        memoryAllocateInfo.allocationSize = (VkDeviceSize)1 << kPageOrder;
+
+        VkDeviceMemory memory;
+        if (vkAllocateMemory(m_Device, &memoryAllocateInfo, NULL, &memory) != VK_SUCCESS)
+            return -1;
+
+        size_t index = 0;
+        while (index < m_Pages.size() && m_Pages[index].memory != VK_NULL_HANDLE)
+            ++index;
+        if (index == m_Pages.size())
+            m_Pages.push_back(Page());
+
+        Page& page = m_Pages[index];
+        page.memory = memory;
+        page.memoryTypeIndex = memoryTypeIndex;
+        page.allocationCount = 0;
+        page.freeBlocks[kPageOrder - kMinOrder].insert(0);
+        return (int)index;
+    }
+
+    void DestroyPage(Page& page)
+    {
+        if (page.memory != VK_NULL_HANDLE)
+            vkFreeMemory(m_Device, page.memory, NULL);
+        page.memory = VK_NULL_HANDLE;
+        page.allocationCount = 0;
+        for (int i = 0; i <= kPageOrder - kMinOrder; ++i)
+            page.freeBlocks[i].clear();
+    }
+
+    VkDevice m_Device;
+    VkPhysicalDeviceMemoryProperties m_MemoryProperties;
+    VkDeviceSize m_Granularity;
+    std::vector<Page> m_Pages;
+    std::mutex m_Mutex;     // images are created on the main thread and retired on the render thread
+};
+
+// Records of the images created by this plugin, stored as structure of arrays in fixed size chunks. Chunks never move,
+// so the address of a record's VkImage can be handed to Unity, and walking every record only touches the fields needed.
+// Released slots are handed out again before the table grows.
+class PluginImageTable
+{
+public:
+    static const unsigned int kNoSlot = ~0u;
+    static const int kChunkBits = 8;
+    static const unsigned int kChunkSize = 1u << kChunkBits;
+    static const unsigned int kMaxChunks = 8192;
+
+    PluginImageTable() : m_SlotCount(0) { memset(m_Chunks, 0, sizeof(m_Chunks)); }
+    ~PluginImageTable() { Clear(); }
+
+    // Returns kNoSlot once kMaxChunks are in use. The fields of the new slot are zeroed.
+    unsigned int Allocate()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        unsigned int slot;
+        if (!m_FreeSlots.empty())
+        {
+            slot = m_FreeSlots.back();
+            m_FreeSlots.pop_back();
+        }
+        else
+        {
+            if (m_SlotCount == kMaxChunks * kChunkSize)
+                return kNoSlot;
+            slot = m_SlotCount;
+            if (m_Chunks[slot >> kChunkBits] == NULL)
+                m_Chunks[slot >> kChunkBits] = new Chunk();
+            m_SlotCount = slot + 1;
+        }
+
+        Chunk& chunk = ChunkOf(slot);
+        const unsigned int i = slot & (kChunkSize - 1);
+        chunk.image[i] = VK_NULL_HANDLE;
+        chunk.memory[i] = DeviceMemoryBlock();
+        chunk.format[i] = VK_FORMAT_UNDEFINED;
+        chunk.extent[i] = VkExtent3D();
+        chunk.usage[i] = 0;
+        chunk.mipLevels[i] = 0;
+        chunk.arrayLayers[i] = 0;
+        chunk.pendingWrite[i] = false;
+        chunk.pendingRead[i] = false;
+        chunk.verifiedBatch[i] = 0;
+        return slot;
+    }
+
+    void Release(unsigned int slot)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        ChunkOf(slot).image[slot & (kChunkSize - 1)] = VK_NULL_HANDLE;
+        m_FreeSlots.push_back(slot);
+    }
+
+    // Slots below this have been handed out at some point, released ones have a VK_NULL_HANDLE image
+    unsigned int SlotCount() const { return m_SlotCount; }
+
+    void Clear()
+    {
+        for (unsigned int i = 0; i < kMaxChunks && m_Chunks[i] != NULL; ++i)
+        {
+            delete m_Chunks[i];
+            m_Chunks[i] = NULL;
+        }
+        m_FreeSlots.clear();
+        m_SlotCount = 0;
+    }
+
+    VkImage& Image(unsigned int slot) { return ChunkOf(slot).image[slot & (kChunkSize - 1)]; }
+    DeviceMemoryBlock& Memory(unsigned int slot) { return ChunkOf(slot).memory[slot & (kChunkSize - 1)]; }
+    VkFormat& Format(unsigned int slot) { return ChunkOf(slot).format[slot & (kChunkSize - 1)]; }
+    VkExtent3D& Extent(unsigned int slot) { return ChunkOf(slot).extent[slot & (kChunkSize - 1)]; }
+    VkImageUsageFlags& Usage(unsigned int slot) { return ChunkOf(slot).usage[slot & (kChunkSize - 1)]; }
+    uint32_t& MipLevels(unsigned int slot) { return ChunkOf(slot).mipLevels[slot & (kChunkSize - 1)]; }
+    uint32_t& ArrayLayers(unsigned int slot) { return ChunkOf(slot).arrayLayers[slot & (kChunkSize - 1)]; }
+    bool& PendingWrite(unsigned int slot) { return ChunkOf(slot).pendingWrite[slot & (kChunkSize - 1)]; }
+    bool& PendingRead(unsigned int slot) { return ChunkOf(slot).pendingRead[slot & (kChunkSize - 1)]; }
+    unsigned long long& VerifiedBatch(unsigned int slot) { return ChunkOf(slot).verifiedBatch[slot & (kChunkSize - 1)]; }
+
+private:
+    struct Chunk
+    {
+        VkImage image[kChunkSize];
+        DeviceMemoryBlock memory[kChunkSize];
+        VkFormat format[kChunkSize];
+        VkExtent3D extent[kChunkSize];
+        VkImageUsageFlags usage[kChunkSize];
+        uint32_t mipLevels[kChunkSize];
+        uint32_t arrayLayers[kChunkSize];
+        bool pendingWrite[kChunkSize];                  // written by a transfer that no barrier has made visible yet
+        bool pendingRead[kChunkSize];                   // read by a transfer that no barrier has ordered against later writes yet
+        unsigned long long verifiedBatch[kChunkSize];   // last transfer batch the layout was checked against Unity's tracking
+    };
+
+    Chunk& ChunkOf(unsigned int slot) { return *m_Chunks[slot >> kChunkBits]; }
+
+    Chunk* m_Chunks[kMaxChunks];
+    std::vector<unsigned int> m_FreeSlots;
+    unsigned int m_SlotCount;
+    std::mutex m_Mutex;     // images are created on any thread and destroyed on the render thread
+};
+
 static VkPipelineLayout CreateTrianglePipelineLayout(VkDevice device)
 {
     VkPushConstantRange pushConstantRange;
@@ -296,55 +974,3942 @@ const uint32_t fragmentShaderSpirv[] = {
     0x00000007,0x0000000c,0x0000000b,0x0003003e,
     0x00000009,0x0000000c,0x000100fd,0x00010038
 };
-} // namespace Shader
 
-static VkPipeline CreateTrianglePipeline(VkDevice device, VkPipelineLayout pipelineLayout, VkRenderPass renderPass, VkPipelineCache pipelineCache)
+// Source of compute shader converting the texels of one storage buffer range into another (filename: convert.comp)
+/*
+#version 450
+layout(local_size_x = 8, local_size_y = 8) in;
+layout(std430, binding = 0) readonly buffer Source { uint texels[]; } source;
+layout(std430, binding = 1) buffer Destination { uint texels[]; } destination;
+layout(push_constant) uniform Params
 {
-    if (pipelineLayout == VK_NULL_HANDLE)
-        return VK_NULL_HANDLE;  
-    if (device == VK_NULL_HANDLE)
-        return VK_NULL_HANDLE;
-    if (renderPass == VK_NULL_HANDLE)
-        return VK_NULL_HANDLE;
+    uint width;
+    uint height;
+    uint sourceFormat;
+    uint destinationFormat;
+    uint flags;
+    uint swizzle;
+} params;
 
-    bool success = true;
-    VkGraphicsPipelineCreateInfo pipelineCreateInfo = {};
-     
-    VkPipelineShaderStageCreateInfo shaderStages[2] = {};
-    shaderStages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    shaderStages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
-    shaderStages[0].pName = "main";
-    shaderStages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-    shaderStages[1].pName = "main";
-    
-    if (success)
+// Texel formats: 0 RGBA8, 1 BGRA8, 2 RGBA16F, 3 RGBA32F, +4 for the sRGB 8 bit ones
+float toLinear(float c)
+{
+    return c <= 0.04045 ? c / 12.92 : pow((max(c, 0.0) + 0.055) / 1.055, 2.4);
+}
+
+float toSRGB(float c)
+{
+    return c <= 0.0031308 ? c * 12.92 : 1.055 * pow(max(c, 0.0), 1.0 / 2.4) - 0.055;
+}
+
+vec4 loadTexel(uint index, uint format)
+{
+    vec4 color;
+    if ((format & 3u) == 2u)
+        color = vec4(unpackHalf2x16(source.texels[index * 2u]), unpackHalf2x16(source.texels[index * 2u + 1u]));
+    else if ((format & 3u) == 3u)
+        color = uintBitsToFloat(uvec4(source.texels[index * 4u], source.texels[index * 4u + 1u], source.texels[index * 4u + 2u], source.texels[index * 4u + 3u]));
+    else
     {
-        VkShaderModuleCreateInfo moduleCreateInfo = {};
-        moduleCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-        moduleCreateInfo.codeSize = sizeof(Shader::vertexShaderSpirv);
-        moduleCreateInfo.pCode = Shader::vertexShaderSpirv;
-        success = vkCreateShaderModule(device, &moduleCreateInfo, NULL, &shaderStages[0].module) == VK_SUCCESS;
+        color = unpackUnorm4x8(source.texels[index]);
+        if ((format & 3u) == 1u)
+            color = color.bgra;
+        if ((format & 4u) != 0u)
+            color.rgb = vec3(toLinear(color.r), toLinear(color.g), toLinear(color.b));
     }
+    return color;
+}
 
-    if (success)
+void storeTexel(uint index, uint format, vec4 color)
+{
+    if ((format & 3u) == 2u)
     {
-        VkShaderModuleCreateInfo moduleCreateInfo = {};
-        moduleCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-        moduleCreateInfo.codeSize = sizeof(Shader::fragmentShaderSpirv);
-        moduleCreateInfo.pCode = Shader::fragmentShaderSpirv;
-        success = vkCreateShaderModule(device, &moduleCreateInfo, NULL, &shaderStages[1].module) == VK_SUCCESS;
+        destination.texels[index * 2u] = packHalf2x16(color.rg);
+        destination.texels[index * 2u + 1u] = packHalf2x16(color.ba);
     }
-
-    VkPipeline pipeline;
-    if (success)
+    else if ((format & 3u) == 3u)
     {
-        pipelineCreateInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-        pipelineCreateInfo.layout = pipelineLayout;
-        pipelineCreateInfo.renderPass = renderPass;
+        uvec4 bits = floatBitsToUint(color);
+        destination.texels[index * 4u] = bits.x;
+        destination.texels[index * 4u + 1u] = bits.y;
+        destination.texels[index * 4u + 2u] = bits.z;
+        destination.texels[index * 4u + 3u] = bits.w;
+    }
+    else
+    {
+        if ((format & 4u) != 0u)
+            color.rgb = vec3(toSRGB(color.r), toSRGB(color.g), toSRGB(color.b));
+        if ((format & 3u) == 1u)
+            color = color.bgra;
+        destination.texels[index] = packUnorm4x8(color);
+    }
+}
 
-        VkPipelineInputAssemblyStateCreateInfo inputAssemblyState = {};
-        inputAssemblyState.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+void main()
+{
+    uvec2 pixel = gl_GlobalInvocationID.xy;
+    if (pixel.x >= params.width || pixel.y >= params.height)
+        return;
+    uint index = pixel.y * params.width + pixel.x;
+    vec4 color = loadTexel(index, params.sourceFormat);
+    if ((params.flags & 1u) != 0u)
+    {
+        float channels[6] = float[6](color.r, color.g, color.b, color.a, 0.0, 1.0);
+        color = vec4(channels[params.swizzle & 15u], channels[(params.swizzle >> 4u) & 15u], channels[(params.swizzle >> 8u) & 15u], channels[(params.swizzle >> 12u) & 15u]);
+    }
+    if ((params.flags & 2u) != 0u)
+        color.rgb = vec3(toLinear(color.r), toLinear(color.g), toLinear(color.b));
+    if ((params.flags & 4u) != 0u)
+        color.rgb *= color.a;
+    if ((params.flags & 8u) != 0u)
+        color.rgb = vec3(toSRGB(color.r), toSRGB(color.g), toSRGB(color.b));
+    storeTexel(index, params.destinationFormat, color);
+}
+*/
+// SPIR-V 1.0, to rebuild from the source:
+// %VULKAN_SDK%\bin\glslc -mfmt=num convert.comp -c
+
+const uint32_t convertShaderSpirv[] = {
+	0x07230203,0x00010000,0x00000000,0x0000018a,
+	0x00000000,0x00020011,0x00000001,0x0006000b,
+	0x00000001,0x4c534c47,0x6474732e,0x3035342e,
+	0x00000000,0x0003000e,0x00000000,0x00000001,
+	0x0006000f,0x00000005,0x00000014,0x6e69616d,
+	0x00000000,0x0000000d,0x00060010,0x00000014,
+	0x00000011,0x00000008,0x00000008,0x00000001,
+	0x00030003,0x00000002,0x000001c2,0x00040005,
+	0x00000004,0x72756f53,0x00006563,0x00050006,
+	0x00000004,0x00000000,0x65786574,0x0000736c,
+	0x00040005,0x00000005,0x72756f73,0x00006563,
+	0x00050005,0x00000007,0x74736544,0x74616e69,
+	0x006e6f69,0x00050006,0x00000007,0x00000000,
+	0x65786574,0x0000736c,0x00050005,0x00000008,
+	0x74736564,0x74616e69,0x006e6f69,0x00040005,
+	0x0000000a,0x61726150,0x0000736d,0x00050006,
+	0x0000000a,0x00000000,0x74646977,0x00000068,
+	0x00050006,0x0000000a,0x00000001,0x67696568,
+	0x00007468,0x00070006,0x0000000a,0x00000002,
+	0x72756f73,0x6f466563,0x74616d72,0x00000000,
+	0x00080006,0x0000000a,0x00000003,0x74736564,
+	0x74616e69,0x466e6f69,0x616d726f,0x00000074,
+	0x00050006,0x0000000a,0x00000004,0x67616c66,
+	0x00000073,0x00050006,0x0000000a,0x00000005,
+	0x7a697773,0x00656c7a,0x00040005,0x0000000b,
+	0x61726170,0x0000736d,0x00080005,0x0000000d,
+	0x475f6c67,0x61626f6c,0x766e496c,0x7461636f,
+	0x496e6f69,0x00000044,0x00050005,0x00000010,
+	0x694c6f74,0x7261656e,0x00000000,0x00040005,
+	0x00000011,0x52536f74,0x00004247,0x00050005,
+	0x00000012,0x64616f6c,0x65786554,0x0000006c,
+	0x00050005,0x00000013,0x726f7473,0x78655465,
+	0x00006c65,0x00040005,0x00000014,0x6e69616d,
+	0x00000000,0x00040047,0x00000003,0x00000006,
+	0x00000004,0x00030047,0x00000004,0x00000003,
+	0x00050048,0x00000004,0x00000000,0x00000023,
+	0x00000000,0x00040048,0x00000004,0x00000000,
+	0x00000018,0x00040047,0x00000005,0x00000022,
+	0x00000000,0x00040047,0x00000005,0x00000021,
+	0x00000000,0x00030047,0x00000007,0x00000003,
+	0x00050048,0x00000007,0x00000000,0x00000023,
+	0x00000000,0x00040047,0x00000008,0x00000022,
+	0x00000000,0x00040047,0x00000008,0x00000021,
+	0x00000001,0x00030047,0x0000000a,0x00000002,
+	0x00050048,0x0000000a,0x00000000,0x00000023,
+	0x00000000,0x00050048,0x0000000a,0x00000001,
+	0x00000023,0x00000004,0x00050048,0x0000000a,
+	0x00000002,0x00000023,0x00000008,0x00050048,
+	0x0000000a,0x00000003,0x00000023,0x0000000c,
+	0x00050048,0x0000000a,0x00000004,0x00000023,
+	0x00000010,0x00050048,0x0000000a,0x00000005,
+	0x00000023,0x00000014,0x00040047,0x0000000d,
+	0x0000000b,0x0000001c,0x00040015,0x00000002,
+	0x00000020,0x00000000,0x0003001d,0x00000003,
+	0x00000002,0x0003001e,0x00000004,0x00000003,
+	0x00040020,0x00000006,0x00000002,0x00000004,
+	0x0004003b,0x00000006,0x00000005,0x00000002,
+	0x0003001e,0x00000007,0x00000003,0x00040020,
+	0x00000009,0x00000002,0x00000007,0x0004003b,
+	0x00000009,0x00000008,0x00000002,0x0008001e,
+	0x0000000a,0x00000002,0x00000002,0x00000002,
+	0x00000002,0x00000002,0x00000002,0x00040020,
+	0x0000000c,0x00000009,0x0000000a,0x0004003b,
+	0x0000000c,0x0000000b,0x00000009,0x00040017,
+	0x0000000e,0x00000002,0x00000003,0x00040020,
+	0x0000000f,0x00000001,0x0000000e,0x0004003b,
+	0x0000000f,0x0000000d,0x00000001,0x00030016,
+	0x00000015,0x00000020,0x00040020,0x00000016,
+	0x00000007,0x00000015,0x00040021,0x00000017,
+	0x00000015,0x00000016,0x0004002b,0x00000015,
+	0x0000001b,0x3d25aee6,0x00020014,0x0000001d,
+	0x0004002b,0x00000015,0x0000001f,0x414eb852,
+	0x0004002b,0x00000015,0x00000022,0x00000000,
+	0x0004002b,0x00000015,0x00000024,0x3d6147ae,
+	0x0004002b,0x00000015,0x00000026,0x3f870a3d,
+	0x0004002b,0x00000015,0x00000028,0x4019999a,
+	0x0004002b,0x00000015,0x0000002e,0x3b4d2e1c,
+	0x0004002b,0x00000015,0x00000034,0x3f800000,
+	0x00040017,0x0000003a,0x00000015,0x00000004,
+	0x00040020,0x0000003b,0x00000007,0x00000002,
+	0x00050021,0x0000003c,0x0000003a,0x0000003b,
+	0x0000003b,0x00040020,0x00000041,0x00000007,
+	0x0000003a,0x0004002b,0x00000002,0x00000043,
+	0x00000003,0x0004002b,0x00000002,0x00000045,
+	0x00000002,0x00040015,0x0000004a,0x00000020,
+	0x00000001,0x0004002b,0x0000004a,0x0000004b,
+	0x00000000,0x00040020,0x0000004f,0x00000002,
+	0x00000002,0x00040017,0x00000052,0x00000015,
+	0x00000002,0x0004002b,0x00000002,0x00000055,
+	0x00000001,0x0004002b,0x00000002,0x00000062,
+	0x00000004,0x00040017,0x00000076,0x00000002,
+	0x00000004,0x0004002b,0x00000002,0x00000085,
+	0x00000000,0x0004002b,0x0000004a,0x0000008e,
+	0x00000001,0x0004002b,0x0000004a,0x00000093,
+	0x00000002,0x00040017,0x00000098,0x00000015,
+	0x00000003,0x00020013,0x0000009c,0x00060021,
+	0x0000009d,0x0000009c,0x0000003b,0x0000003b,
+	0x00000041,0x00040020,0x000000bc,0x00000007,
+	0x00000076,0x0004002b,0x0000004a,0x000000d3,
+	0x00000003,0x00030021,0x000000f6,0x0000009c,
+	0x00040017,0x000000f9,0x00000002,0x00000002,
+	0x00040020,0x000000fa,0x00000007,0x000000f9,
+	0x00040020,0x00000100,0x00000009,0x00000002,
+	0x0004002b,0x0000004a,0x0000011b,0x00000004,
+	0x0004002b,0x00000002,0x00000123,0x00000006,
+	0x0004001c,0x00000124,0x00000015,0x00000123,
+	0x00040020,0x00000125,0x00000007,0x00000124,
+	0x0004002b,0x0000004a,0x0000012f,0x00000005,
+	0x0004002b,0x00000002,0x00000132,0x0000000f,
+	0x0004002b,0x00000002,0x0000013e,0x00000008,
+	0x0004002b,0x00000002,0x00000145,0x0000000c,
+	0x00050036,0x00000015,0x00000010,0x00000000,
+	0x00000017,0x00030037,0x00000016,0x00000018,
+	0x000200f8,0x00000019,0x0004003d,0x00000015,
+	0x0000001a,0x00000018,0x000500bc,0x0000001d,
+	0x0000001c,0x0000001a,0x0000001b,0x0004003d,
+	0x00000015,0x0000001e,0x00000018,0x00050088,
+	0x00000015,0x00000020,0x0000001e,0x0000001f,
+	0x0004003d,0x00000015,0x00000021,0x00000018,
+	0x0007000c,0x00000015,0x00000023,0x00000001,
+	0x00000028,0x00000021,0x00000022,0x00050081,
+	0x00000015,0x00000025,0x00000023,0x00000024,
+	0x00050088,0x00000015,0x00000027,0x00000025,
+	0x00000026,0x0007000c,0x00000015,0x00000029,
+	0x00000001,0x0000001a,0x00000027,0x00000028,
+	0x000600a9,0x00000015,0x0000002a,0x0000001c,
+	0x00000020,0x00000029,0x000200fe,0x0000002a,
+	0x00010038,0x00050036,0x00000015,0x00000011,
+	0x00000000,0x00000017,0x00030037,0x00000016,
+	0x0000002b,0x000200f8,0x0000002c,0x0004003d,
+	0x00000015,0x0000002d,0x0000002b,0x000500bc,
+	0x0000001d,0x0000002f,0x0000002d,0x0000002e,
+	0x0004003d,0x00000015,0x00000030,0x0000002b,
+	0x00050085,0x00000015,0x00000031,0x00000030,
+	0x0000001f,0x0004003d,0x00000015,0x00000032,
+	0x0000002b,0x0007000c,0x00000015,0x00000033,
+	0x00000001,0x00000028,0x00000032,0x00000022,
+	0x00050088,0x00000015,0x00000035,0x00000034,
+	0x00000028,0x0007000c,0x00000015,0x00000036,
+	0x00000001,0x0000001a,0x00000033,0x00000035,
+	0x00050085,0x00000015,0x00000037,0x00000026,
+	0x00000036,0x00050083,0x00000015,0x00000038,
+	0x00000037,0x00000024,0x000600a9,0x00000015,
+	0x00000039,0x0000002f,0x00000031,0x00000038,
+	0x000200fe,0x00000039,0x00010038,0x00050036,
+	0x0000003a,0x00000012,0x00000000,0x0000003c,
+	0x00030037,0x0000003b,0x0000003d,0x00030037,
+	0x0000003b,0x0000003e,0x000200f8,0x0000003f,
+	0x0004003b,0x00000041,0x00000040,0x00000007,
+	0x0004003b,0x00000016,0x00000089,0x00000007,
+	0x0004003b,0x00000016,0x0000008d,0x00000007,
+	0x0004003b,0x00000016,0x00000092,0x00000007,
+	0x0004003d,0x00000002,0x00000042,0x0000003e,
+	0x000500c7,0x00000002,0x00000044,0x00000042,
+	0x00000043,0x000500aa,0x0000001d,0x00000046,
+	0x00000044,0x00000045,0x000300f7,0x00000047,
+	0x00000000,0x000400fa,0x00000046,0x00000048,
+	0x00000049,0x000200f8,0x00000048,0x0004003d,
+	0x00000002,0x0000004c,0x0000003d,0x00050084,
+	0x00000002,0x0000004d,0x0000004c,0x00000045,
+	0x00060041,0x0000004f,0x0000004e,0x00000005,
+	0x0000004b,0x0000004d,0x0004003d,0x00000002,
+	0x00000050,0x0000004e,0x0006000c,0x00000052,
+	0x00000051,0x00000001,0x0000003e,0x00000050,
+	0x0004003d,0x00000002,0x00000053,0x0000003d,
+	0x00050084,0x00000002,0x00000054,0x00000053,
+	0x00000045,0x00050080,0x00000002,0x00000056,
+	0x00000054,0x00000055,0x00060041,0x0000004f,
+	0x00000057,0x00000005,0x0000004b,0x00000056,
+	0x0004003d,0x00000002,0x00000058,0x00000057,
+	0x0006000c,0x00000052,0x00000059,0x00000001,
+	0x0000003e,0x00000058,0x00050050,0x0000003a,
+	0x0000005a,0x00000051,0x00000059,0x0003003e,
+	0x00000040,0x0000005a,0x000200f9,0x00000047,
+	0x000200f8,0x00000049,0x0004003d,0x00000002,
+	0x0000005b,0x0000003e,0x000500c7,0x00000002,
+	0x0000005c,0x0000005b,0x00000043,0x000500aa,
+	0x0000001d,0x0000005d,0x0000005c,0x00000043,
+	0x000300f7,0x0000005e,0x00000000,0x000400fa,
+	0x0000005d,0x0000005f,0x00000060,0x000200f8,
+	0x0000005f,0x0004003d,0x00000002,0x00000061,
+	0x0000003d,0x00050084,0x00000002,0x00000063,
+	0x00000061,0x00000062,0x00060041,0x0000004f,
+	0x00000064,0x00000005,0x0000004b,0x00000063,
+	0x0004003d,0x00000002,0x00000065,0x00000064,
+	0x0004003d,0x00000002,0x00000066,0x0000003d,
+	0x00050084,0x00000002,0x00000067,0x00000066,
+	0x00000062,0x00050080,0x00000002,0x00000068,
+	0x00000067,0x00000055,0x00060041,0x0000004f,
+	0x00000069,0x00000005,0x0000004b,0x00000068,
+	0x0004003d,0x00000002,0x0000006a,0x00000069,
+	0x0004003d,0x00000002,0x0000006b,0x0000003d,
+	0x00050084,0x00000002,0x0000006c,0x0000006b,
+	0x00000062,0x00050080,0x00000002,0x0000006d,
+	0x0000006c,0x00000045,0x00060041,0x0000004f,
+	0x0000006e,0x00000005,0x0000004b,0x0000006d,
+	0x0004003d,0x00000002,0x0000006f,0x0000006e,
+	0x0004003d,0x00000002,0x00000070,0x0000003d,
+	0x00050084,0x00000002,0x00000071,0x00000070,
+	0x00000062,0x00050080,0x00000002,0x00000072,
+	0x00000071,0x00000043,0x00060041,0x0000004f,
+	0x00000073,0x00000005,0x0000004b,0x00000072,
+	0x0004003d,0x00000002,0x00000074,0x00000073,
+	0x00070050,0x00000076,0x00000075,0x00000065,
+	0x0000006a,0x0000006f,0x00000074,0x0004007c,
+	0x0000003a,0x00000077,0x00000075,0x0003003e,
+	0x00000040,0x00000077,0x000200f9,0x0000005e,
+	0x000200f8,0x00000060,0x0004003d,0x00000002,
+	0x00000078,0x0000003d,0x00060041,0x0000004f,
+	0x00000079,0x00000005,0x0000004b,0x00000078,
+	0x0004003d,0x00000002,0x0000007a,0x00000079,
+	0x0006000c,0x0000003a,0x0000007b,0x00000001,
+	0x00000040,0x0000007a,0x0003003e,0x00000040,
+	0x0000007b,0x0004003d,0x00000002,0x0000007c,
+	0x0000003e,0x000500c7,0x00000002,0x0000007d,
+	0x0000007c,0x00000043,0x000500aa,0x0000001d,
+	0x0000007e,0x0000007d,0x00000055,0x000300f7,
+	0x0000007f,0x00000000,0x000400fa,0x0000007e,
+	0x00000080,0x0000007f,0x000200f8,0x00000080,
+	0x0004003d,0x0000003a,0x00000081,0x00000040,
+	0x0009004f,0x0000003a,0x00000082,0x00000081,
+	0x00000081,0x00000002,0x00000001,0x00000000,
+	0x00000003,0x0003003e,0x00000040,0x00000082,
+	0x000200f9,0x0000007f,0x000200f8,0x0000007f,
+	0x0004003d,0x00000002,0x00000083,0x0000003e,
+	0x000500c7,0x00000002,0x00000084,0x00000083,
+	0x00000062,0x000500ab,0x0000001d,0x00000086,
+	0x00000084,0x00000085,0x000300f7,0x00000087,
+	0x00000000,0x000400fa,0x00000086,0x00000088,
+	0x00000087,0x000200f8,0x00000088,0x00050041,
+	0x00000016,0x0000008a,0x00000040,0x0000004b,
+	0x0004003d,0x00000015,0x0000008b,0x0000008a,
+	0x0003003e,0x00000089,0x0000008b,0x00050039,
+	0x00000015,0x0000008c,0x00000010,0x00000089,
+	0x00050041,0x00000016,0x0000008f,0x00000040,
+	0x0000008e,0x0004003d,0x00000015,0x00000090,
+	0x0000008f,0x0003003e,0x0000008d,0x00000090,
+	0x00050039,0x00000015,0x00000091,0x00000010,
+	0x0000008d,0x00050041,0x00000016,0x00000094,
+	0x00000040,0x00000093,0x0004003d,0x00000015,
+	0x00000095,0x00000094,0x0003003e,0x00000092,
+	0x00000095,0x00050039,0x00000015,0x00000096,
+	0x00000010,0x00000092,0x00060050,0x00000098,
+	0x00000097,0x0000008c,0x00000091,0x00000096,
+	0x0004003d,0x0000003a,0x00000099,0x00000040,
+	0x0009004f,0x0000003a,0x0000009a,0x00000099,
+	0x00000097,0x00000004,0x00000005,0x00000006,
+	0x00000003,0x0003003e,0x00000040,0x0000009a,
+	0x000200f9,0x00000087,0x000200f8,0x00000087,
+	0x000200f9,0x0000005e,0x000200f8,0x0000005e,
+	0x000200f9,0x00000047,0x000200f8,0x00000047,
+	0x0004003d,0x0000003a,0x0000009b,0x00000040,
+	0x000200fe,0x0000009b,0x00010038,0x00050036,
+	0x0000009c,0x00000013,0x00000000,0x0000009d,
+	0x00030037,0x0000003b,0x0000009e,0x00030037,
+	0x0000003b,0x0000009f,0x00030037,0x00000041,
+	0x000000a0,0x000200f8,0x000000a1,0x0004003b,
+	0x000000bc,0x000000bb,0x00000007,0x0004003b,
+	0x00000016,0x000000dc,0x00000007,0x0004003b,
+	0x00000016,0x000000e0,0x00000007,0x0004003b,
+	0x00000016,0x000000e4,0x00000007,0x0004003d,
+	0x00000002,0x000000a2,0x0000009f,0x000500c7,
+	0x00000002,0x000000a3,0x000000a2,0x00000043,
+	0x000500aa,0x0000001d,0x000000a4,0x000000a3,
+	0x00000045,0x000300f7,0x000000a5,0x00000000,
+	0x000400fa,0x000000a4,0x000000a6,0x000000a7,
+	0x000200f8,0x000000a6,0x0004003d,0x00000002,
+	0x000000a8,0x0000009e,0x00050084,0x00000002,
+	0x000000a9,0x000000a8,0x00000045,0x0004003d,
+	0x0000003a,0x000000aa,0x000000a0,0x0007004f,
+	0x00000052,0x000000ab,0x000000aa,0x000000aa,
+	0x00000000,0x00000001,0x0006000c,0x00000002,
+	0x000000ac,0x00000001,0x0000003a,0x000000ab,
+	0x00060041,0x0000004f,0x000000ad,0x00000008,
+	0x0000004b,0x000000a9,0x0003003e,0x000000ad,
+	0x000000ac,0x0004003d,0x00000002,0x000000ae,
+	0x0000009e,0x00050084,0x00000002,0x000000af,
+	0x000000ae,0x00000045,0x00050080,0x00000002,
+	0x000000b0,0x000000af,0x00000055,0x0004003d,
+	0x0000003a,0x000000b1,0x000000a0,0x0007004f,
+	0x00000052,0x000000b2,0x000000b1,0x000000b1,
+	0x00000002,0x00000003,0x0006000c,0x00000002,
+	0x000000b3,0x00000001,0x0000003a,0x000000b2,
+	0x00060041,0x0000004f,0x000000b4,0x00000008,
+	0x0000004b,0x000000b0,0x0003003e,0x000000b4,
+	0x000000b3,0x000200f9,0x000000a5,0x000200f8,
+	0x000000a7,0x0004003d,0x00000002,0x000000b5,
+	0x0000009f,0x000500c7,0x00000002,0x000000b6,
+	0x000000b5,0x00000043,0x000500aa,0x0000001d,
+	0x000000b7,0x000000b6,0x00000043,0x000300f7,
+	0x000000b8,0x00000000,0x000400fa,0x000000b7,
+	0x000000b9,0x000000ba,0x000200f8,0x000000b9,
+	0x0004003d,0x0000003a,0x000000bd,0x000000a0,
+	0x0004007c,0x00000076,0x000000be,0x000000bd,
+	0x0003003e,0x000000bb,0x000000be,0x0004003d,
+	0x00000002,0x000000bf,0x0000009e,0x00050084,
+	0x00000002,0x000000c0,0x000000bf,0x00000062,
+	0x00050041,0x0000003b,0x000000c1,0x000000bb,
+	0x0000004b,0x0004003d,0x00000002,0x000000c2,
+	0x000000c1,0x00060041,0x0000004f,0x000000c3,
+	0x00000008,0x0000004b,0x000000c0,0x0003003e,
+	0x000000c3,0x000000c2,0x0004003d,0x00000002,
+	0x000000c4,0x0000009e,0x00050084,0x00000002,
+	0x000000c5,0x000000c4,0x00000062,0x00050080,
+	0x00000002,0x000000c6,0x000000c5,0x00000055,
+	0x00050041,0x0000003b,0x000000c7,0x000000bb,
+	0x0000008e,0x0004003d,0x00000002,0x000000c8,
+	0x000000c7,0x00060041,0x0000004f,0x000000c9,
+	0x00000008,0x0000004b,0x000000c6,0x0003003e,
+	0x000000c9,0x000000c8,0x0004003d,0x00000002,
+	0x000000ca,0x0000009e,0x00050084,0x00000002,
+	0x000000cb,0x000000ca,0x00000062,0x00050080,
+	0x00000002,0x000000cc,0x000000cb,0x00000045,
+	0x00050041,0x0000003b,0x000000cd,0x000000bb,
+	0x00000093,0x0004003d,0x00000002,0x000000ce,
+	0x000000cd,0x00060041,0x0000004f,0x000000cf,
+	0x00000008,0x0000004b,0x000000cc,0x0003003e,
+	0x000000cf,0x000000ce,0x0004003d,0x00000002,
+	0x000000d0,0x0000009e,0x00050084,0x00000002,
+	0x000000d1,0x000000d0,0x00000062,0x00050080,
+	0x00000002,0x000000d2,0x000000d1,0x00000043,
+	0x00050041,0x0000003b,0x000000d4,0x000000bb,
+	0x000000d3,0x0004003d,0x00000002,0x000000d5,
+	0x000000d4,0x00060041,0x0000004f,0x000000d6,
+	0x00000008,0x0000004b,0x000000d2,0x0003003e,
+	0x000000d6,0x000000d5,0x000200f9,0x000000b8,
+	0x000200f8,0x000000ba,0x0004003d,0x00000002,
+	0x000000d7,0x0000009f,0x000500c7,0x00000002,
+	0x000000d8,0x000000d7,0x00000062,0x000500ab,
+	0x0000001d,0x000000d9,0x000000d8,0x00000085,
+	0x000300f7,0x000000da,0x00000000,0x000400fa,
+	0x000000d9,0x000000db,0x000000da,0x000200f8,
+	0x000000db,0x00050041,0x00000016,0x000000dd,
+	0x000000a0,0x0000004b,0x0004003d,0x00000015,
+	0x000000de,0x000000dd,0x0003003e,0x000000dc,
+	0x000000de,0x00050039,0x00000015,0x000000df,
+	0x00000011,0x000000dc,0x00050041,0x00000016,
+	0x000000e1,0x000000a0,0x0000008e,0x0004003d,
+	0x00000015,0x000000e2,0x000000e1,0x0003003e,
+	0x000000e0,0x000000e2,0x00050039,0x00000015,
+	0x000000e3,0x00000011,0x000000e0,0x00050041,
+	0x00000016,0x000000e5,0x000000a0,0x00000093,
+	0x0004003d,0x00000015,0x000000e6,0x000000e5,
+	0x0003003e,0x000000e4,0x000000e6,0x00050039,
+	0x00000015,0x000000e7,0x00000011,0x000000e4,
+	0x00060050,0x00000098,0x000000e8,0x000000df,
+	0x000000e3,0x000000e7,0x0004003d,0x0000003a,
+	0x000000e9,0x000000a0,0x0009004f,0x0000003a,
+	0x000000ea,0x000000e9,0x000000e8,0x00000004,
+	0x00000005,0x00000006,0x00000003,0x0003003e,
+	0x000000a0,0x000000ea,0x000200f9,0x000000da,
+	0x000200f8,0x000000da,0x0004003d,0x00000002,
+	0x000000eb,0x0000009f,0x000500c7,0x00000002,
+	0x000000ec,0x000000eb,0x00000043,0x000500aa,
+	0x0000001d,0x000000ed,0x000000ec,0x00000055,
+	0x000300f7,0x000000ee,0x00000000,0x000400fa,
+	0x000000ed,0x000000ef,0x000000ee,0x000200f8,
+	0x000000ef,0x0004003d,0x0000003a,0x000000f0,
+	0x000000a0,0x0009004f,0x0000003a,0x000000f1,
+	0x000000f0,0x000000f0,0x00000002,0x00000001,
+	0x00000000,0x00000003,0x0003003e,0x000000a0,
+	0x000000f1,0x000200f9,0x000000ee,0x000200f8,
+	0x000000ee,0x0004003d,0x00000002,0x000000f2,
+	0x0000009e,0x0004003d,0x0000003a,0x000000f3,
+	0x000000a0,0x0006000c,0x00000002,0x000000f4,
+	0x00000001,0x00000037,0x000000f3,0x00060041,
+	0x0000004f,0x000000f5,0x00000008,0x0000004b,
+	0x000000f2,0x0003003e,0x000000f5,0x000000f4,
+	0x000200f9,0x000000b8,0x000200f8,0x000000b8,
+	0x000200f9,0x000000a5,0x000200f8,0x000000a5,
+	0x000100fd,0x00010038,0x00050036,0x0000009c,
+	0x00000014,0x00000000,0x000000f6,0x000200f8,
+	0x000000f7,0x0004003b,0x000000fa,0x000000f8,
+	0x00000007,0x0004003b,0x0000003b,0x0000010b,
+	0x00000007,0x0004003b,0x00000041,0x00000114,
+	0x00000007,0x0004003b,0x0000003b,0x00000115,
+	0x00000007,0x0004003b,0x0000003b,0x00000117,
+	0x00000007,0x0004003b,0x00000125,0x00000122,
+	0x00000007,0x0004003b,0x00000016,0x00000151,
+	0x00000007,0x0004003b,0x00000016,0x00000155,
+	0x00000007,0x0004003b,0x00000016,0x00000159,
+	0x00000007,0x0004003b,0x00000016,0x00000173,
+	0x00000007,0x0004003b,0x00000016,0x00000177,
+	0x00000007,0x0004003b,0x00000016,0x0000017b,
+	0x00000007,0x0004003b,0x0000003b,0x00000182,
+	0x00000007,0x0004003b,0x0000003b,0x00000184,
+	0x00000007,0x0004003b,0x00000041,0x00000187,
+	0x00000007,0x0004003d,0x0000000e,0x000000fb,
+	0x0000000d,0x0007004f,0x000000f9,0x000000fc,
+	0x000000fb,0x000000fb,0x00000000,0x00000001,
+	0x0003003e,0x000000f8,0x000000fc,0x00050041,
+	0x0000003b,0x000000fd,0x000000f8,0x0000004b,
+	0x0004003d,0x00000002,0x000000fe,0x000000fd,
+	0x00050041,0x00000100,0x000000ff,0x0000000b,
+	0x0000004b,0x0004003d,0x00000002,0x00000101,
+	0x000000ff,0x000500ae,0x0000001d,0x00000102,
+	0x000000fe,0x00000101,0x00050041,0x0000003b,
+	0x00000103,0x000000f8,0x0000008e,0x0004003d,
+	0x00000002,0x00000104,0x00000103,0x00050041,
+	0x00000100,0x00000105,0x0000000b,0x0000008e,
+	0x0004003d,0x00000002,0x00000106,0x00000105,
+	0x000500ae,0x0000001d,0x00000107,0x00000104,
+	0x00000106,0x000500a6,0x0000001d,0x00000108,
+	0x00000102,0x00000107,0x000300f7,0x00000109,
+	0x00000000,0x000400fa,0x00000108,0x0000010a,
+	0x00000109,0x000200f8,0x0000010a,0x000100fd,
+	0x000200f8,0x00000109,0x00050041,0x0000003b,
+	0x0000010c,0x000000f8,0x0000008e,0x0004003d,
+	0x00000002,0x0000010d,0x0000010c,0x00050041,
+	0x00000100,0x0000010e,0x0000000b,0x0000004b,
+	0x0004003d,0x00000002,0x0000010f,0x0000010e,
+	0x00050084,0x00000002,0x00000110,0x0000010d,
+	0x0000010f,0x00050041,0x0000003b,0x00000111,
+	0x000000f8,0x0000004b,0x0004003d,0x00000002,
+	0x00000112,0x00000111,0x00050080,0x00000002,
+	0x00000113,0x00000110,0x00000112,0x0003003e,
+	0x0000010b,0x00000113,0x0004003d,0x00000002,
+	0x00000116,0x0000010b,0x0003003e,0x00000115,
+	0x00000116,0x00050041,0x00000100,0x00000118,
+	0x0000000b,0x00000093,0x0004003d,0x00000002,
+	0x00000119,0x00000118,0x0003003e,0x00000117,
+	0x00000119,0x00060039,0x0000003a,0x0000011a,
+	0x00000012,0x00000115,0x00000117,0x0003003e,
+	0x00000114,0x0000011a,0x00050041,0x00000100,
+	0x0000011c,0x0000000b,0x0000011b,0x0004003d,
+	0x00000002,0x0000011d,0x0000011c,0x000500c7,
+	0x00000002,0x0000011e,0x0000011d,0x00000055,
+	0x000500ab,0x0000001d,0x0000011f,0x0000011e,
+	0x00000085,0x000300f7,0x00000120,0x00000000,
+	0x000400fa,0x0000011f,0x00000121,0x00000120,
+	0x000200f8,0x00000121,0x00050041,0x00000016,
+	0x00000126,0x00000114,0x0000004b,0x0004003d,
+	0x00000015,0x00000127,0x00000126,0x00050041,
+	0x00000016,0x00000128,0x00000114,0x0000008e,
+	0x0004003d,0x00000015,0x00000129,0x00000128,
+	0x00050041,0x00000016,0x0000012a,0x00000114,
+	0x00000093,0x0004003d,0x00000015,0x0000012b,
+	0x0000012a,0x00050041,0x00000016,0x0000012c,
+	0x00000114,0x000000d3,0x0004003d,0x00000015,
+	0x0000012d,0x0000012c,0x00090050,0x00000124,
+	0x0000012e,0x00000127,0x00000129,0x0000012b,
+	0x0000012d,0x00000022,0x00000034,0x0003003e,
+	0x00000122,0x0000012e,0x00050041,0x00000100,
+	0x00000130,0x0000000b,0x0000012f,0x0004003d,
+	0x00000002,0x00000131,0x00000130,0x000500c7,
+	0x00000002,0x00000133,0x00000131,0x00000132,
+	0x00050041,0x00000016,0x00000134,0x00000122,
+	0x00000133,0x0004003d,0x00000015,0x00000135,
+	0x00000134,0x00050041,0x00000100,0x00000136,
+	0x0000000b,0x0000012f,0x0004003d,0x00000002,
+	0x00000137,0x00000136,0x000500c2,0x00000002,
+	0x00000138,0x00000137,0x00000062,0x000500c7,
+	0x00000002,0x00000139,0x00000138,0x00000132,
+	0x00050041,0x00000016,0x0000013a,0x00000122,
+	0x00000139,0x0004003d,0x00000015,0x0000013b,
+	0x0000013a,0x00050041,0x00000100,0x0000013c,
+	0x0000000b,0x0000012f,0x0004003d,0x00000002,
+	0x0000013d,0x0000013c,0x000500c2,0x00000002,
+	0x0000013f,0x0000013d,0x0000013e,0x000500c7,
+	0x00000002,0x00000140,0x0000013f,0x00000132,
+	0x00050041,0x00000016,0x00000141,0x00000122,
+	0x00000140,0x0004003d,0x00000015,0x00000142,
+	0x00000141,0x00050041,0x00000100,0x00000143,
+	0x0000000b,0x0000012f,0x0004003d,0x00000002,
+	0x00000144,0x00000143,0x000500c2,0x00000002,
+	0x00000146,0x00000144,0x00000145,0x000500c7,
+	0x00000002,0x00000147,0x00000146,0x00000132,
+	0x00050041,0x00000016,0x00000148,0x00000122,
+	0x00000147,0x0004003d,0x00000015,0x00000149,
+	0x00000148,0x00070050,0x0000003a,0x0000014a,
+	0x00000135,0x0000013b,0x00000142,0x00000149,
+	0x0003003e,0x00000114,0x0000014a,0x000200f9,
+	0x00000120,0x000200f8,0x00000120,0x00050041,
+	0x00000100,0x0000014b,0x0000000b,0x0000011b,
+	0x0004003d,0x00000002,0x0000014c,0x0000014b,
+	0x000500c7,0x00000002,0x0000014d,0x0000014c,
+	0x00000045,0x000500ab,0x0000001d,0x0000014e,
+	0x0000014d,0x00000085,0x000300f7,0x0000014f,
+	0x00000000,0x000400fa,0x0000014e,0x00000150,
+	0x0000014f,0x000200f8,0x00000150,0x00050041,
+	0x00000016,0x00000152,0x00000114,0x0000004b,
+	0x0004003d,0x00000015,0x00000153,0x00000152,
+	0x0003003e,0x00000151,0x00000153,0x00050039,
+	0x00000015,0x00000154,0x00000010,0x00000151,
+	0x00050041,0x00000016,0x00000156,0x00000114,
+	0x0000008e,0x0004003d,0x00000015,0x00000157,
+	0x00000156,0x0003003e,0x00000155,0x00000157,
+	0x00050039,0x00000015,0x00000158,0x00000010,
+	0x00000155,0x00050041,0x00000016,0x0000015a,
+	0x00000114,0x00000093,0x0004003d,0x00000015,
+	0x0000015b,0x0000015a,0x0003003e,0x00000159,
+	0x0000015b,0x00050039,0x00000015,0x0000015c,
+	0x00000010,0x00000159,0x00060050,0x00000098,
+	0x0000015d,0x00000154,0x00000158,0x0000015c,
+	0x0004003d,0x0000003a,0x0000015e,0x00000114,
+	0x0009004f,0x0000003a,0x0000015f,0x0000015e,
+	0x0000015d,0x00000004,0x00000005,0x00000006,
+	0x00000003,0x0003003e,0x00000114,0x0000015f,
+	0x000200f9,0x0000014f,0x000200f8,0x0000014f,
+	0x00050041,0x00000100,0x00000160,0x0000000b,
+	0x0000011b,0x0004003d,0x00000002,0x00000161,
+	0x00000160,0x000500c7,0x00000002,0x00000162,
+	0x00000161,0x00000062,0x000500ab,0x0000001d,
+	0x00000163,0x00000162,0x00000085,0x000300f7,
+	0x00000164,0x00000000,0x000400fa,0x00000163,
+	0x00000165,0x00000164,0x000200f8,0x00000165,
+	0x0004003d,0x0000003a,0x00000166,0x00000114,
+	0x0008004f,0x00000098,0x00000167,0x00000166,
+	0x00000166,0x00000000,0x00000001,0x00000002,
+	0x00050041,0x00000016,0x00000168,0x00000114,
+	0x000000d3,0x0004003d,0x00000015,0x00000169,
+	0x00000168,0x0005008e,0x00000098,0x0000016a,
+	0x00000167,0x00000169,0x0004003d,0x0000003a,
+	0x0000016b,0x00000114,0x0009004f,0x0000003a,
+	0x0000016c,0x0000016b,0x0000016a,0x00000004,
+	0x00000005,0x00000006,0x00000003,0x0003003e,
+	0x00000114,0x0000016c,0x000200f9,0x00000164,
+	0x000200f8,0x00000164,0x00050041,0x00000100,
+	0x0000016d,0x0000000b,0x0000011b,0x0004003d,
+	0x00000002,0x0000016e,0x0000016d,0x000500c7,
+	0x00000002,0x0000016f,0x0000016e,0x0000013e,
+	0x000500ab,0x0000001d,0x00000170,0x0000016f,
+	0x00000085,0x000300f7,0x00000171,0x00000000,
+	0x000400fa,0x00000170,0x00000172,0x00000171,
+	0x000200f8,0x00000172,0x00050041,0x00000016,
+	0x00000174,0x00000114,0x0000004b,0x0004003d,
+	0x00000015,0x00000175,0x00000174,0x0003003e,
+	0x00000173,0x00000175,0x00050039,0x00000015,
+	0x00000176,0x00000011,0x00000173,0x00050041,
+	0x00000016,0x00000178,0x00000114,0x0000008e,
+	0x0004003d,0x00000015,0x00000179,0x00000178,
+	0x0003003e,0x00000177,0x00000179,0x00050039,
+	0x00000015,0x0000017a,0x00000011,0x00000177,
+	0x00050041,0x00000016,0x0000017c,0x00000114,
+	0x00000093,0x0004003d,0x00000015,0x0000017d,
+	0x0000017c,0x0003003e,0x0000017b,0x0000017d,
+	0x00050039,0x00000015,0x0000017e,0x00000011,
+	0x0000017b,0x00060050,0x00000098,0x0000017f,
+	0x00000176,0x0000017a,0x0000017e,0x0004003d,
+	0x0000003a,0x00000180,0x00000114,0x0009004f,
+	0x0000003a,0x00000181,0x00000180,0x0000017f,
+	0x00000004,0x00000005,0x00000006,0x00000003,
+	0x0003003e,0x00000114,0x00000181,0x000200f9,
+	0x00000171,0x000200f8,0x00000171,0x0004003d,
+	0x00000002,0x00000183,0x0000010b,0x0003003e,
+	0x00000182,0x00000183,0x00050041,0x00000100,
+	0x00000185,0x0000000b,0x000000d3,0x0004003d,
+	0x00000002,0x00000186,0x00000185,0x0003003e,
+	0x00000184,0x00000186,0x0004003d,0x0000003a,
+	0x00000188,0x00000114,0x0003003e,0x00000187,
+	0x00000188,0x00070039,0x0000009c,0x00000189,
+	0x00000013,0x00000182,0x00000184,0x00000187,
+	0x000100fd,0x00010038
+};
+
+// Source of compute shader drawing the patterns of DGGenerator into a storage buffer range (filename: generate.comp)
+/*
+#version 450
+layout(local_size_x = 8, local_size_y = 8) in;
+layout(std430, binding = 1) buffer Destination { uint texels[]; } destination;
+layout(push_constant) uniform Params
+{
+    vec4 colorA;
+    vec4 colorB;
+    vec4 points;
+    float cellSize;
+    float lacunarity;
+    float gain;
+    uint generator;
+    uint octaves;
+    uint seed;
+    uint x;
+    uint y;
+    uint width;
+    uint height;
+    uint format;
+} params;
+
+uint hashCell(ivec2 cell, uint seed)
+{
+    uint h = uint(cell.x) * 0x8da6b343u ^ uint(cell.y) * 0xd8163841u ^ seed * 0xcb1ab31fu;
+    h ^= h >> 16u;
+    h *= 0x7feb352du;
+    h ^= h >> 15u;
+    h *= 0x846ca68bu;
+    h ^= h >> 16u;
+    return h;
+}
+
+float randomCell(ivec2 cell, uint seed)
+{
+    return float(hashCell(cell, seed) >> 8u) * (1.0 / 16777216.0);
+}
+
+vec2 gradientCell(ivec2 cell, uint seed)
+{
+    float angle = randomCell(cell, seed) * 6.2831853;
+    return vec2(cos(angle), sin(angle));
+}
+
+vec2 fade(vec2 t)
+{
+    return t * t * t * (t * (t * 6.0 - 15.0) + 10.0);
+}
+
+float valueNoise(vec2 p, uint seed)
+{
+    ivec2 cell = ivec2(floor(p));
+    vec2 u = fade(p - floor(p));
+    return mix(mix(randomCell(cell, seed), randomCell(cell + ivec2(1, 0), seed), u.x), mix(randomCell(cell + ivec2(0, 1), seed), randomCell(cell + ivec2(1, 1), seed), u.x), u.y);
+}
+
+float perlinNoise(vec2 p, uint seed)
+{
+    ivec2 cell = ivec2(floor(p));
+    vec2 f = p - floor(p);
+    vec2 u = fade(f);
+    float n00 = dot(gradientCell(cell, seed), f);
+    float n10 = dot(gradientCell(cell + ivec2(1, 0), seed), f - vec2(1.0, 0.0));
+    float n01 = dot(gradientCell(cell + ivec2(0, 1), seed), f - vec2(0.0, 1.0));
+    float n11 = dot(gradientCell(cell + ivec2(1, 1), seed), f - vec2(1.0, 1.0));
+    return mix(mix(n00, n10, u.x), mix(n01, n11, u.x), u.y) * 0.7071068 + 0.5;
+}
+
+float simplexNoise(vec2 p, uint seed)
+{
+    const float F2 = 0.3660254;
+    const float G2 = 0.2113249;
+    vec2 s = floor(p + (p.x + p.y) * F2);
+    vec2 x0 = p - s + (s.x + s.y) * G2;
+    vec2 o = x0.x > x0.y ? vec2(1.0, 0.0) : vec2(0.0, 1.0);
+    vec2 x1 = x0 - o + G2;
+    vec2 x2 = x0 - 1.0 + 2.0 * G2;
+    ivec2 cell = ivec2(s);
+    vec3 t = max(0.5 - vec3(dot(x0, x0), dot(x1, x1), dot(x2, x2)), 0.0);
+    t *= t;
+    t *= t;
+    vec3 n = t * vec3(dot(gradientCell(cell, seed), x0), dot(gradientCell(cell + ivec2(o), seed), x1), dot(gradientCell(cell + 1, seed), x2));
+    return (n.x + n.y + n.z) * 49.0 + 0.5;
+}
+
+float voronoi(vec2 p, uint seed)
+{
+    ivec2 cell = ivec2(floor(p));
+    float nearest = 2.0;
+    for (int y = -1; y <= 1; y++)
+    {
+        for (int x = -1; x <= 1; x++)
+        {
+            ivec2 neighbour = cell + ivec2(x, y);
+            vec2 feature = vec2(neighbour) + vec2(randomCell(neighbour, seed), randomCell(neighbour, seed ^ 0x9e3779b9u));
+            nearest = min(nearest, distance(p, feature));
+        }
+    }
+    return nearest;
+}
+
+float fractalNoise(vec2 p)
+{
+    float sum = 0.0;
+    float total = 0.0;
+    float amplitude = 1.0;
+    for (uint i = 0u; i < params.octaves; i++)
+    {
+        uint seed = params.seed + i * 0x632be5abu;
+        float n = params.generator == 0u ? valueNoise(p, seed) : params.generator == 1u ? perlinNoise(p, seed) : simplexNoise(p, seed);
+        sum += n * amplitude;
+        total += amplitude;
+        p *= params.lacunarity;
+        amplitude *= params.gain;
+    }
+    return total > 0.0 ? sum / total : 0.0;
+}
+
+// Texel formats: 0 RGBA8, 1 BGRA8, 2 RGBA16F, 3 RGBA32F, +4 for the sRGB 8 bit ones
+float toSRGB(float c)
+{
+    return c <= 0.0031308 ? c * 12.92 : 1.055 * pow(max(c, 0.0), 1.0 / 2.4) - 0.055;
+}
+
+void storeTexel(uint index, uint format, vec4 color)
+{
+    if ((format & 3u) == 2u)
+    {
+        destination.texels[index * 2u] = packHalf2x16(color.rg);
+        destination.texels[index * 2u + 1u] = packHalf2x16(color.ba);
+    }
+    else if ((format & 3u) == 3u)
+    {
+        uvec4 bits = floatBitsToUint(color);
+        destination.texels[index * 4u] = bits.x;
+        destination.texels[index * 4u + 1u] = bits.y;
+        destination.texels[index * 4u + 2u] = bits.z;
+        destination.texels[index * 4u + 3u] = bits.w;
+    }
+    else
+    {
+        if ((format & 4u) != 0u)
+            color.rgb = vec3(toSRGB(color.r), toSRGB(color.g), toSRGB(color.b));
+        if ((format & 3u) == 1u)
+            color = color.bgra;
+        destination.texels[index] = packUnorm4x8(color);
+    }
+}
+
+void main()
+{
+    uvec2 texel = gl_GlobalInvocationID.xy;
+    if (texel.x >= params.width || texel.y >= params.height)
+        return;
+    vec2 pixel = vec2(uvec2(params.x, params.y) + texel) + 0.5;
+    vec2 p = (pixel + params.points.xy) / params.cellSize;
+    float value;
+    if (params.generator <= 2u)
+        value = fractalNoise(p);
+    else if (params.generator == 3u)
+    {
+        vec2 axis = params.points.zw - params.points.xy;
+        value = dot(pixel - params.points.xy, axis) / max(dot(axis, axis), 1e-6);
+    }
+    else if (params.generator == 4u)
+        value = distance(pixel, params.points.xy) / max(distance(params.points.zw, params.points.xy), 1e-6);
+    else if (params.generator == 5u)
+    {
+        ivec2 cell = ivec2(floor(p));
+        value = float((cell.x + cell.y) & 1);
+    }
+    else
+        value = voronoi(p, params.seed);
+    storeTexel(texel.y * params.width + texel.x, params.format, mix(params.colorA, params.colorB, clamp(value, 0.0, 1.0)));
+}
+*/
+// SPIR-V 1.0, to rebuild from the source:
+// %VULKAN_SDK%\bin\glslc -mfmt=num generate.comp -c
+
+const uint32_t generateShaderSpirv[] = {
+	0x07230203,0x00010000,0x00000000,0x00000317,
+	0x00000000,0x00020011,0x00000001,0x0006000b,
+	0x00000001,0x4c534c47,0x6474732e,0x3035342e,
+	0x00000000,0x0003000e,0x00000000,0x00000001,
+	0x0006000f,0x00000005,0x0000001a,0x6e69616d,
+	0x00000000,0x0000000c,0x00060010,0x0000001a,
+	0x00000011,0x00000008,0x00000008,0x00000001,
+	0x00030003,0x00000002,0x000001c2,0x00050005,
+	0x00000004,0x74736544,0x74616e69,0x006e6f69,
+	0x00050006,0x00000004,0x00000000,0x65786574,
+	0x0000736c,0x00050005,0x00000005,0x74736564,
+	0x74616e69,0x006e6f69,0x00040005,0x00000009,
+	0x61726150,0x0000736d,0x00050006,0x00000009,
+	0x00000000,0x6f6c6f63,0x00004172,0x00050006,
+	0x00000009,0x00000001,0x6f6c6f63,0x00004272,
+	0x00050006,0x00000009,0x00000002,0x6e696f70,
+	0x00007374,0x00060006,0x00000009,0x00000003,
+	0x6c6c6563,0x657a6953,0x00000000,0x00060006,
+	0x00000009,0x00000004,0x7563616c,0x6972616e,
+	0x00007974,0x00050006,0x00000009,0x00000005,
+	0x6e696167,0x00000000,0x00060006,0x00000009,
+	0x00000006,0x656e6567,0x6f746172,0x00000072,
+	0x00050006,0x00000009,0x00000007,0x6174636f,
+	0x00736576,0x00050006,0x00000009,0x00000008,
+	0x64656573,0x00000000,0x00040006,0x00000009,
+	0x00000009,0x00000078,0x00040006,0x00000009,
+	0x0000000a,0x00000079,0x00050006,0x00000009,
+	0x0000000b,0x74646977,0x00000068,0x00050006,
+	0x00000009,0x0000000c,0x67696568,0x00007468,
+	0x00050006,0x00000009,0x0000000d,0x6d726f66,
+	0x00007461,0x00040005,0x0000000a,0x61726170,
+	0x0000736d,0x00080005,0x0000000c,0x475f6c67,
+	0x61626f6c,0x766e496c,0x7461636f,0x496e6f69,
+	0x00000044,0x00050005,0x0000000f,0x68736168,
+	0x6c6c6543,0x00000000,0x00050005,0x00000010,
+	0x646e6172,0x65436d6f,0x00006c6c,0x00060005,
+	0x00000011,0x64617267,0x746e6569,0x6c6c6543,
+	0x00000000,0x00040005,0x00000012,0x65646166,
+	0x00000000,0x00050005,0x00000013,0x756c6176,
+	0x696f4e65,0x00006573,0x00050005,0x00000014,
+	0x6c726570,0x6f4e6e69,0x00657369,0x00060005,
+	0x00000015,0x706d6973,0x4e78656c,0x6573696f,
+	0x00000000,0x00040005,0x00000016,0x6f726f76,
+	0x00696f6e,0x00060005,0x00000017,0x63617266,
+	0x4e6c6174,0x6573696f,0x00000000,0x00040005,
+	0x00000018,0x52536f74,0x00004247,0x00050005,
+	0x00000019,0x726f7473,0x78655465,0x00006c65,
+	0x00040005,0x0000001a,0x6e69616d,0x00000000,
+	0x00040047,0x00000003,0x00000006,0x00000004,
+	0x00030047,0x00000004,0x00000003,0x00050048,
+	0x00000004,0x00000000,0x00000023,0x00000000,
+	0x00040047,0x00000005,0x00000022,0x00000000,
+	0x00040047,0x00000005,0x00000021,0x00000001,
+	0x00030047,0x00000009,0x00000002,0x00050048,
+	0x00000009,0x00000000,0x00000023,0x00000000,
+	0x00050048,0x00000009,0x00000001,0x00000023,
+	0x00000010,0x00050048,0x00000009,0x00000002,
+	0x00000023,0x00000020,0x00050048,0x00000009,
+	0x00000003,0x00000023,0x00000030,0x00050048,
+	0x00000009,0x00000004,0x00000023,0x00000034,
+	0x00050048,0x00000009,0x00000005,0x00000023,
+	0x00000038,0x00050048,0x00000009,0x00000006,
+	0x00000023,0x0000003c,0x00050048,0x00000009,
+	0x00000007,0x00000023,0x00000040,0x00050048,
+	0x00000009,0x00000008,0x00000023,0x00000044,
+	0x00050048,0x00000009,0x00000009,0x00000023,
+	0x00000048,0x00050048,0x00000009,0x0000000a,
+	0x00000023,0x0000004c,0x00050048,0x00000009,
+	0x0000000b,0x00000023,0x00000050,0x00050048,
+	0x00000009,0x0000000c,0x00000023,0x00000054,
+	0x00050048,0x00000009,0x0000000d,0x00000023,
+	0x00000058,0x00040047,0x0000000c,0x0000000b,
+	0x0000001c,0x00040015,0x00000002,0x00000020,
+	0x00000000,0x0003001d,0x00000003,0x00000002,
+	0x0003001e,0x00000004,0x00000003,0x00040020,
+	0x00000006,0x00000002,0x00000004,0x0004003b,
+	0x00000006,0x00000005,0x00000002,0x00030016,
+	0x00000007,0x00000020,0x00040017,0x00000008,
+	0x00000007,0x00000004,0x0010001e,0x00000009,
+	0x00000008,0x00000008,0x00000008,0x00000007,
+	0x00000007,0x00000007,0x00000002,0x00000002,
+	0x00000002,0x00000002,0x00000002,0x00000002,
+	0x00000002,0x00000002,0x00040020,0x0000000b,
+	0x00000009,0x00000009,0x0004003b,0x0000000b,
+	0x0000000a,0x00000009,0x00040017,0x0000000d,
+	0x00000002,0x00000003,0x00040020,0x0000000e,
+	0x00000001,0x0000000d,0x0004003b,0x0000000e,
+	0x0000000c,0x00000001,0x00040015,0x0000001b,
+	0x00000020,0x00000001,0x00040017,0x0000001c,
+	0x0000001b,0x00000002,0x00040020,0x0000001d,
+	0x00000007,0x0000001c,0x00040020,0x0000001e,
+	0x00000007,0x00000002,0x00050021,0x0000001f,
+	0x00000002,0x0000001d,0x0000001e,0x0004002b,
+	0x0000001b,0x00000024,0x00000000,0x00040020,
+	0x00000026,0x00000007,0x0000001b,0x0004002b,
+	0x00000002,0x00000029,0x8da6b343,0x0004002b,
+	0x0000001b,0x0000002b,0x00000001,0x0004002b,
+	0x00000002,0x0000002f,0xd8163841,0x0004002b,
+	0x00000002,0x00000033,0xcb1ab31f,0x0004002b,
+	0x00000002,0x00000038,0x00000010,0x0004002b,
+	0x00000002,0x0000003c,0x7feb352d,0x0004002b,
+	0x00000002,0x00000040,0x0000000f,0x0004002b,
+	0x00000002,0x00000044,0x846ca68b,0x00050021,
+	0x0000004b,0x00000007,0x0000001d,0x0000001e,
+	0x0004002b,0x00000002,0x00000054,0x00000008,
+	0x0004002b,0x00000007,0x00000057,0x3f800000,
+	0x0004002b,0x00000007,0x00000058,0x4b800000,
+	0x00040017,0x0000005b,0x00000007,0x00000002,
+	0x00050021,0x0000005c,0x0000005b,0x0000001d,
+	0x0000001e,0x00040020,0x00000061,0x00000007,
+	0x00000007,0x0004002b,0x00000007,0x00000067,
+	0x40c90fdb,0x00040020,0x0000006e,0x00000007,
+	0x0000005b,0x00040021,0x0000006f,0x0000005b,
+	0x0000006e,0x0004002b,0x00000007,0x00000079,
+	0x40c00000,0x0004002b,0x00000007,0x0000007b,
+	0x41700000,0x0005002c,0x0000005b,0x0000007c,
+	0x0000007b,0x0000007b,0x0004002b,0x00000007,
+	0x0000007f,0x41200000,0x0005002c,0x0000005b,
+	0x00000080,0x0000007f,0x0000007f,0x00050021,
+	0x00000083,0x00000007,0x0000006e,0x0000001e,
+	0x0005002c,0x0000001c,0x00000099,0x0000002b,
+	0x00000024,0x0005002c,0x0000001c,0x000000a3,
+	0x00000024,0x0000002b,0x0005002c,0x0000001c,
+	0x000000aa,0x0000002b,0x0000002b,0x0004002b,
+	0x00000007,0x000000d5,0x00000000,0x0005002c,
+	0x0000005b,0x000000d6,0x00000057,0x000000d5,
+	0x0005002c,0x0000005b,0x000000e1,0x000000d5,
+	0x00000057,0x0005002c,0x0000005b,0x000000ec,
+	0x00000057,0x00000057,0x0004002b,0x00000007,
+	0x000000fc,0x3f3504f4,0x0004002b,0x00000007,
+	0x000000fe,0x3f000000,0x0004002b,0x00000007,
+	0x00000104,0x3ebb67ae,0x0004002b,0x00000007,
+	0x00000106,0x3e58658e,0x00020014,0x00000126,
+	0x00040017,0x00000128,0x00000126,0x00000002,
+	0x0004002b,0x00000007,0x00000134,0x40000000,
+	0x00040017,0x0000013d,0x00000007,0x00000003,
+	0x00040020,0x0000013e,0x00000007,0x0000013d,
+	0x0006002c,0x0000013d,0x00000149,0x000000fe,
+	0x000000fe,0x000000fe,0x0006002c,0x0000013d,
+	0x0000014b,0x000000d5,0x000000d5,0x000000d5,
+	0x0004002b,0x0000001b,0x00000175,0x00000002,
+	0x0004002b,0x00000007,0x00000179,0x42440000,
+	0x0004002b,0x0000001b,0x00000185,0xffffffff,
+	0x0004002b,0x00000002,0x000001a7,0x9e3779b9,
+	0x00040021,0x000001b6,0x00000007,0x0000006e,
+	0x0004002b,0x00000002,0x000001bd,0x00000000,
+	0x0004002b,0x0000001b,0x000001c4,0x00000007,
+	0x00040020,0x000001c6,0x00000009,0x00000002,
+	0x0004002b,0x0000001b,0x000001ca,0x00000008,
+	0x0004002b,0x00000002,0x000001ce,0x632be5ab,
+	0x0004002b,0x0000001b,0x000001d2,0x00000006,
+	0x0004002b,0x00000002,0x000001e1,0x00000001,
+	0x0004002b,0x0000001b,0x000001fc,0x00000004,
+	0x00040020,0x000001fe,0x00000009,0x00000007,
+	0x0004002b,0x0000001b,0x00000202,0x00000005,
+	0x00040021,0x0000020e,0x00000007,0x00000061,
+	0x0004002b,0x00000007,0x00000212,0x3b4d2e1c,
+	0x0004002b,0x00000007,0x00000215,0x414eb852,
+	0x0004002b,0x00000007,0x00000217,0x3f870a3d,
+	0x0004002b,0x00000007,0x0000021a,0x4019999a,
+	0x0004002b,0x00000007,0x0000021e,0x3d6147ae,
+	0x00020013,0x00000221,0x00040020,0x00000222,
+	0x00000007,0x00000008,0x00060021,0x00000223,
+	0x00000221,0x0000001e,0x0000001e,0x00000222,
+	0x0004002b,0x00000002,0x00000229,0x00000003,
+	0x0004002b,0x00000002,0x0000022b,0x00000002,
+	0x00040020,0x00000236,0x00000002,0x00000002,
+	0x00040017,0x00000245,0x00000002,0x00000004,
+	0x00040020,0x00000246,0x00000007,0x00000245,
+	0x0004002b,0x00000002,0x0000024a,0x00000004,
+	0x0004002b,0x0000001b,0x0000025e,0x00000003,
+	0x00030021,0x00000281,0x00000221,0x00040017,
+	0x00000284,0x00000002,0x00000002,0x00040020,
+	0x00000285,0x00000007,0x00000284,0x0004002b,
+	0x0000001b,0x0000028a,0x0000000b,0x0004002b,
+	0x0000001b,0x00000290,0x0000000c,0x0004002b,
+	0x0000001b,0x00000298,0x00000009,0x0004002b,
+	0x0000001b,0x0000029b,0x0000000a,0x0005002c,
+	0x0000005b,0x000002a2,0x000000fe,0x000000fe,
+	0x00040020,0x000002a7,0x00000009,0x00000008,
+	0x0004002b,0x00000007,0x000002d1,0x358637bd,
+	0x0004002b,0x00000002,0x000002ea,0x00000005,
+	0x0004002b,0x0000001b,0x0000030a,0x0000000d,
+	0x00050036,0x00000002,0x0000000f,0x00000000,
+	0x0000001f,0x00030037,0x0000001d,0x00000020,
+	0x00030037,0x0000001e,0x00000021,0x000200f8,
+	0x00000022,0x0004003b,0x0000001e,0x00000023,
+	0x00000007,0x00050041,0x00000026,0x00000025,
+	0x00000020,0x00000024,0x0004003d,0x0000001b,
+	0x00000027,0x00000025,0x0004007c,0x00000002,
+	0x00000028,0x00000027,0x00050084,0x00000002,
+	0x0000002a,0x00000028,0x00000029,0x00050041,
+	0x00000026,0x0000002c,0x00000020,0x0000002b,
+	0x0004003d,0x0000001b,0x0000002d,0x0000002c,
+	0x0004007c,0x00000002,0x0000002e,0x0000002d,
+	0x00050084,0x00000002,0x00000030,0x0000002e,
+	0x0000002f,0x000500c6,0x00000002,0x00000031,
+	0x0000002a,0x00000030,0x0004003d,0x00000002,
+	0x00000032,0x00000021,0x00050084,0x00000002,
+	0x00000034,0x00000032,0x00000033,0x000500c6,
+	0x00000002,0x00000035,0x00000031,0x00000034,
+	0x0003003e,0x00000023,0x00000035,0x0004003d,
+	0x00000002,0x00000036,0x00000023,0x0004003d,
+	0x00000002,0x00000037,0x00000023,0x000500c2,
+	0x00000002,0x00000039,0x00000037,0x00000038,
+	0x000500c6,0x00000002,0x0000003a,0x00000036,
+	0x00000039,0x0003003e,0x00000023,0x0000003a,
+	0x0004003d,0x00000002,0x0000003b,0x00000023,
+	0x00050084,0x00000002,0x0000003d,0x0000003b,
+	0x0000003c,0x0003003e,0x00000023,0x0000003d,
+	0x0004003d,0x00000002,0x0000003e,0x00000023,
+	0x0004003d,0x00000002,0x0000003f,0x00000023,
+	0x000500c2,0x00000002,0x00000041,0x0000003f,
+	0x00000040,0x000500c6,0x00000002,0x00000042,
+	0x0000003e,0x00000041,0x0003003e,0x00000023,
+	0x00000042,0x0004003d,0x00000002,0x00000043,
+	0x00000023,0x00050084,0x00000002,0x00000045,
+	0x00000043,0x00000044,0x0003003e,0x00000023,
+	0x00000045,0x0004003d,0x00000002,0x00000046,
+	0x00000023,0x0004003d,0x00000002,0x00000047,
+	0x00000023,0x000500c2,0x00000002,0x00000048,
+	0x00000047,0x00000038,0x000500c6,0x00000002,
+	0x00000049,0x00000046,0x00000048,0x0003003e,
+	0x00000023,0x00000049,0x0004003d,0x00000002,
+	0x0000004a,0x00000023,0x000200fe,0x0000004a,
+	0x00010038,0x00050036,0x00000007,0x00000010,
+	0x00000000,0x0000004b,0x00030037,0x0000001d,
+	0x0000004c,0x00030037,0x0000001e,0x0000004d,
+	0x000200f8,0x0000004e,0x0004003b,0x0000001d,
+	0x0000004f,0x00000007,0x0004003b,0x0000001e,
+	0x00000051,0x00000007,0x0004003d,0x0000001c,
+	0x00000050,0x0000004c,0x0003003e,0x0000004f,
+	0x00000050,0x0004003d,0x00000002,0x00000052,
+	0x0000004d,0x0003003e,0x00000051,0x00000052,
+	0x00060039,0x00000002,0x00000053,0x0000000f,
+	0x0000004f,0x00000051,0x000500c2,0x00000002,
+	0x00000055,0x00000053,0x00000054,0x00040070,
+	0x00000007,0x00000056,0x00000055,0x00050088,
+	0x00000007,0x00000059,0x00000057,0x00000058,
+	0x00050085,0x00000007,0x0000005a,0x00000056,
+	0x00000059,0x000200fe,0x0000005a,0x00010038,
+	0x00050036,0x0000005b,0x00000011,0x00000000,
+	0x0000005c,0x00030037,0x0000001d,0x0000005d,
+	0x00030037,0x0000001e,0x0000005e,0x000200f8,
+	0x0000005f,0x0004003b,0x00000061,0x00000060,
+	0x00000007,0x0004003b,0x0000001d,0x00000062,
+	0x00000007,0x0004003b,0x0000001e,0x00000064,
+	0x00000007,0x0004003d,0x0000001c,0x00000063,
+	0x0000005d,0x0003003e,0x00000062,0x00000063,
+	0x0004003d,0x00000002,0x00000065,0x0000005e,
+	0x0003003e,0x00000064,0x00000065,0x00060039,
+	0x00000007,0x00000066,0x00000010,0x00000062,
+	0x00000064,0x00050085,0x00000007,0x00000068,
+	0x00000066,0x00000067,0x0003003e,0x00000060,
+	0x00000068,0x0004003d,0x00000007,0x00000069,
+	0x00000060,0x0006000c,0x00000007,0x0000006a,
+	0x00000001,0x0000000e,0x00000069,0x0004003d,
+	0x00000007,0x0000006b,0x00000060,0x0006000c,
+	0x00000007,0x0000006c,0x00000001,0x0000000d,
+	0x0000006b,0x00050050,0x0000005b,0x0000006d,
+	0x0000006a,0x0000006c,0x000200fe,0x0000006d,
+	0x00010038,0x00050036,0x0000005b,0x00000012,
+	0x00000000,0x0000006f,0x00030037,0x0000006e,
+	0x00000070,0x000200f8,0x00000071,0x0004003d,
+	0x0000005b,0x00000072,0x00000070,0x0004003d,
+	0x0000005b,0x00000073,0x00000070,0x00050085,
+	0x0000005b,0x00000074,0x00000072,0x00000073,
+	0x0004003d,0x0000005b,0x00000075,0x00000070,
+	0x00050085,0x0000005b,0x00000076,0x00000074,
+	0x00000075,0x0004003d,0x0000005b,0x00000077,
+	0x00000070,0x0004003d,0x0000005b,0x00000078,
+	0x00000070,0x0005008e,0x0000005b,0x0000007a,
+	0x00000078,0x00000079,0x00050083,0x0000005b,
+	0x0000007d,0x0000007a,0x0000007c,0x00050085,
+	0x0000005b,0x0000007e,0x00000077,0x0000007d,
+	0x00050081,0x0000005b,0x00000081,0x0000007e,
+	0x00000080,0x00050085,0x0000005b,0x00000082,
+	0x00000076,0x00000081,0x000200fe,0x00000082,
+	0x00010038,0x00050036,0x00000007,0x00000013,
+	0x00000000,0x00000083,0x00030037,0x0000006e,
+	0x00000084,0x00030037,0x0000001e,0x00000085,
+	0x000200f8,0x00000086,0x0004003b,0x0000001d,
+	0x00000087,0x00000007,0x0004003b,0x0000006e,
+	0x0000008b,0x00000007,0x0004003b,0x0000006e,
+	0x0000008c,0x00000007,0x0004003b,0x0000001d,
+	0x00000092,0x00000007,0x0004003b,0x0000001e,
+	0x00000094,0x00000007,0x0004003b,0x0000001d,
+	0x00000097,0x00000007,0x0004003b,0x0000001e,
+	0x0000009b,0x00000007,0x0004003b,0x0000001d,
+	0x000000a1,0x00000007,0x0004003b,0x0000001e,
+	0x000000a5,0x00000007,0x0004003b,0x0000001d,
+	0x000000a8,0x00000007,0x0004003b,0x0000001e,
+	0x000000ac,0x00000007,0x0004003d,0x0000005b,
+	0x00000088,0x00000084,0x0006000c,0x0000005b,
+	0x00000089,0x00000001,0x00000008,0x00000088,
+	0x0004006e,0x0000001c,0x0000008a,0x00000089,
+	0x0003003e,0x00000087,0x0000008a,0x0004003d,
+	0x0000005b,0x0000008d,0x00000084,0x0004003d,
+	0x0000005b,0x0000008e,0x00000084,0x0006000c,
+	0x0000005b,0x0000008f,0x00000001,0x00000008,
+	0x0000008e,0x00050083,0x0000005b,0x00000090,
+	0x0000008d,0x0000008f,0x0003003e,0x0000008c,
+	0x00000090,0x00050039,0x0000005b,0x00000091,
+	0x00000012,0x0000008c,0x0003003e,0x0000008b,
+	0x00000091,0x0004003d,0x0000001c,0x00000093,
+	0x00000087,0x0003003e,0x00000092,0x00000093,
+	0x0004003d,0x00000002,0x00000095,0x00000085,
+	0x0003003e,0x00000094,0x00000095,0x00060039,
+	0x00000007,0x00000096,0x00000010,0x00000092,
+	0x00000094,0x0004003d,0x0000001c,0x00000098,
+	0x00000087,0x00050080,0x0000001c,0x0000009a,
+	0x00000098,0x00000099,0x0003003e,0x00000097,
+	0x0000009a,0x0004003d,0x00000002,0x0000009c,
+	0x00000085,0x0003003e,0x0000009b,0x0000009c,
+	0x00060039,0x00000007,0x0000009d,0x00000010,
+	0x00000097,0x0000009b,0x00050041,0x00000061,
+	0x0000009e,0x0000008b,0x00000024,0x0004003d,
+	0x00000007,0x0000009f,0x0000009e,0x0008000c,
+	0x00000007,0x000000a0,0x00000001,0x0000002e,
+	0x00000096,0x0000009d,0x0000009f,0x0004003d,
+	0x0000001c,0x000000a2,0x00000087,0x00050080,
+	0x0000001c,0x000000a4,0x000000a2,0x000000a3,
+	0x0003003e,0x000000a1,0x000000a4,0x0004003d,
+	0x00000002,0x000000a6,0x00000085,0x0003003e,
+	0x000000a5,0x000000a6,0x00060039,0x00000007,
+	0x000000a7,0x00000010,0x000000a1,0x000000a5,
+	0x0004003d,0x0000001c,0x000000a9,0x00000087,
+	0x00050080,0x0000001c,0x000000ab,0x000000a9,
+	0x000000aa,0x0003003e,0x000000a8,0x000000ab,
+	0x0004003d,0x00000002,0x000000ad,0x00000085,
+	0x0003003e,0x000000ac,0x000000ad,0x00060039,
+	0x00000007,0x000000ae,0x00000010,0x000000a8,
+	0x000000ac,0x00050041,0x00000061,0x000000af,
+	0x0000008b,0x00000024,0x0004003d,0x00000007,
+	0x000000b0,0x000000af,0x0008000c,0x00000007,
+	0x000000b1,0x00000001,0x0000002e,0x000000a7,
+	0x000000ae,0x000000b0,0x00050041,0x00000061,
+	0x000000b2,0x0000008b,0x0000002b,0x0004003d,
+	0x00000007,0x000000b3,0x000000b2,0x0008000c,
+	0x00000007,0x000000b4,0x00000001,0x0000002e,
+	0x000000a0,0x000000b1,0x000000b3,0x000200fe,
+	0x000000b4,0x00010038,0x00050036,0x00000007,
+	0x00000014,0x00000000,0x00000083,0x00030037,
+	0x0000006e,0x000000b5,0x00030037,0x0000001e,
+	0x000000b6,0x000200f8,0x000000b7,0x0004003b,
+	0x0000001d,0x000000b8,0x00000007,0x0004003b,
+	0x0000006e,0x000000bc,0x00000007,0x0004003b,
+	0x0000006e,0x000000c1,0x00000007,0x0004003b,
+	0x0000006e,0x000000c2,0x00000007,0x0004003b,
+	0x00000061,0x000000c5,0x00000007,0x0004003b,
+	0x0000001d,0x000000c6,0x00000007,0x0004003b,
+	0x0000001e,0x000000c8,0x00000007,0x0004003b,
+	0x00000061,0x000000cd,0x00000007,0x0004003b,
+	0x0000001d,0x000000ce,0x00000007,0x0004003b,
+	0x0000001e,0x000000d1,0x00000007,0x0004003b,
+	0x00000061,0x000000d9,0x00000007,0x0004003b,
+	0x0000001d,0x000000da,0x00000007,0x0004003b,
+	0x0000001e,0x000000dd,0x00000007,0x0004003b,
+	0x00000061,0x000000e4,0x00000007,0x0004003b,
+	0x0000001d,0x000000e5,0x00000007,0x0004003b,
+	0x0000001e,0x000000e8,0x00000007,0x0004003d,
+	0x0000005b,0x000000b9,0x000000b5,0x0006000c,
+	0x0000005b,0x000000ba,0x00000001,0x00000008,
+	0x000000b9,0x0004006e,0x0000001c,0x000000bb,
+	0x000000ba,0x0003003e,0x000000b8,0x000000bb,
+	0x0004003d,0x0000005b,0x000000bd,0x000000b5,
+	0x0004003d,0x0000005b,0x000000be,0x000000b5,
+	0x0006000c,0x0000005b,0x000000bf,0x00000001,
+	0x00000008,0x000000be,0x00050083,0x0000005b,
+	0x000000c0,0x000000bd,0x000000bf,0x0003003e,
+	0x000000bc,0x000000c0,0x0004003d,0x0000005b,
+	0x000000c3,0x000000bc,0x0003003e,0x000000c2,
+	0x000000c3,0x00050039,0x0000005b,0x000000c4,
+	0x00000012,0x000000c2,0x0003003e,0x000000c1,
+	0x000000c4,0x0004003d,0x0000001c,0x000000c7,
+	0x000000b8,0x0003003e,0x000000c6,0x000000c7,
+	0x0004003d,0x00000002,0x000000c9,0x000000b6,
+	0x0003003e,0x000000c8,0x000000c9,0x00060039,
+	0x0000005b,0x000000ca,0x00000011,0x000000c6,
+	0x000000c8,0x0004003d,0x0000005b,0x000000cb,
+	0x000000bc,0x00050094,0x00000007,0x000000cc,
+	0x000000ca,0x000000cb,0x0003003e,0x000000c5,
+	0x000000cc,0x0004003d,0x0000001c,0x000000cf,
+	0x000000b8,0x00050080,0x0000001c,0x000000d0,
+	0x000000cf,0x00000099,0x0003003e,0x000000ce,
+	0x000000d0,0x0004003d,0x00000002,0x000000d2,
+	0x000000b6,0x0003003e,0x000000d1,0x000000d2,
+	0x00060039,0x0000005b,0x000000d3,0x00000011,
+	0x000000ce,0x000000d1,0x0004003d,0x0000005b,
+	0x000000d4,0x000000bc,0x00050083,0x0000005b,
+	0x000000d7,0x000000d4,0x000000d6,0x00050094,
+	0x00000007,0x000000d8,0x000000d3,0x000000d7,
+	0x0003003e,0x000000cd,0x000000d8,0x0004003d,
+	0x0000001c,0x000000db,0x000000b8,0x00050080,
+	0x0000001c,0x000000dc,0x000000db,0x000000a3,
+	0x0003003e,0x000000da,0x000000dc,0x0004003d,
+	0x00000002,0x000000de,0x000000b6,0x0003003e,
+	0x000000dd,0x000000de,0x00060039,0x0000005b,
+	0x000000df,0x00000011,0x000000da,0x000000dd,
+	0x0004003d,0x0000005b,0x000000e0,0x000000bc,
+	0x00050083,0x0000005b,0x000000e2,0x000000e0,
+	0x000000e1,0x00050094,0x00000007,0x000000e3,
+	0x000000df,0x000000e2,0x0003003e,0x000000d9,
+	0x000000e3,0x0004003d,0x0000001c,0x000000e6,
+	0x000000b8,0x00050080,0x0000001c,0x000000e7,
+	0x000000e6,0x000000aa,0x0003003e,0x000000e5,
+	0x000000e7,0x0004003d,0x00000002,0x000000e9,
+	0x000000b6,0x0003003e,0x000000e8,0x000000e9,
+	0x00060039,0x0000005b,0x000000ea,0x00000011,
+	0x000000e5,0x000000e8,0x0004003d,0x0000005b,
+	0x000000eb,0x000000bc,0x00050083,0x0000005b,
+	0x000000ed,0x000000eb,0x000000ec,0x00050094,
+	0x00000007,0x000000ee,0x000000ea,0x000000ed,
+	0x0003003e,0x000000e4,0x000000ee,0x0004003d,
+	0x00000007,0x000000ef,0x000000c5,0x0004003d,
+	0x00000007,0x000000f0,0x000000cd,0x00050041,
+	0x00000061,0x000000f1,0x000000c1,0x00000024,
+	0x0004003d,0x00000007,0x000000f2,0x000000f1,
+	0x0008000c,0x00000007,0x000000f3,0x00000001,
+	0x0000002e,0x000000ef,0x000000f0,0x000000f2,
+	0x0004003d,0x00000007,0x000000f4,0x000000d9,
+	0x0004003d,0x00000007,0x000000f5,0x000000e4,
+	0x00050041,0x00000061,0x000000f6,0x000000c1,
+	0x00000024,0x0004003d,0x00000007,0x000000f7,
+	0x000000f6,0x0008000c,0x00000007,0x000000f8,
+	0x00000001,0x0000002e,0x000000f4,0x000000f5,
+	0x000000f7,0x00050041,0x00000061,0x000000f9,
+	0x000000c1,0x0000002b,0x0004003d,0x00000007,
+	0x000000fa,0x000000f9,0x0008000c,0x00000007,
+	0x000000fb,0x00000001,0x0000002e,0x000000f3,
+	0x000000f8,0x000000fa,0x00050085,0x00000007,
+	0x000000fd,0x000000fb,0x000000fc,0x00050081,
+	0x00000007,0x000000ff,0x000000fd,0x000000fe,
+	0x000200fe,0x000000ff,0x00010038,0x00050036,
+	0x00000007,0x00000015,0x00000000,0x00000083,
+	0x00030037,0x0000006e,0x00000100,0x00030037,
+	0x0000001e,0x00000101,0x000200f8,0x00000102,
+	0x0004003b,0x00000061,0x00000103,0x00000007,
+	0x0004003b,0x00000061,0x00000105,0x00000007,
+	0x0004003b,0x0000006e,0x00000107,0x00000007,
+	0x0004003b,0x0000006e,0x00000113,0x00000007,
+	0x0004003b,0x0000006e,0x00000120,0x00000007,
+	0x0004003b,0x0000006e,0x0000012a,0x00000007,
+	0x0004003b,0x0000006e,0x00000131,0x00000007,
+	0x0004003b,0x0000001d,0x00000139,0x00000007,
+	0x0004003b,0x0000013e,0x0000013c,0x00000007,
+	0x0004003b,0x0000013e,0x00000153,0x00000007,
+	0x0004003b,0x0000001d,0x00000155,0x00000007,
+	0x0004003b,0x0000001e,0x00000157,0x00000007,
+	0x0004003b,0x0000001d,0x0000015c,0x00000007,
+	0x0004003b,0x0000001e,0x00000161,0x00000007,
+	0x0004003b,0x0000001d,0x00000166,0x00000007,
+	0x0004003b,0x0000001e,0x00000169,0x00000007,
+	0x0003003e,0x00000103,0x00000104,0x0003003e,
+	0x00000105,0x00000106,0x0004003d,0x0000005b,
+	0x00000108,0x00000100,0x00050041,0x00000061,
+	0x00000109,0x00000100,0x00000024,0x0004003d,
+	0x00000007,0x0000010a,0x00000109,0x00050041,
+	0x00000061,0x0000010b,0x00000100,0x0000002b,
+	0x0004003d,0x00000007,0x0000010c,0x0000010b,
+	0x00050081,0x00000007,0x0000010d,0x0000010a,
+	0x0000010c,0x0004003d,0x00000007,0x0000010e,
+	0x00000103,0x00050085,0x00000007,0x0000010f,
+	0x0000010d,0x0000010e,0x00050050,0x0000005b,
+	0x00000110,0x0000010f,0x0000010f,0x00050081,
+	0x0000005b,0x00000111,0x00000108,0x00000110,
+	0x0006000c,0x0000005b,0x00000112,0x00000001,
+	0x00000008,0x00000111,0x0003003e,0x00000107,
+	0x00000112,0x0004003d,0x0000005b,0x00000114,
+	0x00000100,0x0004003d,0x0000005b,0x00000115,
+	0x00000107,0x00050083,0x0000005b,0x00000116,
+	0x00000114,0x00000115,0x00050041,0x00000061,
+	0x00000117,0x00000107,0x00000024,0x0004003d,
+	0x00000007,0x00000118,0x00000117,0x00050041,
+	0x00000061,0x00000119,0x00000107,0x0000002b,
+	0x0004003d,0x00000007,0x0000011a,0x00000119,
+	0x00050081,0x00000007,0x0000011b,0x00000118,
+	0x0000011a,0x0004003d,0x00000007,0x0000011c,
+	0x00000105,0x00050085,0x00000007,0x0000011d,
+	0x0000011b,0x0000011c,0x00050050,0x0000005b,
+	0x0000011e,0x0000011d,0x0000011d,0x00050081,
+	0x0000005b,0x0000011f,0x00000116,0x0000011e,
+	0x0003003e,0x00000113,0x0000011f,0x00050041,
+	0x00000061,0x00000121,0x00000113,0x00000024,
+	0x0004003d,0x00000007,0x00000122,0x00000121,
+	0x00050041,0x00000061,0x00000123,0x00000113,
+	0x0000002b,0x0004003d,0x00000007,0x00000124,
+	0x00000123,0x000500ba,0x00000126,0x00000125,
+	0x00000122,0x00000124,0x00050050,0x00000128,
+	0x00000127,0x00000125,0x00000125,0x000600a9,
+	0x0000005b,0x00000129,0x00000127,0x000000d6,
+	0x000000e1,0x0003003e,0x00000120,0x00000129,
+	0x0004003d,0x0000005b,0x0000012b,0x00000113,
+	0x0004003d,0x0000005b,0x0000012c,0x00000120,
+	0x00050083,0x0000005b,0x0000012d,0x0000012b,
+	0x0000012c,0x0004003d,0x00000007,0x0000012e,
+	0x00000105,0x00050050,0x0000005b,0x0000012f,
+	0x0000012e,0x0000012e,0x00050081,0x0000005b,
+	0x00000130,0x0000012d,0x0000012f,0x0003003e,
+	0x0000012a,0x00000130,0x0004003d,0x0000005b,
+	0x00000132,0x00000113,0x00050083,0x0000005b,
+	0x00000133,0x00000132,0x000000ec,0x0004003d,
+	0x00000007,0x00000135,0x00000105,0x00050085,
+	0x00000007,0x00000136,0x00000134,0x00000135,
+	0x00050050,0x0000005b,0x00000137,0x00000136,
+	0x00000136,0x00050081,0x0000005b,0x00000138,
+	0x00000133,0x00000137,0x0003003e,0x00000131,
+	0x00000138,0x0004003d,0x0000005b,0x0000013a,
+	0x00000107,0x0004006e,0x0000001c,0x0000013b,
+	0x0000013a,0x0003003e,0x00000139,0x0000013b,
+	0x0004003d,0x0000005b,0x0000013f,0x00000113,
+	0x0004003d,0x0000005b,0x00000140,0x00000113,
+	0x00050094,0x00000007,0x00000141,0x0000013f,
+	0x00000140,0x0004003d,0x0000005b,0x00000142,
+	0x0000012a,0x0004003d,0x0000005b,0x00000143,
+	0x0000012a,0x00050094,0x00000007,0x00000144,
+	0x00000142,0x00000143,0x0004003d,0x0000005b,
+	0x00000145,0x00000131,0x0004003d,0x0000005b,
+	0x00000146,0x00000131,0x00050094,0x00000007,
+	0x00000147,0x00000145,0x00000146,0x00060050,
+	0x0000013d,0x00000148,0x00000141,0x00000144,
+	0x00000147,0x00050083,0x0000013d,0x0000014a,
+	0x00000149,0x00000148,0x0007000c,0x0000013d,
+	0x0000014c,0x00000001,0x00000028,0x0000014a,
+	0x0000014b,0x0003003e,0x0000013c,0x0000014c,
+	0x0004003d,0x0000013d,0x0000014d,0x0000013c,
+	0x0004003d,0x0000013d,0x0000014e,0x0000013c,
+	0x00050085,0x0000013d,0x0000014f,0x0000014d,
+	0x0000014e,0x0003003e,0x0000013c,0x0000014f,
+	0x0004003d,0x0000013d,0x00000150,0x0000013c,
+	0x0004003d,0x0000013d,0x00000151,0x0000013c,
+	0x00050085,0x0000013d,0x00000152,0x00000150,
+	0x00000151,0x0003003e,0x0000013c,0x00000152,
+	0x0004003d,0x0000013d,0x00000154,0x0000013c,
+	0x0004003d,0x0000001c,0x00000156,0x00000139,
+	0x0003003e,0x00000155,0x00000156,0x0004003d,
+	0x00000002,0x00000158,0x00000101,0x0003003e,
+	0x00000157,0x00000158,0x00060039,0x0000005b,
+	0x00000159,0x00000011,0x00000155,0x00000157,
+	0x0004003d,0x0000005b,0x0000015a,0x00000113,
+	0x00050094,0x00000007,0x0000015b,0x00000159,
+	0x0000015a,0x0004003d,0x0000001c,0x0000015d,
+	0x00000139,0x0004003d,0x0000005b,0x0000015e,
+	0x00000120,0x0004006e,0x0000001c,0x0000015f,
+	0x0000015e,0x00050080,0x0000001c,0x00000160,
+	0x0000015d,0x0000015f,0x0003003e,0x0000015c,
+	0x00000160,0x0004003d,0x00000002,0x00000162,
+	0x00000101,0x0003003e,0x00000161,0x00000162,
+	0x00060039,0x0000005b,0x00000163,0x00000011,
+	0x0000015c,0x00000161,0x0004003d,0x0000005b,
+	0x00000164,0x0000012a,0x00050094,0x00000007,
+	0x00000165,0x00000163,0x00000164,0x0004003d,
+	0x0000001c,0x00000167,0x00000139,0x00050080,
+	0x0000001c,0x00000168,0x00000167,0x000000aa,
+	0x0003003e,0x00000166,0x00000168,0x0004003d,
+	0x00000002,0x0000016a,0x00000101,0x0003003e,
+	0x00000169,0x0000016a,0x00060039,0x0000005b,
+	0x0000016b,0x00000011,0x00000166,0x00000169,
+	0x0004003d,0x0000005b,0x0000016c,0x00000131,
+	0x00050094,0x00000007,0x0000016d,0x0000016b,
+	0x0000016c,0x00060050,0x0000013d,0x0000016e,
+	0x0000015b,0x00000165,0x0000016d,0x00050085,
+	0x0000013d,0x0000016f,0x00000154,0x0000016e,
+	0x0003003e,0x00000153,0x0000016f,0x00050041,
+	0x00000061,0x00000170,0x00000153,0x00000024,
+	0x0004003d,0x00000007,0x00000171,0x00000170,
+	0x00050041,0x00000061,0x00000172,0x00000153,
+	0x0000002b,0x0004003d,0x00000007,0x00000173,
+	0x00000172,0x00050081,0x00000007,0x00000174,
+	0x00000171,0x00000173,0x00050041,0x00000061,
+	0x00000176,0x00000153,0x00000175,0x0004003d,
+	0x00000007,0x00000177,0x00000176,0x00050081,
+	0x00000007,0x00000178,0x00000174,0x00000177,
+	0x00050085,0x00000007,0x0000017a,0x00000178,
+	0x00000179,0x00050081,0x00000007,0x0000017b,
+	0x0000017a,0x000000fe,0x000200fe,0x0000017b,
+	0x00010038,0x00050036,0x00000007,0x00000016,
+	0x00000000,0x00000083,0x00030037,0x0000006e,
+	0x0000017c,0x00030037,0x0000001e,0x0000017d,
+	0x000200f8,0x0000017e,0x0004003b,0x0000001d,
+	0x0000017f,0x00000007,0x0004003b,0x00000061,
+	0x00000183,0x00000007,0x0004003b,0x00000026,
+	0x00000184,0x00000007,0x0004003b,0x00000026,
+	0x0000018d,0x00000007,0x0004003b,0x0000001d,
+	0x00000195,0x00000007,0x0004003b,0x0000006e,
+	0x0000019b,0x00000007,0x0004003b,0x0000001d,
+	0x0000019e,0x00000007,0x0004003b,0x0000001e,
+	0x000001a0,0x00000007,0x0004003b,0x0000001d,
+	0x000001a3,0x00000007,0x0004003b,0x0000001e,
+	0x000001a5,0x00000007,0x0004003d,0x0000005b,
+	0x00000180,0x0000017c,0x0006000c,0x0000005b,
+	0x00000181,0x00000001,0x00000008,0x00000180,
+	0x0004006e,0x0000001c,0x00000182,0x00000181,
+	0x0003003e,0x0000017f,0x00000182,0x0003003e,
+	0x00000183,0x00000134,0x0003003e,0x00000184,
+	0x00000185,0x000200f9,0x00000186,0x000200f8,
+	0x00000186,0x000400f6,0x0000018a,0x00000189,
+	0x00000000,0x000200f9,0x00000187,0x000200f8,
+	0x00000187,0x0004003d,0x0000001b,0x0000018b,
+	0x00000184,0x000500b3,0x00000126,0x0000018c,
+	0x0000018b,0x0000002b,0x000400fa,0x0000018c,
+	0x00000188,0x0000018a,0x000200f8,0x00000188,
+	0x0003003e,0x0000018d,0x00000185,0x000200f9,
+	0x0000018e,0x000200f8,0x0000018e,0x000400f6,
+	0x00000192,0x00000191,0x00000000,0x000200f9,
+	0x0000018f,0x000200f8,0x0000018f,0x0004003d,
+	0x0000001b,0x00000193,0x0000018d,0x000500b3,
+	0x00000126,0x00000194,0x00000193,0x0000002b,
+	0x000400fa,0x00000194,0x00000190,0x00000192,
+	0x000200f8,0x00000190,0x0004003d,0x0000001c,
+	0x00000196,0x0000017f,0x0004003d,0x0000001b,
+	0x00000197,0x0000018d,0x0004003d,0x0000001b,
+	0x00000198,0x00000184,0x00050050,0x0000001c,
+	0x00000199,0x00000197,0x00000198,0x00050080,
+	0x0000001c,0x0000019a,0x00000196,0x00000199,
+	0x0003003e,0x00000195,0x0000019a,0x0004003d,
+	0x0000001c,0x0000019c,0x00000195,0x0004006f,
+	0x0000005b,0x0000019d,0x0000019c,0x0004003d,
+	0x0000001c,0x0000019f,0x00000195,0x0003003e,
+	0x0000019e,0x0000019f,0x0004003d,0x00000002,
+	0x000001a1,0x0000017d,0x0003003e,0x000001a0,
+	0x000001a1,0x00060039,0x00000007,0x000001a2,
+	0x00000010,0x0000019e,0x000001a0,0x0004003d,
+	0x0000001c,0x000001a4,0x00000195,0x0003003e,
+	0x000001a3,0x000001a4,0x0004003d,0x00000002,
+	0x000001a6,0x0000017d,0x000500c6,0x00000002,
+	0x000001a8,0x000001a6,0x000001a7,0x0003003e,
+	0x000001a5,0x000001a8,0x00060039,0x00000007,
+	0x000001a9,0x00000010,0x000001a3,0x000001a5,
+	0x00050050,0x0000005b,0x000001aa,0x000001a2,
+	0x000001a9,0x00050081,0x0000005b,0x000001ab,
+	0x0000019d,0x000001aa,0x0003003e,0x0000019b,
+	0x000001ab,0x0004003d,0x00000007,0x000001ac,
+	0x00000183,0x0004003d,0x0000005b,0x000001ad,
+	0x0000017c,0x0004003d,0x0000005b,0x000001ae,
+	0x0000019b,0x0007000c,0x00000007,0x000001af,
+	0x00000001,0x00000043,0x000001ad,0x000001ae,
+	0x0007000c,0x00000007,0x000001b0,0x00000001,
+	0x00000025,0x000001ac,0x000001af,0x0003003e,
+	0x00000183,0x000001b0,0x000200f9,0x00000191,
+	0x000200f8,0x00000191,0x0004003d,0x0000001b,
+	0x000001b1,0x0000018d,0x00050080,0x0000001b,
+	0x000001b2,0x000001b1,0x0000002b,0x0003003e,
+	0x0000018d,0x000001b2,0x000200f9,0x0000018e,
+	0x000200f8,0x00000192,0x000200f9,0x00000189,
+	0x000200f8,0x00000189,0x0004003d,0x0000001b,
+	0x000001b3,0x00000184,0x00050080,0x0000001b,
+	0x000001b4,0x000001b3,0x0000002b,0x0003003e,
+	0x00000184,0x000001b4,0x000200f9,0x00000186,
+	0x000200f8,0x0000018a,0x0004003d,0x00000007,
+	0x000001b5,0x00000183,0x000200fe,0x000001b5,
+	0x00010038,0x00050036,0x00000007,0x00000017,
+	0x00000000,0x000001b6,0x00030037,0x0000006e,
+	0x000001b7,0x000200f8,0x000001b8,0x0004003b,
+	0x00000061,0x000001b9,0x00000007,0x0004003b,
+	0x00000061,0x000001ba,0x00000007,0x0004003b,
+	0x00000061,0x000001bb,0x00000007,0x0004003b,
+	0x0000001e,0x000001bc,0x00000007,0x0004003b,
+	0x0000001e,0x000001c9,0x00000007,0x0004003b,
+	0x00000061,0x000001d1,0x00000007,0x0004003b,
+	0x0000006e,0x000001d9,0x00000007,0x0004003b,
+	0x0000001e,0x000001db,0x00000007,0x0004003b,
+	0x00000061,0x000001de,0x00000007,0x0004003b,
+	0x0000006e,0x000001e6,0x00000007,0x0004003b,
+	0x0000001e,0x000001e8,0x00000007,0x0004003b,
+	0x00000061,0x000001eb,0x00000007,0x0004003b,
+	0x0000006e,0x000001ec,0x00000007,0x0004003b,
+	0x0000001e,0x000001ee,0x00000007,0x0003003e,
+	0x000001b9,0x000000d5,0x0003003e,0x000001ba,
+	0x000000d5,0x0003003e,0x000001bb,0x00000057,
+	0x0003003e,0x000001bc,0x000001bd,0x000200f9,
+	0x000001be,0x000200f8,0x000001be,0x000400f6,
+	0x000001c2,0x000001c1,0x00000000,0x000200f9,
+	0x000001bf,0x000200f8,0x000001bf,0x0004003d,
+	0x00000002,0x000001c3,0x000001bc,0x00050041,
+	0x000001c6,0x000001c5,0x0000000a,0x000001c4,
+	0x0004003d,0x00000002,0x000001c7,0x000001c5,
+	0x000500b0,0x00000126,0x000001c8,0x000001c3,
+	0x000001c7,0x000400fa,0x000001c8,0x000001c0,
+	0x000001c2,0x000200f8,0x000001c0,0x00050041,
+	0x000001c6,0x000001cb,0x0000000a,0x000001ca,
+	0x0004003d,0x00000002,0x000001cc,0x000001cb,
+	0x0004003d,0x00000002,0x000001cd,0x000001bc,
+	0x00050084,0x00000002,0x000001cf,0x000001cd,
+	0x000001ce,0x00050080,0x00000002,0x000001d0,
+	0x000001cc,0x000001cf,0x0003003e,0x000001c9,
+	0x000001d0,0x00050041,0x000001c6,0x000001d3,
+	0x0000000a,0x000001d2,0x0004003d,0x00000002,
+	0x000001d4,0x000001d3,0x000500aa,0x00000126,
+	0x000001d5,0x000001d4,0x000001bd,0x000300f7,
+	0x000001d6,0x00000000,0x000400fa,0x000001d5,
+	0x000001d7,0x000001d8,0x000200f8,0x000001d7,
+	0x0004003d,0x0000005b,0x000001da,0x000001b7,
+	0x0003003e,0x000001d9,0x000001da,0x0004003d,
+	0x00000002,0x000001dc,0x000001c9,0x0003003e,
+	0x000001db,0x000001dc,0x00060039,0x00000007,
+	0x000001dd,0x00000013,0x000001d9,0x000001db,
+	0x0003003e,0x000001de,0x000001dd,0x000200f9,
+	0x000001d6,0x000200f8,0x000001d8,0x00050041,
+	0x000001c6,0x000001df,0x0000000a,0x000001d2,
+	0x0004003d,0x00000002,0x000001e0,0x000001df,
+	0x000500aa,0x00000126,0x000001e2,0x000001e0,
+	0x000001e1,0x000300f7,0x000001e3,0x00000000,
+	0x000400fa,0x000001e2,0x000001e4,0x000001e5,
+	0x000200f8,0x000001e4,0x0004003d,0x0000005b,
+	0x000001e7,0x000001b7,0x0003003e,0x000001e6,
+	0x000001e7,0x0004003d,0x00000002,0x000001e9,
+	0x000001c9,0x0003003e,0x000001e8,0x000001e9,
+	0x00060039,0x00000007,0x000001ea,0x00000014,
+	0x000001e6,0x000001e8,0x0003003e,0x000001eb,
+	0x000001ea,0x000200f9,0x000001e3,0x000200f8,
+	0x000001e5,0x0004003d,0x0000005b,0x000001ed,
+	0x000001b7,0x0003003e,0x000001ec,0x000001ed,
+	0x0004003d,0x00000002,0x000001ef,0x000001c9,
+	0x0003003e,0x000001ee,0x000001ef,0x00060039,
+	0x00000007,0x000001f0,0x00000015,0x000001ec,
+	0x000001ee,0x0003003e,0x000001eb,0x000001f0,
+	0x000200f9,0x000001e3,0x000200f8,0x000001e3,
+	0x0004003d,0x00000007,0x000001f1,0x000001eb,
+	0x0003003e,0x000001de,0x000001f1,0x000200f9,
+	0x000001d6,0x000200f8,0x000001d6,0x0004003d,
+	0x00000007,0x000001f2,0x000001de,0x0003003e,
+	0x000001d1,0x000001f2,0x0004003d,0x00000007,
+	0x000001f3,0x000001b9,0x0004003d,0x00000007,
+	0x000001f4,0x000001d1,0x0004003d,0x00000007,
+	0x000001f5,0x000001bb,0x00050085,0x00000007,
+	0x000001f6,0x000001f4,0x000001f5,0x00050081,
+	0x00000007,0x000001f7,0x000001f3,0x000001f6,
+	0x0003003e,0x000001b9,0x000001f7,0x0004003d,
+	0x00000007,0x000001f8,0x000001ba,0x0004003d,
+	0x00000007,0x000001f9,0x000001bb,0x00050081,
+	0x00000007,0x000001fa,0x000001f8,0x000001f9,
+	0x0003003e,0x000001ba,0x000001fa,0x0004003d,
+	0x0000005b,0x000001fb,0x000001b7,0x00050041,
+	0x000001fe,0x000001fd,0x0000000a,0x000001fc,
+	0x0004003d,0x00000007,0x000001ff,0x000001fd,
+	0x0005008e,0x0000005b,0x00000200,0x000001fb,
+	0x000001ff,0x0003003e,0x000001b7,0x00000200,
+	0x0004003d,0x00000007,0x00000201,0x000001bb,
+	0x00050041,0x000001fe,0x00000203,0x0000000a,
+	0x00000202,0x0004003d,0x00000007,0x00000204,
+	0x00000203,0x00050085,0x00000007,0x00000205,
+	0x00000201,0x00000204,0x0003003e,0x000001bb,
+	0x00000205,0x000200f9,0x000001c1,0x000200f8,
+	0x000001c1,0x0004003d,0x00000002,0x00000206,
+	0x000001bc,0x00050080,0x00000002,0x00000207,
+	0x00000206,0x000001e1,0x0003003e,0x000001bc,
+	0x00000207,0x000200f9,0x000001be,0x000200f8,
+	0x000001c2,0x0004003d,0x00000007,0x00000208,
+	0x000001ba,0x000500ba,0x00000126,0x00000209,
+	0x00000208,0x000000d5,0x0004003d,0x00000007,
+	0x0000020a,0x000001b9,0x0004003d,0x00000007,
+	0x0000020b,0x000001ba,0x00050088,0x00000007,
+	0x0000020c,0x0000020a,0x0000020b,0x000600a9,
+	0x00000007,0x0000020d,0x00000209,0x0000020c,
+	0x000000d5,0x000200fe,0x0000020d,0x00010038,
+	0x00050036,0x00000007,0x00000018,0x00000000,
+	0x0000020e,0x00030037,0x00000061,0x0000020f,
+	0x000200f8,0x00000210,0x0004003d,0x00000007,
+	0x00000211,0x0000020f,0x000500bc,0x00000126,
+	0x00000213,0x00000211,0x00000212,0x0004003d,
+	0x00000007,0x00000214,0x0000020f,0x00050085,
+	0x00000007,0x00000216,0x00000214,0x00000215,
+	0x0004003d,0x00000007,0x00000218,0x0000020f,
+	0x0007000c,0x00000007,0x00000219,0x00000001,
+	0x00000028,0x00000218,0x000000d5,0x00050088,
+	0x00000007,0x0000021b,0x00000057,0x0000021a,
+	0x0007000c,0x00000007,0x0000021c,0x00000001,
+	0x0000001a,0x00000219,0x0000021b,0x00050085,
+	0x00000007,0x0000021d,0x00000217,0x0000021c,
+	0x00050083,0x00000007,0x0000021f,0x0000021d,
+	0x0000021e,0x000600a9,0x00000007,0x00000220,
+	0x00000213,0x00000216,0x0000021f,0x000200fe,
+	0x00000220,0x00010038,0x00050036,0x00000221,
+	0x00000019,0x00000000,0x00000223,0x00030037,
+	0x0000001e,0x00000224,0x00030037,0x0000001e,
+	0x00000225,0x00030037,0x00000222,0x00000226,
+	0x000200f8,0x00000227,0x0004003b,0x00000246,
+	0x00000244,0x00000007,0x0004003b,0x00000061,
+	0x00000267,0x00000007,0x0004003b,0x00000061,
+	0x0000026b,0x00000007,0x0004003b,0x00000061,
+	0x0000026f,0x00000007,0x0004003d,0x00000002,
+	0x00000228,0x00000225,0x000500c7,0x00000002,
+	0x0000022a,0x00000228,0x00000229,0x000500aa,
+	0x00000126,0x0000022c,0x0000022a,0x0000022b,
+	0x000300f7,0x0000022d,0x00000000,0x000400fa,
+	0x0000022c,0x0000022e,0x0000022f,0x000200f8,
+	0x0000022e,0x0004003d,0x00000002,0x00000230,
+	0x00000224,0x00050084,0x00000002,0x00000231,
+	0x00000230,0x0000022b,0x0004003d,0x00000008,
+	0x00000232,0x00000226,0x0007004f,0x0000005b,
+	0x00000233,0x00000232,0x00000232,0x00000000,
+	0x00000001,0x0006000c,0x00000002,0x00000234,
+	0x00000001,0x0000003a,0x00000233,0x00060041,
+	0x00000236,0x00000235,0x00000005,0x00000024,
+	0x00000231,0x0003003e,0x00000235,0x00000234,
+	0x0004003d,0x00000002,0x00000237,0x00000224,
+	0x00050084,0x00000002,0x00000238,0x00000237,
+	0x0000022b,0x00050080,0x00000002,0x00000239,
+	0x00000238,0x000001e1,0x0004003d,0x00000008,
+	0x0000023a,0x00000226,0x0007004f,0x0000005b,
+	0x0000023b,0x0000023a,0x0000023a,0x00000002,
+	0x00000003,0x0006000c,0x00000002,0x0000023c,
+	0x00000001,0x0000003a,0x0000023b,0x00060041,
+	0x00000236,0x0000023d,0x00000005,0x00000024,
+	0x00000239,0x0003003e,0x0000023d,0x0000023c,
+	0x000200f9,0x0000022d,0x000200f8,0x0000022f,
+	0x0004003d,0x00000002,0x0000023e,0x00000225,
+	0x000500c7,0x00000002,0x0000023f,0x0000023e,
+	0x00000229,0x000500aa,0x00000126,0x00000240,
+	0x0000023f,0x00000229,0x000300f7,0x00000241,
+	0x00000000,0x000400fa,0x00000240,0x00000242,
+	0x00000243,0x000200f8,0x00000242,0x0004003d,
+	0x00000008,0x00000247,0x00000226,0x0004007c,
+	0x00000245,0x00000248,0x00000247,0x0003003e,
+	0x00000244,0x00000248,0x0004003d,0x00000002,
+	0x00000249,0x00000224,0x00050084,0x00000002,
+	0x0000024b,0x00000249,0x0000024a,0x00050041,
+	0x0000001e,0x0000024c,0x00000244,0x00000024,
+	0x0004003d,0x00000002,0x0000024d,0x0000024c,
+	0x00060041,0x00000236,0x0000024e,0x00000005,
+	0x00000024,0x0000024b,0x0003003e,0x0000024e,
+	0x0000024d,0x0004003d,0x00000002,0x0000024f,
+	0x00000224,0x00050084,0x00000002,0x00000250,
+	0x0000024f,0x0000024a,0x00050080,0x00000002,
+	0x00000251,0x00000250,0x000001e1,0x00050041,
+	0x0000001e,0x00000252,0x00000244,0x0000002b,
+	0x0004003d,0x00000002,0x00000253,0x00000252,
+	0x00060041,0x00000236,0x00000254,0x00000005,
+	0x00000024,0x00000251,0x0003003e,0x00000254,
+	0x00000253,0x0004003d,0x00000002,0x00000255,
+	0x00000224,0x00050084,0x00000002,0x00000256,
+	0x00000255,0x0000024a,0x00050080,0x00000002,
+	0x00000257,0x00000256,0x0000022b,0x00050041,
+	0x0000001e,0x00000258,0x00000244,0x00000175,
+	0x0004003d,0x00000002,0x00000259,0x00000258,
+	0x00060041,0x00000236,0x0000025a,0x00000005,
+	0x00000024,0x00000257,0x0003003e,0x0000025a,
+	0x00000259,0x0004003d,0x00000002,0x0000025b,
+	0x00000224,0x00050084,0x00000002,0x0000025c,
+	0x0000025b,0x0000024a,0x00050080,0x00000002,
+	0x0000025d,0x0000025c,0x00000229,0x00050041,
+	0x0000001e,0x0000025f,0x00000244,0x0000025e,
+	0x0004003d,0x00000002,0x00000260,0x0000025f,
+	0x00060041,0x00000236,0x00000261,0x00000005,
+	0x00000024,0x0000025d,0x0003003e,0x00000261,
+	0x00000260,0x000200f9,0x00000241,0x000200f8,
+	0x00000243,0x0004003d,0x00000002,0x00000262,
+	0x00000225,0x000500c7,0x00000002,0x00000263,
+	0x00000262,0x0000024a,0x000500ab,0x00000126,
+	0x00000264,0x00000263,0x000001bd,0x000300f7,
+	0x00000265,0x00000000,0x000400fa,0x00000264,
+	0x00000266,0x00000265,0x000200f8,0x00000266,
+	0x00050041,0x00000061,0x00000268,0x00000226,
+	0x00000024,0x0004003d,0x00000007,0x00000269,
+	0x00000268,0x0003003e,0x00000267,0x00000269,
+	0x00050039,0x00000007,0x0000026a,0x00000018,
+	0x00000267,0x00050041,0x00000061,0x0000026c,
+	0x00000226,0x0000002b,0x0004003d,0x00000007,
+	0x0000026d,0x0000026c,0x0003003e,0x0000026b,
+	0x0000026d,0x00050039,0x00000007,0x0000026e,
+	0x00000018,0x0000026b,0x00050041,0x00000061,
+	0x00000270,0x00000226,0x00000175,0x0004003d,
+	0x00000007,0x00000271,0x00000270,0x0003003e,
+	0x0000026f,0x00000271,0x00050039,0x00000007,
+	0x00000272,0x00000018,0x0000026f,0x00060050,
+	0x0000013d,0x00000273,0x0000026a,0x0000026e,
+	0x00000272,0x0004003d,0x00000008,0x00000274,
+	0x00000226,0x0009004f,0x00000008,0x00000275,
+	0x00000274,0x00000273,0x00000004,0x00000005,
+	0x00000006,0x00000003,0x0003003e,0x00000226,
+	0x00000275,0x000200f9,0x00000265,0x000200f8,
+	0x00000265,0x0004003d,0x00000002,0x00000276,
+	0x00000225,0x000500c7,0x00000002,0x00000277,
+	0x00000276,0x00000229,0x000500aa,0x00000126,
+	0x00000278,0x00000277,0x000001e1,0x000300f7,
+	0x00000279,0x00000000,0x000400fa,0x00000278,
+	0x0000027a,0x00000279,0x000200f8,0x0000027a,
+	0x0004003d,0x00000008,0x0000027b,0x00000226,
+	0x0009004f,0x00000008,0x0000027c,0x0000027b,
+	0x0000027b,0x00000002,0x00000001,0x00000000,
+	0x00000003,0x0003003e,0x00000226,0x0000027c,
+	0x000200f9,0x00000279,0x000200f8,0x00000279,
+	0x0004003d,0x00000002,0x0000027d,0x00000224,
+	0x0004003d,0x00000008,0x0000027e,0x00000226,
+	0x0006000c,0x00000002,0x0000027f,0x00000001,
+	0x00000037,0x0000027e,0x00060041,0x00000236,
+	0x00000280,0x00000005,0x00000024,0x0000027d,
+	0x0003003e,0x00000280,0x0000027f,0x000200f9,
+	0x00000241,0x000200f8,0x00000241,0x000200f9,
+	0x0000022d,0x000200f8,0x0000022d,0x000100fd,
+	0x00010038,0x00050036,0x00000221,0x0000001a,
+	0x00000000,0x00000281,0x000200f8,0x00000282,
+	0x0004003b,0x00000285,0x00000283,0x00000007,
+	0x0004003b,0x0000006e,0x00000297,0x00000007,
+	0x0004003b,0x0000006e,0x000002a4,0x00000007,
+	0x0004003b,0x00000061,0x000002af,0x00000007,
+	0x0004003b,0x0000006e,0x000002b6,0x00000007,
+	0x0004003b,0x0000006e,0x000002bf,0x00000007,
+	0x0004003b,0x0000001d,0x000002ef,0x00000007,
+	0x0004003b,0x0000006e,0x000002fa,0x00000007,
+	0x0004003b,0x0000001e,0x000002fc,0x00000007,
+	0x0004003b,0x0000001e,0x00000300,0x00000007,
+	0x0004003b,0x0000001e,0x00000309,0x00000007,
+	0x0004003b,0x00000222,0x0000030d,0x00000007,
+	0x0004003d,0x0000000d,0x00000286,0x0000000c,
+	0x0007004f,0x00000284,0x00000287,0x00000286,
+	0x00000286,0x00000000,0x00000001,0x0003003e,
+	0x00000283,0x00000287,0x00050041,0x0000001e,
+	0x00000288,0x00000283,0x00000024,0x0004003d,
+	0x00000002,0x00000289,0x00000288,0x00050041,
+	0x000001c6,0x0000028b,0x0000000a,0x0000028a,
+	0x0004003d,0x00000002,0x0000028c,0x0000028b,
+	0x000500ae,0x00000126,0x0000028d,0x00000289,
+	0x0000028c,0x00050041,0x0000001e,0x0000028e,
+	0x00000283,0x0000002b,0x0004003d,0x00000002,
+	0x0000028f,0x0000028e,0x00050041,0x000001c6,
+	0x00000291,0x0000000a,0x00000290,0x0004003d,
+	0x00000002,0x00000292,0x00000291,0x000500ae,
+	0x00000126,0x00000293,0x0000028f,0x00000292,
+	0x000500a6,0x00000126,0x00000294,0x0000028d,
+	0x00000293,0x000300f7,0x00000295,0x00000000,
+	0x000400fa,0x00000294,0x00000296,0x00000295,
+	0x000200f8,0x00000296,0x000100fd,0x000200f8,
+	0x00000295,0x00050041,0x000001c6,0x00000299,
+	0x0000000a,0x00000298,0x0004003d,0x00000002,
+	0x0000029a,0x00000299,0x00050041,0x000001c6,
+	0x0000029c,0x0000000a,0x0000029b,0x0004003d,
+	0x00000002,0x0000029d,0x0000029c,0x00050050,
+	0x00000284,0x0000029e,0x0000029a,0x0000029d,
+	0x0004003d,0x00000284,0x0000029f,0x00000283,
+	0x00050080,0x00000284,0x000002a0,0x0000029e,
+	0x0000029f,0x00040070,0x0000005b,0x000002a1,
+	0x000002a0,0x00050081,0x0000005b,0x000002a3,
+	0x000002a1,0x000002a2,0x0003003e,0x00000297,
+	0x000002a3,0x0004003d,0x0000005b,0x000002a5,
+	0x00000297,0x00050041,0x000002a7,0x000002a6,
+	0x0000000a,0x00000175,0x0004003d,0x00000008,
+	0x000002a8,0x000002a6,0x0007004f,0x0000005b,
+	0x000002a9,0x000002a8,0x000002a8,0x00000000,
+	0x00000001,0x00050081,0x0000005b,0x000002aa,
+	0x000002a5,0x000002a9,0x00050041,0x000001fe,
+	0x000002ab,0x0000000a,0x0000025e,0x0004003d,
+	0x00000007,0x000002ac,0x000002ab,0x00050050,
+	0x0000005b,0x000002ad,0x000002ac,0x000002ac,
+	0x00050088,0x0000005b,0x000002ae,0x000002aa,
+	0x000002ad,0x0003003e,0x000002a4,0x000002ae,
+	0x00050041,0x000001c6,0x000002b0,0x0000000a,
+	0x000001d2,0x0004003d,0x00000002,0x000002b1,
+	0x000002b0,0x000500b2,0x00000126,0x000002b2,
+	0x000002b1,0x0000022b,0x000300f7,0x000002b3,
+	0x00000000,0x000400fa,0x000002b2,0x000002b4,
+	0x000002b5,0x000200f8,0x000002b4,0x0004003d,
+	0x0000005b,0x000002b7,0x000002a4,0x0003003e,
+	0x000002b6,0x000002b7,0x00050039,0x00000007,
+	0x000002b8,0x00000017,0x000002b6,0x0003003e,
+	0x000002af,0x000002b8,0x000200f9,0x000002b3,
+	0x000200f8,0x000002b5,0x00050041,0x000001c6,
+	0x000002b9,0x0000000a,0x000001d2,0x0004003d,
+	0x00000002,0x000002ba,0x000002b9,0x000500aa,
+	0x00000126,0x000002bb,0x000002ba,0x00000229,
+	0x000300f7,0x000002bc,0x00000000,0x000400fa,
+	0x000002bb,0x000002bd,0x000002be,0x000200f8,
+	0x000002bd,0x00050041,0x000002a7,0x000002c0,
+	0x0000000a,0x00000175,0x0004003d,0x00000008,
+	0x000002c1,0x000002c0,0x0007004f,0x0000005b,
+	0x000002c2,0x000002c1,0x000002c1,0x00000002,
+	0x00000003,0x00050041,0x000002a7,0x000002c3,
+	0x0000000a,0x00000175,0x0004003d,0x00000008,
+	0x000002c4,0x000002c3,0x0007004f,0x0000005b,
+	0x000002c5,0x000002c4,0x000002c4,0x00000000,
+	0x00000001,0x00050083,0x0000005b,0x000002c6,
+	0x000002c2,0x000002c5,0x0003003e,0x000002bf,
+	0x000002c6,0x0004003d,0x0000005b,0x000002c7,
+	0x00000297,0x00050041,0x000002a7,0x000002c8,
+	0x0000000a,0x00000175,0x0004003d,0x00000008,
+	0x000002c9,0x000002c8,0x0007004f,0x0000005b,
+	0x000002ca,0x000002c9,0x000002c9,0x00000000,
+	0x00000001,0x00050083,0x0000005b,0x000002cb,
+	0x000002c7,0x000002ca,0x0004003d,0x0000005b,
+	0x000002cc,0x000002bf,0x00050094,0x00000007,
+	0x000002cd,0x000002cb,0x000002cc,0x0004003d,
+	0x0000005b,0x000002ce,0x000002bf,0x0004003d,
+	0x0000005b,0x000002cf,0x000002bf,0x00050094,
+	0x00000007,0x000002d0,0x000002ce,0x000002cf,
+	0x0007000c,0x00000007,0x000002d2,0x00000001,
+	0x00000028,0x000002d0,0x000002d1,0x00050088,
+	0x00000007,0x000002d3,0x000002cd,0x000002d2,
+	0x0003003e,0x000002af,0x000002d3,0x000200f9,
+	0x000002bc,0x000200f8,0x000002be,0x00050041,
+	0x000001c6,0x000002d4,0x0000000a,0x000001d2,
+	0x0004003d,0x00000002,0x000002d5,0x000002d4,
+	0x000500aa,0x00000126,0x000002d6,0x000002d5,
+	0x0000024a,0x000300f7,0x000002d7,0x00000000,
+	0x000400fa,0x000002d6,0x000002d8,0x000002d9,
+	0x000200f8,0x000002d8,0x0004003d,0x0000005b,
+	0x000002da,0x00000297,0x00050041,0x000002a7,
+	0x000002db,0x0000000a,0x00000175,0x0004003d,
+	0x00000008,0x000002dc,0x000002db,0x0007004f,
+	0x0000005b,0x000002dd,0x000002dc,0x000002dc,
+	0x00000000,0x00000001,0x0007000c,0x00000007,
+	0x000002de,0x00000001,0x00000043,0x000002da,
+	0x000002dd,0x00050041,0x000002a7,0x000002df,
+	0x0000000a,0x00000175,0x0004003d,0x00000008,
+	0x000002e0,0x000002df,0x0007004f,0x0000005b,
+	0x000002e1,0x000002e0,0x000002e0,0x00000002,
+	0x00000003,0x00050041,0x000002a7,0x000002e2,
+	0x0000000a,0x00000175,0x0004003d,0x00000008,
+	0x000002e3,0x000002e2,0x0007004f,0x0000005b,
+	0x000002e4,0x000002e3,0x000002e3,0x00000000,
+	0x00000001,0x0007000c,0x00000007,0x000002e5,
+	0x00000001,0x00000043,0x000002e1,0x000002e4,
+	0x0007000c,0x00000007,0x000002e6,0x00000001,
+	0x00000028,0x000002e5,0x000002d1,0x00050088,
+	0x00000007,0x000002e7,0x000002de,0x000002e6,
+	0x0003003e,0x000002af,0x000002e7,0x000200f9,
+	0x000002d7,0x000200f8,0x000002d9,0x00050041,
+	0x000001c6,0x000002e8,0x0000000a,0x000001d2,
+	0x0004003d,0x00000002,0x000002e9,0x000002e8,
+	0x000500aa,0x00000126,0x000002eb,0x000002e9,
+	0x000002ea,0x000300f7,0x000002ec,0x00000000,
+	0x000400fa,0x000002eb,0x000002ed,0x000002ee,
+	0x000200f8,0x000002ed,0x0004003d,0x0000005b,
+	0x000002f0,0x000002a4,0x0006000c,0x0000005b,
+	0x000002f1,0x00000001,0x00000008,0x000002f0,
+	0x0004006e,0x0000001c,0x000002f2,0x000002f1,
+	0x0003003e,0x000002ef,0x000002f2,0x00050041,
+	0x00000026,0x000002f3,0x000002ef,0x00000024,
+	0x0004003d,0x0000001b,0x000002f4,0x000002f3,
+	0x00050041,0x00000026,0x000002f5,0x000002ef,
+	0x0000002b,0x0004003d,0x0000001b,0x000002f6,
+	0x000002f5,0x00050080,0x0000001b,0x000002f7,
+	0x000002f4,0x000002f6,0x000500c7,0x0000001b,
+	0x000002f8,0x000002f7,0x0000002b,0x0004006f,
+	0x00000007,0x000002f9,0x000002f8,0x0003003e,
+	0x000002af,0x000002f9,0x000200f9,0x000002ec,
+	0x000200f8,0x000002ee,0x0004003d,0x0000005b,
+	0x000002fb,0x000002a4,0x0003003e,0x000002fa,
+	0x000002fb,0x00050041,0x000001c6,0x000002fd,
+	0x0000000a,0x000001ca,0x0004003d,0x00000002,
+	0x000002fe,0x000002fd,0x0003003e,0x000002fc,
+	0x000002fe,0x00060039,0x00000007,0x000002ff,
+	0x00000016,0x000002fa,0x000002fc,0x0003003e,
+	0x000002af,0x000002ff,0x000200f9,0x000002ec,
+	0x000200f8,0x000002ec,0x000200f9,0x000002d7,
+	0x000200f8,0x000002d7,0x000200f9,0x000002bc,
+	0x000200f8,0x000002bc,0x000200f9,0x000002b3,
+	0x000200f8,0x000002b3,0x00050041,0x0000001e,
+	0x00000301,0x00000283,0x0000002b,0x0004003d,
+	0x00000002,0x00000302,0x00000301,0x00050041,
+	0x000001c6,0x00000303,0x0000000a,0x0000028a,
+	0x0004003d,0x00000002,0x00000304,0x00000303,
+	0x00050084,0x00000002,0x00000305,0x00000302,
+	0x00000304,0x00050041,0x0000001e,0x00000306,
+	0x00000283,0x00000024,0x0004003d,0x00000002,
+	0x00000307,0x00000306,0x00050080,0x00000002,
+	0x00000308,0x00000305,0x00000307,0x0003003e,
+	0x00000300,0x00000308,0x00050041,0x000001c6,
+	0x0000030b,0x0000000a,0x0000030a,0x0004003d,
+	0x00000002,0x0000030c,0x0000030b,0x0003003e,
+	0x00000309,0x0000030c,0x00050041,0x000002a7,
+	0x0000030e,0x0000000a,0x00000024,0x0004003d,
+	0x00000008,0x0000030f,0x0000030e,0x00050041,
+	0x000002a7,0x00000310,0x0000000a,0x0000002b,
+	0x0004003d,0x00000008,0x00000311,0x00000310,
+	0x0004003d,0x00000007,0x00000312,0x000002af,
+	0x0008000c,0x00000007,0x00000313,0x00000001,
+	0x0000002b,0x00000312,0x000000d5,0x00000057,
+	0x00070050,0x00000008,0x00000314,0x00000313,
+	0x00000313,0x00000313,0x00000313,0x0008000c,
+	0x00000008,0x00000315,0x00000001,0x0000002e,
+	0x0000030f,0x00000311,0x00000314,0x0003003e,
+	0x0000030d,0x00000315,0x00070039,0x00000221,
+	0x00000316,0x00000019,0x00000300,0x00000309,
+	0x0000030d,0x000100fd,0x00010038
+};
+
+// Source of compute shader encoding a 4x4 block of storage buffer texels per thread into BC1, BC3 or BC7, the format is
+// picked by specialization constant 0 (filename: compress.comp). It follows the compressBC1, compressBC3 and compressBC7
+// kernels of RenderAPI_Metal.mm and encodes the same blocks as the CPU encoders of BlockCompression.h.
+/*
+#version 450
+layout(local_size_x = 8, local_size_y = 8) in;
+layout(constant_id = 0) const uint kFormat = 0u;
+layout(std430, binding = 0) readonly buffer Source { uint texels[]; } source;
+layout(std430, binding = 1) buffer Blocks { uint words[]; } blocks;
+layout(push_constant) uniform Params
+{
+    uint width;
+    uint height;
+    uint blocksWide;
+    uint blocksHigh;
+    uint quality;
+    uint sourceFormat;
+} params;
+
+const float kBC7Weights[16] = float[16](0.0, 4.0, 9.0, 13.0, 17.0, 21.0, 26.0, 30.0, 34.0, 38.0, 43.0, 47.0, 51.0, 55.0, 60.0, 64.0);
+
+vec4 pixels[16];
+
+float toLinear(float c)
+{
+    return c <= 0.04045 ? c / 12.92 : pow((max(c, 0.0) + 0.055) / 1.055, 2.4);
+}
+
+// Texel formats: 0 RGBA8, 1 BGRA8, 2 RGBA16F, 3 RGBA32F, +4 to decode sRGB 8 bit ones. Pixels range from 0 to 255.
+vec4 loadPixel(uint index)
+{
+    uint format = params.sourceFormat;
+    vec4 color;
+    if ((format & 3u) == 2u)
+        color = vec4(unpackHalf2x16(source.texels[index * 2u]), unpackHalf2x16(source.texels[index * 2u + 1u]));
+    else if ((format & 3u) == 3u)
+        color = uintBitsToFloat(uvec4(source.texels[index * 4u], source.texels[index * 4u + 1u], source.texels[index * 4u + 2u], source.texels[index * 4u + 3u]));
+    else
+    {
+        uint texel = source.texels[index];
+        color = vec4(uvec4(texel, texel >> 8u, texel >> 16u, texel >> 24u) & 255u);
+        if ((format & 3u) == 1u)
+            color = color.bgra;
+        if ((format & 4u) == 0u)
+            return color;
+        color /= 255.0;
+        color.rgb = vec3(toLinear(color.r), toLinear(color.g), toLinear(color.b));
+    }
+    return clamp(color, 0.0, 1.0) * 255.0;
+}
+
+void findEndpoints(uint quality, uint channelCount, out vec4 low, out vec4 high)
+{
+    low = pixels[0];
+    high = pixels[0];
+    vec4 mean = vec4(0.0);
+    for (uint i = 0u; i < 16u; i++)
+    {
+        low = min(low, pixels[i]);
+        high = max(high, pixels[i]);
+        mean += pixels[i];
+    }
+    mean /= 16.0;
+    if (quality == 0u)
+        return;
+
+    vec4 channels = channelCount == 3u ? vec4(1.0, 1.0, 1.0, 0.0) : vec4(1.0);
+    vec4 covariance[4] = vec4[4](vec4(0.0), vec4(0.0), vec4(0.0), vec4(0.0));
+    for (uint i = 0u; i < 16u; i++)
+    {
+        vec4 d = (pixels[i] - mean) * channels;
+        covariance[0] += d * d.x;
+        covariance[1] += d * d.y;
+        covariance[2] += d * d.z;
+        covariance[3] += d * d.w;
+    }
+    vec4 axis = (high - low) * channels;
+    for (uint i = 0u; i < 8u; i++)
+    {
+        axis = covariance[0] * axis.x + covariance[1] * axis.y + covariance[2] * axis.z + covariance[3] * axis.w;
+        axis /= max(max(max(max(1e-6, abs(axis.x)), abs(axis.y)), abs(axis.z)), abs(axis.w));
+    }
+    float lengthSquared = dot(axis, axis);
+    if (lengthSquared < 1e-6)
+        return;
+    axis /= sqrt(lengthSquared);
+
+    float minT = 0.0;
+    float maxT = 0.0;
+    for (uint i = 0u; i < 16u; i++)
+    {
+        float t = dot((pixels[i] - mean) * channels, axis);
+        minT = min(minT, t);
+        maxT = max(maxT, t);
+    }
+    vec4 fitLow = clamp(mean + axis * minT, 0.0, 255.0);
+    vec4 fitHigh = clamp(mean + axis * maxT, 0.0, 255.0);
+    low = vec4(fitLow.rgb, channelCount == 3u ? low.a : fitLow.a);
+    high = vec4(fitHigh.rgb, channelCount == 3u ? high.a : fitHigh.a);
+}
+
+uint packRGB565(vec3 color)
+{
+    uvec3 c = uvec3(floor(clamp(color, 0.0, 255.0) * vec3(31.0, 63.0, 31.0) / 255.0 + 0.5));
+    return (c.x << 11u) | (c.y << 5u) | c.z;
+}
+
+vec3 unpackRGB565(uint color)
+{
+    return vec3(uvec3(color >> 11u, color >> 5u, color) & uvec3(31u, 63u, 31u)) * 255.0 / vec3(31.0, 63.0, 31.0);
+}
+
+// BC1 block in 4 color mode, color0 above color1
+uvec2 encodeColorBlock(uint quality)
+{
+    vec4 low;
+    vec4 high;
+    findEndpoints(quality, 3u, low, high);
+    uint color0 = packRGB565(high.rgb);
+    uint color1 = packRGB565(low.rgb);
+    if (color0 < color1)
+    {
+        uint swapped = color0;
+        color0 = color1;
+        color1 = swapped;
+    }
+    if (color0 == color1)
+        return uvec2(color0 | (color1 << 16u), 0u);
+
+    vec3 end0 = unpackRGB565(color0);
+    vec3 end1 = unpackRGB565(color1);
+    vec3 palette[4] = vec3[4](end0, end1, (2.0 * end0 + end1) / 3.0, (end0 + 2.0 * end1) / 3.0);
+    uint indices = 0u;
+    for (uint i = 0u; i < 16u; i++)
+    {
+        uint best = 0u;
+        float bestDistance = 1e30;
+        for (uint j = 0u; j < 4u; j++)
+        {
+            vec3 d = pixels[i].rgb - palette[j];
+            if (dot(d, d) < bestDistance)
+            {
+                best = j;
+                bestDistance = dot(d, d);
+            }
+        }
+        indices |= best << (i * 2u);
+    }
+    return uvec2(color0 | (color1 << 16u), indices);
+}
+
+// BC4 block of the alpha channel in 8 value mode, alpha0 above alpha1
+uvec2 encodeAlphaBlock()
+{
+    float low = 255.0;
+    float high = 0.0;
+    for (uint i = 0u; i < 16u; i++)
+    {
+        low = min(low, pixels[i].a);
+        high = max(high, pixels[i].a);
+    }
+    uint alpha0 = uint(floor(high + 0.5));
+    uint alpha1 = uint(floor(low + 0.5));
+    uvec2 block = uvec2(alpha0 | (alpha1 << 8u), 0u);
+    if (alpha0 == alpha1)
+        return block;
+    for (uint i = 0u; i < 16u; i++)
+    {
+        uint level = uint(clamp(floor((pixels[i].a - float(alpha1)) / float(alpha0 - alpha1) * 7.0 + 0.5), 0.0, 7.0));
+        uint index = level == 7u ? 0u : (level == 0u ? 1u : 8u - level);
+        uint bit = 16u + i * 3u;
+        if (bit >= 32u)
+            block.y |= index << (bit - 32u);
+        else
+        {
+            block.x |= index << bit;
+            if (bit > 29u)
+                block.y |= index >> (32u - bit);
+        }
+    }
+    return block;
+}
+
+void writeBits(inout uvec4 block, inout uint position, uint value, uint count)
+{
+    uint word = position >> 5u;
+    uint bit = position & 31u;
+    block[word] |= value << bit;
+    if (bit + count > 32u)
+        block[word + 1u] |= value >> (32u - bit);
+    position += count;
+}
+
+// BC7 mode 6: one subset, 7 bit rgba endpoints with a p-bit each and 4 bit indices
+uvec4 encodeBC7Mode6(uint quality)
+{
+    vec4 ends[2];
+    findEndpoints(quality, 4u, ends[0], ends[1]);
+    uvec4 quantized[2];
+    uint pbits[2];
+    for (uint e = 0u; e < 2u; e++)
+    {
+        float bestError = 1e30;
+        for (uint pbit = 0u; pbit < 2u; pbit++)
+        {
+            uvec4 q = uvec4(clamp(floor((ends[e] - float(pbit)) / 2.0 + 0.5), 0.0, 127.0));
+            vec4 d = vec4((q << 1u) | pbit) - ends[e];
+            if (dot(d, d) < bestError)
+            {
+                bestError = dot(d, d);
+                quantized[e] = q;
+                pbits[e] = pbit;
+            }
+        }
+    }
+    vec4 end0 = vec4((quantized[0] << 1u) | pbits[0]);
+    vec4 end1 = vec4((quantized[1] << 1u) | pbits[1]);
+    vec4 axis = end1 - end0;
+    float axisLength = max(dot(axis, axis), 1e-6);
+
+    uint indices[16];
+    for (uint i = 0u; i < 16u; i++)
+    {
+        float t = clamp(dot(pixels[i] - end0, axis) / axisLength, 0.0, 1.0) * 64.0;
+        uint best = 0u;
+        float bestError = 1e30;
+        for (uint j = 0u; j < 16u; j++)
+        {
+            float error;
+            if (quality == 0u)
+                error = (t - kBC7Weights[j]) * (t - kBC7Weights[j]);
+            else
+            {
+                vec4 d = pixels[i] - floor((end0 * (64.0 - kBC7Weights[j]) + end1 * kBC7Weights[j] + 32.0) / 64.0);
+                error = dot(d, d);
+            }
+            if (error < bestError)
+            {
+                best = j;
+                bestError = error;
+            }
+        }
+        indices[i] = best;
+    }
+
+    // The top bit of the first index is implied zero, swap the endpoints when it is set
+    uint first = 0u;
+    if (indices[0] >= 8u)
+    {
+        first = 1u;
+        for (uint i = 0u; i < 16u; i++)
+            indices[i] = 15u - indices[i];
+    }
+    uvec4 block = uvec4(0u);
+    uint position = 0u;
+    writeBits(block, position, 64u, 7u);
+    for (uint c = 0u; c < 4u; c++)
+    {
+        writeBits(block, position, quantized[first][c], 7u);
+        writeBits(block, position, quantized[1u - first][c], 7u);
+    }
+    writeBits(block, position, pbits[first], 1u);
+    writeBits(block, position, pbits[1u - first], 1u);
+    writeBits(block, position, indices[0], 3u);
+    for (uint i = 1u; i < 16u; i++)
+        writeBits(block, position, indices[i], 4u);
+    return block;
+}
+
+void main()
+{
+    uvec2 block = gl_GlobalInvocationID.xy;
+    if (block.x >= params.blocksWide || block.y >= params.blocksHigh)
+        return;
+    // Pixels past the edge repeat the last row and column
+    for (uint i = 0u; i < 16u; i++)
+    {
+        uint x = min(block.x * 4u + (i & 3u), params.width - 1u);
+        uint y = min(block.y * 4u + (i >> 2u), params.height - 1u);
+        pixels[i] = loadPixel(y * params.width + x);
+    }
+    uint index = block.y * params.blocksWide + block.x;
+    if (kFormat == 0u)
+    {
+        uvec2 color = encodeColorBlock(params.quality);
+        blocks.words[index * 2u] = color.x;
+        blocks.words[index * 2u + 1u] = color.y;
+    }
+    else
+    {
+        uvec4 words = kFormat == 1u ? uvec4(encodeAlphaBlock(), encodeColorBlock(params.quality)) : encodeBC7Mode6(params.quality);
+        blocks.words[index * 4u] = words.x;
+        blocks.words[index * 4u + 1u] = words.y;
+        blocks.words[index * 4u + 2u] = words.z;
+        blocks.words[index * 4u + 3u] = words.w;
+    }
+}
+*/
+// SPIR-V 1.0, to rebuild from the source:
+// %VULKAN_SDK%\bin\glslc -mfmt=num compress.comp -c
+
+const uint32_t compressShaderSpirv[] = {
+	0x07230203,0x00010000,0x00000000,0x000004de,
+	0x00000000,0x00020011,0x00000001,0x0006000b,
+	0x00000001,0x4c534c47,0x6474732e,0x3035342e,
+	0x00000000,0x0003000e,0x00000000,0x00000001,
+	0x0006000f,0x00000005,0x00000034,0x6e69616d,
+	0x00000000,0x00000028,0x00060010,0x00000034,
+	0x00000011,0x00000008,0x00000008,0x00000001,
+	0x00030003,0x00000002,0x000001c2,0x00040005,
+	0x00000003,0x726f466b,0x0074616d,0x00040005,
+	0x00000005,0x72756f53,0x00006563,0x00050006,
+	0x00000005,0x00000000,0x65786574,0x0000736c,
+	0x00040005,0x00000006,0x72756f73,0x00006563,
+	0x00040005,0x00000008,0x636f6c42,0x0000736b,
+	0x00050006,0x00000008,0x00000000,0x64726f77,
+	0x00000073,0x00040005,0x00000009,0x636f6c62,
+	0x0000736b,0x00040005,0x0000000b,0x61726150,
+	0x0000736d,0x00050006,0x0000000b,0x00000000,
+	0x74646977,0x00000068,0x00050006,0x0000000b,
+	0x00000001,0x67696568,0x00007468,0x00060006,
+	0x0000000b,0x00000002,0x636f6c62,0x6957736b,
+	0x00006564,0x00060006,0x0000000b,0x00000003,
+	0x636f6c62,0x6948736b,0x00006867,0x00050006,
+	0x0000000b,0x00000004,0x6c617571,0x00797469,
+	0x00070006,0x0000000b,0x00000005,0x72756f73,
+	0x6f466563,0x74616d72,0x00000000,0x00040005,
+	0x0000000c,0x61726170,0x0000736d,0x00050005,
+	0x00000022,0x3743426b,0x67696557,0x00737468,
+	0x00040005,0x00000024,0x65786970,0x0000736c,
+	0x00080005,0x00000028,0x475f6c67,0x61626f6c,
+	0x766e496c,0x7461636f,0x496e6f69,0x00000044,
+	0x00050005,0x0000002b,0x694c6f74,0x7261656e,
+	0x00000000,0x00050005,0x0000002c,0x64616f6c,
+	0x65786950,0x0000006c,0x00060005,0x0000002d,
+	0x646e6966,0x70646e45,0x746e696f,0x00000073,
+	0x00050005,0x0000002e,0x6b636170,0x35424752,
+	0x00003536,0x00060005,0x0000002f,0x61706e75,
+	0x47526b63,0x35363542,0x00000000,0x00070005,
+	0x00000030,0x6f636e65,0x6f436564,0x42726f6c,
+	0x6b636f6c,0x00000000,0x00070005,0x00000031,
+	0x6f636e65,0x6c416564,0x42616870,0x6b636f6c,
+	0x00000000,0x00050005,0x00000032,0x74697277,
+	0x74694265,0x00000073,0x00060005,0x00000033,
+	0x6f636e65,0x43426564,0x646f4d37,0x00003665,
+	0x00040005,0x00000034,0x6e69616d,0x00000000,
+	0x00040047,0x00000003,0x00000001,0x00000000,
+	0x00040047,0x00000004,0x00000006,0x00000004,
+	0x00030047,0x00000005,0x00000003,0x00050048,
+	0x00000005,0x00000000,0x00000023,0x00000000,
+	0x00040048,0x00000005,0x00000000,0x00000018,
+	0x00040047,0x00000006,0x00000022,0x00000000,
+	0x00040047,0x00000006,0x00000021,0x00000000,
+	0x00030047,0x00000008,0x00000003,0x00050048,
+	0x00000008,0x00000000,0x00000023,0x00000000,
+	0x00040047,0x00000009,0x00000022,0x00000000,
+	0x00040047,0x00000009,0x00000021,0x00000001,
+	0x00030047,0x0000000b,0x00000002,0x00050048,
+	0x0000000b,0x00000000,0x00000023,0x00000000,
+	0x00050048,0x0000000b,0x00000001,0x00000023,
+	0x00000004,0x00050048,0x0000000b,0x00000002,
+	0x00000023,0x00000008,0x00050048,0x0000000b,
+	0x00000003,0x00000023,0x0000000c,0x00050048,
+	0x0000000b,0x00000004,0x00000023,0x00000010,
+	0x00050048,0x0000000b,0x00000005,0x00000023,
+	0x00000014,0x00040047,0x00000028,0x0000000b,
+	0x0000001c,0x00040015,0x00000002,0x00000020,
+	0x00000000,0x00040032,0x00000002,0x00000003,
+	0x00000000,0x0003001d,0x00000004,0x00000002,
+	0x0003001e,0x00000005,0x00000004,0x00040020,
+	0x00000007,0x00000002,0x00000005,0x0004003b,
+	0x00000007,0x00000006,0x00000002,0x0003001e,
+	0x00000008,0x00000004,0x00040020,0x0000000a,
+	0x00000002,0x00000008,0x0004003b,0x0000000a,
+	0x00000009,0x00000002,0x0008001e,0x0000000b,
+	0x00000002,0x00000002,0x00000002,0x00000002,
+	0x00000002,0x00000002,0x00040020,0x0000000d,
+	0x00000009,0x0000000b,0x0004003b,0x0000000d,
+	0x0000000c,0x00000009,0x00030016,0x0000000e,
+	0x00000020,0x0004002b,0x0000000e,0x0000000f,
+	0x00000000,0x0004002b,0x0000000e,0x00000010,
+	0x40800000,0x0004002b,0x0000000e,0x00000011,
+	0x41100000,0x0004002b,0x0000000e,0x00000012,
+	0x41500000,0x0004002b,0x0000000e,0x00000013,
+	0x41880000,0x0004002b,0x0000000e,0x00000014,
+	0x41a80000,0x0004002b,0x0000000e,0x00000015,
+	0x41d00000,0x0004002b,0x0000000e,0x00000016,
+	0x41f00000,0x0004002b,0x0000000e,0x00000017,
+	0x42080000,0x0004002b,0x0000000e,0x00000018,
+	0x42180000,0x0004002b,0x0000000e,0x00000019,
+	0x422c0000,0x0004002b,0x0000000e,0x0000001a,
+	0x423c0000,0x0004002b,0x0000000e,0x0000001b,
+	0x424c0000,0x0004002b,0x0000000e,0x0000001c,
+	0x425c0000,0x0004002b,0x0000000e,0x0000001d,
+	0x42700000,0x0004002b,0x0000000e,0x0000001e,
+	0x42800000,0x0004002b,0x00000002,0x0000001f,
+	0x00000010,0x0004001c,0x00000020,0x0000000e,
+	0x0000001f,0x0013002c,0x00000020,0x00000021,
+	0x0000000f,0x00000010,0x00000011,0x00000012,
+	0x00000013,0x00000014,0x00000015,0x00000016,
+	0x00000017,0x00000018,0x00000019,0x0000001a,
+	0x0000001b,0x0000001c,0x0000001d,0x0000001e,
+	0x00040020,0x00000023,0x00000006,0x00000020,
+	0x0005003b,0x00000023,0x00000022,0x00000006,
+	0x00000021,0x00040017,0x00000025,0x0000000e,
+	0x00000004,0x0004001c,0x00000026,0x00000025,
+	0x0000001f,0x00040020,0x00000027,0x00000006,
+	0x00000026,0x0004003b,0x00000027,0x00000024,
+	0x00000006,0x00040017,0x00000029,0x00000002,
+	0x00000003,0x00040020,0x0000002a,0x00000001,
+	0x00000029,0x0004003b,0x0000002a,0x00000028,
+	0x00000001,0x00040020,0x00000035,0x00000007,
+	0x0000000e,0x00040021,0x00000036,0x0000000e,
+	0x00000035,0x0004002b,0x0000000e,0x0000003a,
+	0x3d25aee6,0x00020014,0x0000003c,0x0004002b,
+	0x0000000e,0x0000003e,0x414eb852,0x0004002b,
+	0x0000000e,0x00000042,0x3d6147ae,0x0004002b,
+	0x0000000e,0x00000044,0x3f870a3d,0x0004002b,
+	0x0000000e,0x00000046,0x4019999a,0x00040020,
+	0x00000049,0x00000007,0x00000002,0x00040021,
+	0x0000004a,0x00000025,0x00000049,0x00040015,
+	0x0000004e,0x00000020,0x00000001,0x0004002b,
+	0x0000004e,0x0000004f,0x00000005,0x00040020,
+	0x00000051,0x00000009,0x00000002,0x00040020,
+	0x00000054,0x00000007,0x00000025,0x0004002b,
+	0x00000002,0x00000056,0x00000003,0x0004002b,
+	0x00000002,0x00000058,0x00000002,0x0004002b,
+	0x0000004e,0x0000005d,0x00000000,0x00040020,
+	0x00000061,0x00000002,0x00000002,0x00040017,
+	0x00000064,0x0000000e,0x00000002,0x0004002b,
+	0x00000002,0x00000067,0x00000001,0x0004002b,
+	0x00000002,0x00000074,0x00000004,0x00040017,
+	0x00000088,0x00000002,0x00000004,0x0004002b,
+	0x00000002,0x00000090,0x00000008,0x0004002b,
+	0x00000002,0x00000095,0x00000018,0x0004002b,
+	0x00000002,0x00000098,0x000000ff,0x0007002c,
+	0x00000088,0x00000099,0x00000098,0x00000098,
+	0x00000098,0x00000098,0x0004002b,0x00000002,
+	0x000000a5,0x00000000,0x0004002b,0x0000000e,
+	0x000000ab,0x437f0000,0x0007002c,0x00000025,
+	0x000000ac,0x000000ab,0x000000ab,0x000000ab,
+	0x000000ab,0x0004002b,0x0000004e,0x000000b3,
+	0x00000001,0x0004002b,0x0000004e,0x000000b8,
+	0x00000002,0x00040017,0x000000bd,0x0000000e,
+	0x00000003,0x0004002b,0x0000000e,0x000000c1,
+	0x3f800000,0x0007002c,0x00000025,0x000000c2,
+	0x0000000f,0x0000000f,0x0000000f,0x0000000f,
+	0x0007002c,0x00000025,0x000000c3,0x000000c1,
+	0x000000c1,0x000000c1,0x000000c1,0x00020013,
+	0x000000c6,0x00070021,0x000000c7,0x000000c6,
+	0x00000049,0x00000049,0x00000054,0x00000054,
+	0x00040020,0x000000ce,0x00000006,0x00000025,
+	0x0004002b,0x0000000e,0x000000ed,0x41800000,
+	0x0007002c,0x00000025,0x000000ee,0x000000ed,
+	0x000000ed,0x000000ed,0x000000ed,0x0007002c,
+	0x00000025,0x000000f7,0x000000c1,0x000000c1,
+	0x000000c1,0x0000000f,0x00040017,0x000000f9,
+	0x0000003c,0x00000004,0x0004001c,0x000000fc,
+	0x00000025,0x00000074,0x00040020,0x000000fd,
+	0x00000007,0x000000fc,0x0007002c,0x000000fc,
+	0x000000fe,0x000000c2,0x000000c2,0x000000c2,
+	0x000000c2,0x0004002b,0x0000004e,0x00000127,
+	0x00000003,0x0004002b,0x0000000e,0x00000158,
+	0x358637bd,0x00040020,0x000001b8,0x00000007,
+	0x000000bd,0x00040021,0x000001b9,0x00000002,
+	0x000001b8,0x00040020,0x000001bd,0x00000007,
+	0x00000029,0x0006002c,0x000000bd,0x000001bf,
+	0x0000000f,0x0000000f,0x0000000f,0x0006002c,
+	0x000000bd,0x000001c0,0x000000ab,0x000000ab,
+	0x000000ab,0x0004002b,0x0000000e,0x000001c2,
+	0x41f80000,0x0004002b,0x0000000e,0x000001c3,
+	0x427c0000,0x0006002c,0x000000bd,0x000001c4,
+	0x000001c2,0x000001c3,0x000001c2,0x0004002b,
+	0x0000000e,0x000001c7,0x3f000000,0x0006002c,
+	0x000000bd,0x000001c8,0x000001c7,0x000001c7,
+	0x000001c7,0x0004002b,0x00000002,0x000001ce,
+	0x0000000b,0x0004002b,0x00000002,0x000001d2,
+	0x00000005,0x00040021,0x000001d8,0x000000bd,
+	0x00000049,0x0004002b,0x00000002,0x000001e1,
+	0x0000001f,0x0004002b,0x00000002,0x000001e2,
+	0x0000003f,0x0006002c,0x00000029,0x000001e3,
+	0x000001e1,0x000001e2,0x000001e1,0x00040017,
+	0x000001e8,0x00000002,0x00000002,0x00040021,
+	0x000001e9,0x000001e8,0x00000049,0x0004001c,
+	0x0000021c,0x000000bd,0x00000074,0x00040020,
+	0x0000021d,0x00000007,0x0000021c,0x0004002b,
+	0x0000000e,0x00000220,0x40000000,0x0004002b,
+	0x0000000e,0x00000225,0x40400000,0x0006002c,
+	0x000000bd,0x00000226,0x00000225,0x00000225,
+	0x00000225,0x0004002b,0x0000000e,0x00000239,
+	0x7149f2ca,0x00030021,0x00000266,0x000001e8,
+	0x00040020,0x00000275,0x00000006,0x0000000e,
+	0x00040020,0x0000028a,0x00000007,0x000001e8,
+	0x0004002b,0x0000000e,0x000002aa,0x40e00000,
+	0x0004002b,0x00000002,0x000002b2,0x00000007,
+	0x0004002b,0x00000002,0x000002bf,0x00000020,
+	0x0004002b,0x00000002,0x000002d4,0x0000001d,
+	0x00040020,0x000002e3,0x00000007,0x00000088,
+	0x00070021,0x000002e4,0x000000c6,0x000002e3,
+	0x00000049,0x00000049,0x00000049,0x00040021,
+	0x0000030b,0x00000088,0x00000049,0x0004001c,
+	0x0000030f,0x00000025,0x00000058,0x00040020,
+	0x00000310,0x00000007,0x0000030f,0x0004001c,
+	0x0000031c,0x00000088,0x00000058,0x00040020,
+	0x0000031d,0x00000007,0x0000031c,0x0004001c,
+	0x0000031f,0x00000002,0x00000058,0x00040020,
+	0x00000320,0x00000007,0x0000031f,0x0007002c,
+	0x00000025,0x0000033a,0x00000220,0x00000220,
+	0x00000220,0x00000220,0x0007002c,0x00000025,
+	0x0000033c,0x000001c7,0x000001c7,0x000001c7,
+	0x000001c7,0x0004002b,0x0000000e,0x0000033f,
+	0x42fe0000,0x0007002c,0x00000025,0x00000340,
+	0x0000033f,0x0000033f,0x0000033f,0x0000033f,
+	0x0007002c,0x00000088,0x00000345,0x00000067,
+	0x00000067,0x00000067,0x00000067,0x0004001c,
+	0x0000037f,0x00000002,0x0000001f,0x00040020,
+	0x00000380,0x00000007,0x0000037f,0x0004002b,
+	0x0000000e,0x000003c0,0x42000000,0x0007002c,
+	0x00000025,0x000003c1,0x000003c0,0x000003c0,
+	0x000003c0,0x000003c0,0x0007002c,0x00000025,
+	0x000003c3,0x0000001e,0x0000001e,0x0000001e,
+	0x0000001e,0x0004002b,0x00000002,0x000003e7,
+	0x0000000f,0x0007002c,0x00000088,0x000003f0,
+	0x000000a5,0x000000a5,0x000000a5,0x000000a5,
+	0x0004002b,0x00000002,0x000003f7,0x00000040,
+	0x00030021,0x0000045c,0x000000c6,0x0004002b,
+	0x0000004e,0x000004a7,0x00000004,0x00050036,
+	0x0000000e,0x0000002b,0x00000000,0x00000036,
+	0x00030037,0x00000035,0x00000037,0x000200f8,
+	0x00000038,0x0004003d,0x0000000e,0x00000039,
+	0x00000037,0x000500bc,0x0000003c,0x0000003b,
+	0x00000039,0x0000003a,0x0004003d,0x0000000e,
+	0x0000003d,0x00000037,0x00050088,0x0000000e,
+	0x0000003f,0x0000003d,0x0000003e,0x0004003d,
+	0x0000000e,0x00000040,0x00000037,0x0007000c,
+	0x0000000e,0x00000041,0x00000001,0x00000028,
+	0x00000040,0x0000000f,0x00050081,0x0000000e,
+	0x00000043,0x00000041,0x00000042,0x00050088,
+	0x0000000e,0x00000045,0x00000043,0x00000044,
+	0x0007000c,0x0000000e,0x00000047,0x00000001,
+	0x0000001a,0x00000045,0x00000046,0x000600a9,
+	0x0000000e,0x00000048,0x0000003b,0x0000003f,
+	0x00000047,0x000200fe,0x00000048,0x00010038,
+	0x00050036,0x00000025,0x0000002c,0x00000000,
+	0x0000004a,0x00030037,0x00000049,0x0000004b,
+	0x000200f8,0x0000004c,0x0004003b,0x00000049,
+	0x0000004d,0x00000007,0x0004003b,0x00000054,
+	0x00000053,0x00000007,0x0004003b,0x00000049,
+	0x0000008a,0x00000007,0x0004003b,0x00000035,
+	0x000000ae,0x00000007,0x0004003b,0x00000035,
+	0x000000b2,0x00000007,0x0004003b,0x00000035,
+	0x000000b7,0x00000007,0x00050041,0x00000051,
+	0x00000050,0x0000000c,0x0000004f,0x0004003d,
+	0x00000002,0x00000052,0x00000050,0x0003003e,
+	0x0000004d,0x00000052,0x0004003d,0x00000002,
+	0x00000055,0x0000004d,0x000500c7,0x00000002,
+	0x00000057,0x00000055,0x00000056,0x000500aa,
+	0x0000003c,0x00000059,0x00000057,0x00000058,
+	0x000300f7,0x0000005a,0x00000000,0x000400fa,
+	0x00000059,0x0000005b,0x0000005c,0x000200f8,
+	0x0000005b,0x0004003d,0x00000002,0x0000005e,
+	0x0000004b,0x00050084,0x00000002,0x0000005f,
+	0x0000005e,0x00000058,0x00060041,0x00000061,
+	0x00000060,0x00000006,0x0000005d,0x0000005f,
+	0x0004003d,0x00000002,0x00000062,0x00000060,
+	0x0006000c,0x00000064,0x00000063,0x00000001,
+	0x0000003e,0x00000062,0x0004003d,0x00000002,
+	0x00000065,0x0000004b,0x00050084,0x00000002,
+	0x00000066,0x00000065,0x00000058,0x00050080,
+	0x00000002,0x00000068,0x00000066,0x00000067,
+	0x00060041,0x00000061,0x00000069,0x00000006,
+	0x0000005d,0x00000068,0x0004003d,0x00000002,
+	0x0000006a,0x00000069,0x0006000c,0x00000064,
+	0x0000006b,0x00000001,0x0000003e,0x0000006a,
+	0x00050050,0x00000025,0x0000006c,0x00000063,
+	0x0000006b,0x0003003e,0x00000053,0x0000006c,
+	0x000200f9,0x0000005a,0x000200f8,0x0000005c,
+	0x0004003d,0x00000002,0x0000006d,0x0000004d,
+	0x000500c7,0x00000002,0x0000006e,0x0000006d,
+	0x00000056,0x000500aa,0x0000003c,0x0000006f,
+	0x0000006e,0x00000056,0x000300f7,0x00000070,
+	0x00000000,0x000400fa,0x0000006f,0x00000071,
+	0x00000072,0x000200f8,0x00000071,0x0004003d,
+	0x00000002,0x00000073,0x0000004b,0x00050084,
+	0x00000002,0x00000075,0x00000073,0x00000074,
+	0x00060041,0x00000061,0x00000076,0x00000006,
+	0x0000005d,0x00000075,0x0004003d,0x00000002,
+	0x00000077,0x00000076,0x0004003d,0x00000002,
+	0x00000078,0x0000004b,0x00050084,0x00000002,
+	0x00000079,0x00000078,0x00000074,0x00050080,
+	0x00000002,0x0000007a,0x00000079,0x00000067,
+	0x00060041,0x00000061,0x0000007b,0x00000006,
+	0x0000005d,0x0000007a,0x0004003d,0x00000002,
+	0x0000007c,0x0000007b,0x0004003d,0x00000002,
+	0x0000007d,0x0000004b,0x00050084,0x00000002,
+	0x0000007e,0x0000007d,0x00000074,0x00050080,
+	0x00000002,0x0000007f,0x0000007e,0x00000058,
+	0x00060041,0x00000061,0x00000080,0x00000006,
+	0x0000005d,0x0000007f,0x0004003d,0x00000002,
+	0x00000081,0x00000080,0x0004003d,0x00000002,
+	0x00000082,0x0000004b,0x00050084,0x00000002,
+	0x00000083,0x00000082,0x00000074,0x00050080,
+	0x00000002,0x00000084,0x00000083,0x00000056,
+	0x00060041,0x00000061,0x00000085,0x00000006,
+	0x0000005d,0x00000084,0x0004003d,0x00000002,
+	0x00000086,0x00000085,0x00070050,0x00000088,
+	0x00000087,0x00000077,0x0000007c,0x00000081,
+	0x00000086,0x0004007c,0x00000025,0x00000089,
+	0x00000087,0x0003003e,0x00000053,0x00000089,
+	0x000200f9,0x00000070,0x000200f8,0x00000072,
+	0x0004003d,0x00000002,0x0000008b,0x0000004b,
+	0x00060041,0x00000061,0x0000008c,0x00000006,
+	0x0000005d,0x0000008b,0x0004003d,0x00000002,
+	0x0000008d,0x0000008c,0x0003003e,0x0000008a,
+	0x0000008d,0x0004003d,0x00000002,0x0000008e,
+	0x0000008a,0x0004003d,0x00000002,0x0000008f,
+	0x0000008a,0x000500c2,0x00000002,0x00000091,
+	0x0000008f,0x00000090,0x0004003d,0x00000002,
+	0x00000092,0x0000008a,0x000500c2,0x00000002,
+	0x00000093,0x00000092,0x0000001f,0x0004003d,
+	0x00000002,0x00000094,0x0000008a,0x000500c2,
+	0x00000002,0x00000096,0x00000094,0x00000095,
+	0x00070050,0x00000088,0x00000097,0x0000008e,
+	0x00000091,0x00000093,0x00000096,0x000500c7,
+	0x00000088,0x0000009a,0x00000097,0x00000099,
+	0x00040070,0x00000025,0x0000009b,0x0000009a,
+	0x0003003e,0x00000053,0x0000009b,0x0004003d,
+	0x00000002,0x0000009c,0x0000004d,0x000500c7,
+	0x00000002,0x0000009d,0x0000009c,0x00000056,
+	0x000500aa,0x0000003c,0x0000009e,0x0000009d,
+	0x00000067,0x000300f7,0x0000009f,0x00000000,
+	0x000400fa,0x0000009e,0x000000a0,0x0000009f,
+	0x000200f8,0x000000a0,0x0004003d,0x00000025,
+	0x000000a1,0x00000053,0x0009004f,0x00000025,
+	0x000000a2,0x000000a1,0x000000a1,0x00000002,
+	0x00000001,0x00000000,0x00000003,0x0003003e,
+	0x00000053,0x000000a2,0x000200f9,0x0000009f,
+	0x000200f8,0x0000009f,0x0004003d,0x00000002,
+	0x000000a3,0x0000004d,0x000500c7,0x00000002,
+	0x000000a4,0x000000a3,0x00000074,0x000500aa,
+	0x0000003c,0x000000a6,0x000000a4,0x000000a5,
+	0x000300f7,0x000000a7,0x00000000,0x000400fa,
+	0x000000a6,0x000000a8,0x000000a7,0x000200f8,
+	0x000000a8,0x0004003d,0x00000025,0x000000a9,
+	0x00000053,0x000200fe,0x000000a9,0x000200f8,
+	0x000000a7,0x0004003d,0x00000025,0x000000aa,
+	0x00000053,0x00050088,0x00000025,0x000000ad,
+	0x000000aa,0x000000ac,0x0003003e,0x00000053,
+	0x000000ad,0x00050041,0x00000035,0x000000af,
+	0x00000053,0x0000005d,0x0004003d,0x0000000e,
+	0x000000b0,0x000000af,0x0003003e,0x000000ae,
+	0x000000b0,0x00050039,0x0000000e,0x000000b1,
+	0x0000002b,0x000000ae,0x00050041,0x00000035,
+	0x000000b4,0x00000053,0x000000b3,0x0004003d,
+	0x0000000e,0x000000b5,0x000000b4,0x0003003e,
+	0x000000b2,0x000000b5,0x00050039,0x0000000e,
+	0x000000b6,0x0000002b,0x000000b2,0x00050041,
+	0x00000035,0x000000b9,0x00000053,0x000000b8,
+	0x0004003d,0x0000000e,0x000000ba,0x000000b9,
+	0x0003003e,0x000000b7,0x000000ba,0x00050039,
+	0x0000000e,0x000000bb,0x0000002b,0x000000b7,
+	0x00060050,0x000000bd,0x000000bc,0x000000b1,
+	0x000000b6,0x000000bb,0x0004003d,0x00000025,
+	0x000000be,0x00000053,0x0009004f,0x00000025,
+	0x000000bf,0x000000be,0x000000bc,0x00000004,
+	0x00000005,0x00000006,0x00000003,0x0003003e,
+	0x00000053,0x000000bf,0x000200f9,0x00000070,
+	0x000200f8,0x00000070,0x000200f9,0x0000005a,
+	0x000200f8,0x0000005a,0x0004003d,0x00000025,
+	0x000000c0,0x00000053,0x0008000c,0x00000025,
+	0x000000c4,0x00000001,0x0000002b,0x000000c0,
+	0x000000c2,0x000000c3,0x0005008e,0x00000025,
+	0x000000c5,0x000000c4,0x000000ab,0x000200fe,
+	0x000000c5,0x00010038,0x00050036,0x000000c6,
+	0x0000002d,0x00000000,0x000000c7,0x00030037,
+	0x00000049,0x000000c8,0x00030037,0x00000049,
+	0x000000c9,0x00030037,0x00000054,0x000000ca,
+	0x00030037,0x00000054,0x000000cb,0x000200f8,
+	0x000000cc,0x0004003b,0x00000054,0x000000d2,
+	0x00000007,0x0004003b,0x00000049,0x000000d3,
+	0x00000007,0x0004003b,0x00000054,0x000000f4,
+	0x00000007,0x0004003b,0x000000fd,0x000000fb,
+	0x00000007,0x0004003b,0x00000049,0x000000ff,
+	0x00000007,0x0004003b,0x00000054,0x00000107,
+	0x00000007,0x0004003b,0x00000054,0x00000132,
+	0x00000007,0x0004003b,0x00000049,0x00000138,
+	0x00000007,0x0004003b,0x00000035,0x0000016d,
+	0x00000007,0x0004003b,0x00000035,0x0000017a,
+	0x00000007,0x0004003b,0x00000035,0x0000017b,
+	0x00000007,0x0004003b,0x00000049,0x0000017c,
+	0x00000007,0x0004003b,0x00000035,0x00000184,
+	0x00000007,0x0004003b,0x00000054,0x00000196,
+	0x00000007,0x0004003b,0x00000054,0x0000019d,
+	0x00000007,0x00050041,0x000000ce,0x000000cd,
+	0x00000024,0x0000005d,0x0004003d,0x00000025,
+	0x000000cf,0x000000cd,0x0003003e,0x000000ca,
+	0x000000cf,0x00050041,0x000000ce,0x000000d0,
+	0x00000024,0x0000005d,0x0004003d,0x00000025,
+	0x000000d1,0x000000d0,0x0003003e,0x000000cb,
+	0x000000d1,0x0003003e,0x000000d2,0x000000c2,
+	0x0003003e,0x000000d3,0x000000a5,0x000200f9,
+	0x000000d4,0x000200f8,0x000000d4,0x000400f6,
+	0x000000d8,0x000000d7,0x00000000,0x000200f9,
+	0x000000d5,0x000200f8,0x000000d5,0x0004003d,
+	0x00000002,0x000000d9,0x000000d3,0x000500b0,
+	0x0000003c,0x000000da,0x000000d9,0x0000001f,
+	0x000400fa,0x000000da,0x000000d6,0x000000d8,
+	0x000200f8,0x000000d6,0x0004003d,0x00000025,
+	0x000000db,0x000000ca,0x0004003d,0x00000002,
+	0x000000dc,0x000000d3,0x00050041,0x000000ce,
+	0x000000dd,0x00000024,0x000000dc,0x0004003d,
+	0x00000025,0x000000de,0x000000dd,0x0007000c,
+	0x00000025,0x000000df,0x00000001,0x00000025,
+	0x000000db,0x000000de,0x0003003e,0x000000ca,
+	0x000000df,0x0004003d,0x00000025,0x000000e0,
+	0x000000cb,0x0004003d,0x00000002,0x000000e1,
+	0x000000d3,0x00050041,0x000000ce,0x000000e2,
+	0x00000024,0x000000e1,0x0004003d,0x00000025,
+	0x000000e3,0x000000e2,0x0007000c,0x00000025,
+	0x000000e4,0x00000001,0x00000028,0x000000e0,
+	0x000000e3,0x0003003e,0x000000cb,0x000000e4,
+	0x0004003d,0x00000025,0x000000e5,0x000000d2,
+	0x0004003d,0x00000002,0x000000e6,0x000000d3,
+	0x00050041,0x000000ce,0x000000e7,0x00000024,
+	0x000000e6,0x0004003d,0x00000025,0x000000e8,
+	0x000000e7,0x00050081,0x00000025,0x000000e9,
+	0x000000e5,0x000000e8,0x0003003e,0x000000d2,
+	0x000000e9,0x000200f9,0x000000d7,0x000200f8,
+	0x000000d7,0x0004003d,0x00000002,0x000000ea,
+	0x000000d3,0x00050080,0x00000002,0x000000eb,
+	0x000000ea,0x00000067,0x0003003e,0x000000d3,
+	0x000000eb,0x000200f9,0x000000d4,0x000200f8,
+	0x000000d8,0x0004003d,0x00000025,0x000000ec,
+	0x000000d2,0x00050088,0x00000025,0x000000ef,
+	0x000000ec,0x000000ee,0x0003003e,0x000000d2,
+	0x000000ef,0x0004003d,0x00000002,0x000000f0,
+	0x000000c8,0x000500aa,0x0000003c,0x000000f1,
+	0x000000f0,0x000000a5,0x000300f7,0x000000f2,
+	0x00000000,0x000400fa,0x000000f1,0x000000f3,
+	0x000000f2,0x000200f8,0x000000f3,0x000100fd,
+	0x000200f8,0x000000f2,0x0004003d,0x00000002,
+	0x000000f5,0x000000c9,0x000500aa,0x0000003c,
+	0x000000f6,0x000000f5,0x00000056,0x00070050,
+	0x000000f9,0x000000f8,0x000000f6,0x000000f6,
+	0x000000f6,0x000000f6,0x000600a9,0x00000025,
+	0x000000fa,0x000000f8,0x000000f7,0x000000c3,
+	0x0003003e,0x000000f4,0x000000fa,0x0003003e,
+	0x000000fb,0x000000fe,0x0003003e,0x000000ff,
+	0x000000a5,0x000200f9,0x00000100,0x000200f8,
+	0x00000100,0x000400f6,0x00000104,0x00000103,
+	0x00000000,0x000200f9,0x00000101,0x000200f8,
+	0x00000101,0x0004003d,0x00000002,0x00000105,
+	0x000000ff,0x000500b0,0x0000003c,0x00000106,
+	0x00000105,0x0000001f,0x000400fa,0x00000106,
+	0x00000102,0x00000104,0x000200f8,0x00000102,
+	0x0004003d,0x00000002,0x00000108,0x000000ff,
+	0x00050041,0x000000ce,0x00000109,0x00000024,
+	0x00000108,0x0004003d,0x00000025,0x0000010a,
+	0x00000109,0x0004003d,0x00000025,0x0000010b,
+	0x000000d2,0x00050083,0x00000025,0x0000010c,
+	0x0000010a,0x0000010b,0x0004003d,0x00000025,
+	0x0000010d,0x000000f4,0x00050085,0x00000025,
+	0x0000010e,0x0000010c,0x0000010d,0x0003003e,
+	0x00000107,0x0000010e,0x00050041,0x00000054,
+	0x0000010f,0x000000fb,0x0000005d,0x0004003d,
+	0x00000025,0x00000110,0x0000010f,0x0004003d,
+	0x00000025,0x00000111,0x00000107,0x00050041,
+	0x00000035,0x00000112,0x00000107,0x0000005d,
+	0x0004003d,0x0000000e,0x00000113,0x00000112,
+	0x0005008e,0x00000025,0x00000114,0x00000111,
+	0x00000113,0x00050081,0x00000025,0x00000115,
+	0x00000110,0x00000114,0x00050041,0x00000054,
+	0x00000116,0x000000fb,0x0000005d,0x0003003e,
+	0x00000116,0x00000115,0x00050041,0x00000054,
+	0x00000117,0x000000fb,0x000000b3,0x0004003d,
+	0x00000025,0x00000118,0x00000117,0x0004003d,
+	0x00000025,0x00000119,0x00000107,0x00050041,
+	0x00000035,0x0000011a,0x00000107,0x000000b3,
+	0x0004003d,0x0000000e,0x0000011b,0x0000011a,
+	0x0005008e,0x00000025,0x0000011c,0x00000119,
+	0x0000011b,0x00050081,0x00000025,0x0000011d,
+	0x00000118,0x0000011c,0x00050041,0x00000054,
+	0x0000011e,0x000000fb,0x000000b3,0x0003003e,
+	0x0000011e,0x0000011d,0x00050041,0x00000054,
+	0x0000011f,0x000000fb,0x000000b8,0x0004003d,
+	0x00000025,0x00000120,0x0000011f,0x0004003d,
+	0x00000025,0x00000121,0x00000107,0x00050041,
+	0x00000035,0x00000122,0x00000107,0x000000b8,
+	0x0004003d,0x0000000e,0x00000123,0x00000122,
+	0x0005008e,0x00000025,0x00000124,0x00000121,
+	0x00000123,0x00050081,0x00000025,0x00000125,
+	0x00000120,0x00000124,0x00050041,0x00000054,
+	0x00000126,0x000000fb,0x000000b8,0x0003003e,
+	0x00000126,0x00000125,0x00050041,0x00000054,
+	0x00000128,0x000000fb,0x00000127,0x0004003d,
+	0x00000025,0x00000129,0x00000128,0x0004003d,
+	0x00000025,0x0000012a,0x00000107,0x00050041,
+	0x00000035,0x0000012b,0x00000107,0x00000127,
+	0x0004003d,0x0000000e,0x0000012c,0x0000012b,
+	0x0005008e,0x00000025,0x0000012d,0x0000012a,
+	0x0000012c,0x00050081,0x00000025,0x0000012e,
+	0x00000129,0x0000012d,0x00050041,0x00000054,
+	0x0000012f,0x000000fb,0x00000127,0x0003003e,
+	0x0000012f,0x0000012e,0x000200f9,0x00000103,
+	0x000200f8,0x00000103,0x0004003d,0x00000002,
+	0x00000130,0x000000ff,0x00050080,0x00000002,
+	0x00000131,0x00000130,0x00000067,0x0003003e,
+	0x000000ff,0x00000131,0x000200f9,0x00000100,
+	0x000200f8,0x00000104,0x0004003d,0x00000025,
+	0x00000133,0x000000cb,0x0004003d,0x00000025,
+	0x00000134,0x000000ca,0x00050083,0x00000025,
+	0x00000135,0x00000133,0x00000134,0x0004003d,
+	0x00000025,0x00000136,0x000000f4,0x00050085,
+	0x00000025,0x00000137,0x00000135,0x00000136,
+	0x0003003e,0x00000132,0x00000137,0x0003003e,
+	0x00000138,0x000000a5,0x000200f9,0x00000139,
+	0x000200f8,0x00000139,0x000400f6,0x0000013d,
+	0x0000013c,0x00000000,0x000200f9,0x0000013a,
+	0x000200f8,0x0000013a,0x0004003d,0x00000002,
+	0x0000013e,0x00000138,0x000500b0,0x0000003c,
+	0x0000013f,0x0000013e,0x00000090,0x000400fa,
+	0x0000013f,0x0000013b,0x0000013d,0x000200f8,
+	0x0000013b,0x00050041,0x00000054,0x00000140,
+	0x000000fb,0x0000005d,0x0004003d,0x00000025,
+	0x00000141,0x00000140,0x00050041,0x00000035,
+	0x00000142,0x00000132,0x0000005d,0x0004003d,
+	0x0000000e,0x00000143,0x00000142,0x0005008e,
+	0x00000025,0x00000144,0x00000141,0x00000143,
+	0x00050041,0x00000054,0x00000145,0x000000fb,
+	0x000000b3,0x0004003d,0x00000025,0x00000146,
+	0x00000145,0x00050041,0x00000035,0x00000147,
+	0x00000132,0x000000b3,0x0004003d,0x0000000e,
+	0x00000148,0x00000147,0x0005008e,0x00000025,
+	0x00000149,0x00000146,0x00000148,0x00050081,
+	0x00000025,0x0000014a,0x00000144,0x00000149,
+	0x00050041,0x00000054,0x0000014b,0x000000fb,
+	0x000000b8,0x0004003d,0x00000025,0x0000014c,
+	0x0000014b,0x00050041,0x00000035,0x0000014d,
+	0x00000132,0x000000b8,0x0004003d,0x0000000e,
+	0x0000014e,0x0000014d,0x0005008e,0x00000025,
+	0x0000014f,0x0000014c,0x0000014e,0x00050081,
+	0x00000025,0x00000150,0x0000014a,0x0000014f,
+	0x00050041,0x00000054,0x00000151,0x000000fb,
+	0x00000127,0x0004003d,0x00000025,0x00000152,
+	0x00000151,0x00050041,0x00000035,0x00000153,
+	0x00000132,0x00000127,0x0004003d,0x0000000e,
+	0x00000154,0x00000153,0x0005008e,0x00000025,
+	0x00000155,0x00000152,0x00000154,0x00050081,
+	0x00000025,0x00000156,0x00000150,0x00000155,
+	0x0003003e,0x00000132,0x00000156,0x0004003d,
+	0x00000025,0x00000157,0x00000132,0x00050041,
+	0x00000035,0x00000159,0x00000132,0x0000005d,
+	0x0004003d,0x0000000e,0x0000015a,0x00000159,
+	0x0006000c,0x0000000e,0x0000015b,0x00000001,
+	0x00000004,0x0000015a,0x0007000c,0x0000000e,
+	0x0000015c,0x00000001,0x00000028,0x00000158,
+	0x0000015b,0x00050041,0x00000035,0x0000015d,
+	0x00000132,0x000000b3,0x0004003d,0x0000000e,
+	0x0000015e,0x0000015d,0x0006000c,0x0000000e,
+	0x0000015f,0x00000001,0x00000004,0x0000015e,
+	0x0007000c,0x0000000e,0x00000160,0x00000001,
+	0x00000028,0x0000015c,0x0000015f,0x00050041,
+	0x00000035,0x00000161,0x00000132,0x000000b8,
+	0x0004003d,0x0000000e,0x00000162,0x00000161,
+	0x0006000c,0x0000000e,0x00000163,0x00000001,
+	0x00000004,0x00000162,0x0007000c,0x0000000e,
+	0x00000164,0x00000001,0x00000028,0x00000160,
+	0x00000163,0x00050041,0x00000035,0x00000165,
+	0x00000132,0x00000127,0x0004003d,0x0000000e,
+	0x00000166,0x00000165,0x0006000c,0x0000000e,
+	0x00000167,0x00000001,0x00000004,0x00000166,
+	0x0007000c,0x0000000e,0x00000168,0x00000001,
+	0x00000028,0x00000164,0x00000167,0x00070050,
+	0x00000025,0x00000169,0x00000168,0x00000168,
+	0x00000168,0x00000168,0x00050088,0x00000025,
+	0x0000016a,0x00000157,0x00000169,0x0003003e,
+	0x00000132,0x0000016a,0x000200f9,0x0000013c,
+	0x000200f8,0x0000013c,0x0004003d,0x00000002,
+	0x0000016b,0x00000138,0x00050080,0x00000002,
+	0x0000016c,0x0000016b,0x00000067,0x0003003e,
+	0x00000138,0x0000016c,0x000200f9,0x00000139,
+	0x000200f8,0x0000013d,0x0004003d,0x00000025,
+	0x0000016e,0x00000132,0x0004003d,0x00000025,
+	0x0000016f,0x00000132,0x00050094,0x0000000e,
+	0x00000170,0x0000016e,0x0000016f,0x0003003e,
+	0x0000016d,0x00000170,0x0004003d,0x0000000e,
+	0x00000171,0x0000016d,0x000500b8,0x0000003c,
+	0x00000172,0x00000171,0x00000158,0x000300f7,
+	0x00000173,0x00000000,0x000400fa,0x00000172,
+	0x00000174,0x00000173,0x000200f8,0x00000174,
+	0x000100fd,0x000200f8,0x00000173,0x0004003d,
+	0x00000025,0x00000175,0x00000132,0x0004003d,
+	0x0000000e,0x00000176,0x0000016d,0x0006000c,
+	0x0000000e,0x00000177,0x00000001,0x0000001f,
+	0x00000176,0x00070050,0x00000025,0x00000178,
+	0x00000177,0x00000177,0x00000177,0x00000177,
+	0x00050088,0x00000025,0x00000179,0x00000175,
+	0x00000178,0x0003003e,0x00000132,0x00000179,
+	0x0003003e,0x0000017a,0x0000000f,0x0003003e,
+	0x0000017b,0x0000000f,0x0003003e,0x0000017c,
+	0x000000a5,0x000200f9,0x0000017d,0x000200f8,
+	0x0000017d,0x000400f6,0x00000181,0x00000180,
+	0x00000000,0x000200f9,0x0000017e,0x000200f8,
+	0x0000017e,0x0004003d,0x00000002,0x00000182,
+	0x0000017c,0x000500b0,0x0000003c,0x00000183,
+	0x00000182,0x0000001f,0x000400fa,0x00000183,
+	0x0000017f,0x00000181,0x000200f8,0x0000017f,
+	0x0004003d,0x00000002,0x00000185,0x0000017c,
+	0x00050041,0x000000ce,0x00000186,0x00000024,
+	0x00000185,0x0004003d,0x00000025,0x00000187,
+	0x00000186,0x0004003d,0x00000025,0x00000188,
+	0x000000d2,0x00050083,0x00000025,0x00000189,
+	0x00000187,0x00000188,0x0004003d,0x00000025,
+	0x0000018a,0x000000f4,0x00050085,0x00000025,
+	0x0000018b,0x00000189,0x0000018a,0x0004003d,
+	0x00000025,0x0000018c,0x00000132,0x00050094,
+	0x0000000e,0x0000018d,0x0000018b,0x0000018c,
+	0x0003003e,0x00000184,0x0000018d,0x0004003d,
+	0x0000000e,0x0000018e,0x0000017a,0x0004003d,
+	0x0000000e,0x0000018f,0x00000184,0x0007000c,
+	0x0000000e,0x00000190,0x00000001,0x00000025,
+	0x0000018e,0x0000018f,0x0003003e,0x0000017a,
+	0x00000190,0x0004003d,0x0000000e,0x00000191,
+	0x0000017b,0x0004003d,0x0000000e,0x00000192,
+	0x00000184,0x0007000c,0x0000000e,0x00000193,
+	0x00000001,0x00000028,0x00000191,0x00000192,
+	0x0003003e,0x0000017b,0x00000193,0x000200f9,
+	0x00000180,0x000200f8,0x00000180,0x0004003d,
+	0x00000002,0x00000194,0x0000017c,0x00050080,
+	0x00000002,0x00000195,0x00000194,0x00000067,
+	0x0003003e,0x0000017c,0x00000195,0x000200f9,
+	0x0000017d,0x000200f8,0x00000181,0x0004003d,
+	0x00000025,0x00000197,0x000000d2,0x0004003d,
+	0x00000025,0x00000198,0x00000132,0x0004003d,
+	0x0000000e,0x00000199,0x0000017a,0x0005008e,
+	0x00000025,0x0000019a,0x00000198,0x00000199,
+	0x00050081,0x00000025,0x0000019b,0x00000197,
+	0x0000019a,0x0008000c,0x00000025,0x0000019c,
+	0x00000001,0x0000002b,0x0000019b,0x000000c2,
+	0x000000ac,0x0003003e,0x00000196,0x0000019c,
+	0x0004003d,0x00000025,0x0000019e,0x000000d2,
+	0x0004003d,0x00000025,0x0000019f,0x00000132,
+	0x0004003d,0x0000000e,0x000001a0,0x0000017b,
+	0x0005008e,0x00000025,0x000001a1,0x0000019f,
+	0x000001a0,0x00050081,0x00000025,0x000001a2,
+	0x0000019e,0x000001a1,0x0008000c,0x00000025,
+	0x000001a3,0x00000001,0x0000002b,0x000001a2,
+	0x000000c2,0x000000ac,0x0003003e,0x0000019d,
+	0x000001a3,0x0004003d,0x00000025,0x000001a4,
+	0x00000196,0x0008004f,0x000000bd,0x000001a5,
+	0x000001a4,0x000001a4,0x00000000,0x00000001,
+	0x00000002,0x0004003d,0x00000002,0x000001a6,
+	0x000000c9,0x000500aa,0x0000003c,0x000001a7,
+	0x000001a6,0x00000056,0x00050041,0x00000035,
+	0x000001a8,0x000000ca,0x00000127,0x0004003d,
+	0x0000000e,0x000001a9,0x000001a8,0x00050041,
+	0x00000035,0x000001aa,0x00000196,0x00000127,
+	0x0004003d,0x0000000e,0x000001ab,0x000001aa,
+	0x000600a9,0x0000000e,0x000001ac,0x000001a7,
+	0x000001a9,0x000001ab,0x00050050,0x00000025,
+	0x000001ad,0x000001a5,0x000001ac,0x0003003e,
+	0x000000ca,0x000001ad,0x0004003d,0x00000025,
+	0x000001ae,0x0000019d,0x0008004f,0x000000bd,
+	0x000001af,0x000001ae,0x000001ae,0x00000000,
+	0x00000001,0x00000002,0x0004003d,0x00000002,
+	0x000001b0,0x000000c9,0x000500aa,0x0000003c,
+	0x000001b1,0x000001b0,0x00000056,0x00050041,
+	0x00000035,0x000001b2,0x000000cb,0x00000127,
+	0x0004003d,0x0000000e,0x000001b3,0x000001b2,
+	0x00050041,0x00000035,0x000001b4,0x0000019d,
+	0x00000127,0x0004003d,0x0000000e,0x000001b5,
+	0x000001b4,0x000600a9,0x0000000e,0x000001b6,
+	0x000001b1,0x000001b3,0x000001b5,0x00050050,
+	0x00000025,0x000001b7,0x000001af,0x000001b6,
+	0x0003003e,0x000000cb,0x000001b7,0x000100fd,
+	0x00010038,0x00050036,0x00000002,0x0000002e,
+	0x00000000,0x000001b9,0x00030037,0x000001b8,
+	0x000001ba,0x000200f8,0x000001bb,0x0004003b,
+	0x000001bd,0x000001bc,0x00000007,0x0004003d,
+	0x000000bd,0x000001be,0x000001ba,0x0008000c,
+	0x000000bd,0x000001c1,0x00000001,0x0000002b,
+	0x000001be,0x000001bf,0x000001c0,0x00050085,
+	0x000000bd,0x000001c5,0x000001c1,0x000001c4,
+	0x00050088,0x000000bd,0x000001c6,0x000001c5,
+	0x000001c0,0x00050081,0x000000bd,0x000001c9,
+	0x000001c6,0x000001c8,0x0006000c,0x000000bd,
+	0x000001ca,0x00000001,0x00000008,0x000001c9,
+	0x0004006d,0x00000029,0x000001cb,0x000001ca,
+	0x0003003e,0x000001bc,0x000001cb,0x00050041,
+	0x00000049,0x000001cc,0x000001bc,0x0000005d,
+	0x0004003d,0x00000002,0x000001cd,0x000001cc,
+	0x000500c4,0x00000002,0x000001cf,0x000001cd,
+	0x000001ce,0x00050041,0x00000049,0x000001d0,
+	0x000001bc,0x000000b3,0x0004003d,0x00000002,
+	0x000001d1,0x000001d0,0x000500c4,0x00000002,
+	0x000001d3,0x000001d1,0x000001d2,0x000500c5,
+	0x00000002,0x000001d4,0x000001cf,0x000001d3,
+	0x00050041,0x00000049,0x000001d5,0x000001bc,
+	0x000000b8,0x0004003d,0x00000002,0x000001d6,
+	0x000001d5,0x000500c5,0x00000002,0x000001d7,
+	0x000001d4,0x000001d6,0x000200fe,0x000001d7,
+	0x00010038,0x00050036,0x000000bd,0x0000002f,
+	0x00000000,0x000001d8,0x00030037,0x00000049,
+	0x000001d9,0x000200f8,0x000001da,0x0004003d,
+	0x00000002,0x000001db,0x000001d9,0x000500c2,
+	0x00000002,0x000001dc,0x000001db,0x000001ce,
+	0x0004003d,0x00000002,0x000001dd,0x000001d9,
+	0x000500c2,0x00000002,0x000001de,0x000001dd,
+	0x000001d2,0x0004003d,0x00000002,0x000001df,
+	0x000001d9,0x00060050,0x00000029,0x000001e0,
+	0x000001dc,0x000001de,0x000001df,0x000500c7,
+	0x00000029,0x000001e4,0x000001e0,0x000001e3,
+	0x00040070,0x000000bd,0x000001e5,0x000001e4,
+	0x0005008e,0x000000bd,0x000001e6,0x000001e5,
+	0x000000ab,0x00050088,0x000000bd,0x000001e7,
+	0x000001e6,0x000001c4,0x000200fe,0x000001e7,
+	0x00010038,0x00050036,0x000001e8,0x00000030,
+	0x00000000,0x000001e9,0x00030037,0x00000049,
+	0x000001ea,0x000200f8,0x000001eb,0x0004003b,
+	0x00000054,0x000001ec,0x00000007,0x0004003b,
+	0x00000054,0x000001ed,0x00000007,0x0004003b,
+	0x00000049,0x000001ee,0x00000007,0x0004003b,
+	0x00000049,0x000001f0,0x00000007,0x0004003b,
+	0x00000054,0x000001f1,0x00000007,0x0004003b,
+	0x00000054,0x000001f2,0x00000007,0x0004003b,
+	0x00000049,0x000001f6,0x00000007,0x0004003b,
+	0x000001b8,0x000001f7,0x00000007,0x0004003b,
+	0x00000049,0x000001fb,0x00000007,0x0004003b,
+	0x000001b8,0x000001fc,0x00000007,0x0004003b,
+	0x00000049,0x00000205,0x00000007,0x0004003b,
+	0x000001b8,0x00000213,0x00000007,0x0004003b,
+	0x00000049,0x00000214,0x00000007,0x0004003b,
+	0x000001b8,0x00000217,0x00000007,0x0004003b,
+	0x00000049,0x00000218,0x00000007,0x0004003b,
+	0x0000021d,0x0000021b,0x00000007,0x0004003b,
+	0x00000049,0x0000022e,0x00000007,0x0004003b,
+	0x00000049,0x0000022f,0x00000007,0x0004003b,
+	0x00000049,0x00000237,0x00000007,0x0004003b,
+	0x00000035,0x00000238,0x00000007,0x0004003b,
+	0x00000049,0x0000023a,0x00000007,0x0004003b,
+	0x000001b8,0x00000242,0x00000007,0x0004003d,
+	0x00000002,0x000001ef,0x000001ea,0x0003003e,
+	0x000001ee,0x000001ef,0x0003003e,0x000001f0,
+	0x00000056,0x00080039,0x000000c6,0x000001f3,
+	0x0000002d,0x000001ee,0x000001f0,0x000001f1,
+	0x000001f2,0x0004003d,0x00000025,0x000001f4,
+	0x000001f1,0x0003003e,0x000001ec,0x000001f4,
+	0x0004003d,0x00000025,0x000001f5,0x000001f2,
+	0x0003003e,0x000001ed,0x000001f5,0x0004003d,
+	0x00000025,0x000001f8,0x000001ed,0x0008004f,
+	0x000000bd,0x000001f9,0x000001f8,0x000001f8,
+	0x00000000,0x00000001,0x00000002,0x0003003e,
+	0x000001f7,0x000001f9,0x00050039,0x00000002,
+	0x000001fa,0x0000002e,0x000001f7,0x0003003e,
+	0x000001f6,0x000001fa,0x0004003d,0x00000025,
+	0x000001fd,0x000001ec,0x0008004f,0x000000bd,
+	0x000001fe,0x000001fd,0x000001fd,0x00000000,
+	0x00000001,0x00000002,0x0003003e,0x000001fc,
+	0x000001fe,0x00050039,0x00000002,0x000001ff,
+	0x0000002e,0x000001fc,0x0003003e,0x000001fb,
+	0x000001ff,0x0004003d,0x00000002,0x00000200,
+	0x000001f6,0x0004003d,0x00000002,0x00000201,
+	0x000001fb,0x000500b0,0x0000003c,0x00000202,
+	0x00000200,0x00000201,0x000300f7,0x00000203,
+	0x00000000,0x000400fa,0x00000202,0x00000204,
+	0x00000203,0x000200f8,0x00000204,0x0004003d,
+	0x00000002,0x00000206,0x000001f6,0x0003003e,
+	0x00000205,0x00000206,0x0004003d,0x00000002,
+	0x00000207,0x000001fb,0x0003003e,0x000001f6,
+	0x00000207,0x0004003d,0x00000002,0x00000208,
+	0x00000205,0x0003003e,0x000001fb,0x00000208,
+	0x000200f9,0x00000203,0x000200f8,0x00000203,
+	0x0004003d,0x00000002,0x00000209,0x000001f6,
+	0x0004003d,0x00000002,0x0000020a,0x000001fb,
+	0x000500aa,0x0000003c,0x0000020b,0x00000209,
+	0x0000020a,0x000300f7,0x0000020c,0x00000000,
+	0x000400fa,0x0000020b,0x0000020d,0x0000020c,
+	0x000200f8,0x0000020d,0x0004003d,0x00000002,
+	0x0000020e,0x000001f6,0x0004003d,0x00000002,
+	0x0000020f,0x000001fb,0x000500c4,0x00000002,
+	0x00000210,0x0000020f,0x0000001f,0x000500c5,
+	0x00000002,0x00000211,0x0000020e,0x00000210,
+	0x00050050,0x000001e8,0x00000212,0x00000211,
+	0x000000a5,0x000200fe,0x00000212,0x000200f8,
+	0x0000020c,0x0004003d,0x00000002,0x00000215,
+	0x000001f6,0x0003003e,0x00000214,0x00000215,
+	0x00050039,0x000000bd,0x00000216,0x0000002f,
+	0x00000214,0x0003003e,0x00000213,0x00000216,
+	0x0004003d,0x00000002,0x00000219,0x000001fb,
+	0x0003003e,0x00000218,0x00000219,0x00050039,
+	0x000000bd,0x0000021a,0x0000002f,0x00000218,
+	0x0003003e,0x00000217,0x0000021a,0x0004003d,
+	0x000000bd,0x0000021e,0x00000213,0x0004003d,
+	0x000000bd,0x0000021f,0x00000217,0x0004003d,
+	0x000000bd,0x00000221,0x00000213,0x0005008e,
+	0x000000bd,0x00000222,0x00000221,0x00000220,
+	0x0004003d,0x000000bd,0x00000223,0x00000217,
+	0x00050081,0x000000bd,0x00000224,0x00000222,
+	0x00000223,0x00050088,0x000000bd,0x00000227,
+	0x00000224,0x00000226,0x0004003d,0x000000bd,
+	0x00000228,0x00000213,0x0004003d,0x000000bd,
+	0x00000229,0x00000217,0x0005008e,0x000000bd,
+	0x0000022a,0x00000229,0x00000220,0x00050081,
+	0x000000bd,0x0000022b,0x00000228,0x0000022a,
+	0x00050088,0x000000bd,0x0000022c,0x0000022b,
+	0x00000226,0x00070050,0x0000021c,0x0000022d,
+	0x0000021e,0x0000021f,0x00000227,0x0000022c,
+	0x0003003e,0x0000021b,0x0000022d,0x0003003e,
+	0x0000022e,0x000000a5,0x0003003e,0x0000022f,
+	0x000000a5,0x000200f9,0x00000230,0x000200f8,
+	0x00000230,0x000400f6,0x00000234,0x00000233,
+	0x00000000,0x000200f9,0x00000231,0x000200f8,
+	0x00000231,0x0004003d,0x00000002,0x00000235,
+	0x0000022f,0x000500b0,0x0000003c,0x00000236,
+	0x00000235,0x0000001f,0x000400fa,0x00000236,
+	0x00000232,0x00000234,0x000200f8,0x00000232,
+	0x0003003e,0x00000237,0x000000a5,0x0003003e,
+	0x00000238,0x00000239,0x0003003e,0x0000023a,
+	0x000000a5,0x000200f9,0x0000023b,0x000200f8,
+	0x0000023b,0x000400f6,0x0000023f,0x0000023e,
+	0x00000000,0x000200f9,0x0000023c,0x000200f8,
+	0x0000023c,0x0004003d,0x00000002,0x00000240,
+	0x0000023a,0x000500b0,0x0000003c,0x00000241,
+	0x00000240,0x00000074,0x000400fa,0x00000241,
+	0x0000023d,0x0000023f,0x000200f8,0x0000023d,
+	0x0004003d,0x00000002,0x00000243,0x0000022f,
+	0x00050041,0x000000ce,0x00000244,0x00000024,
+	0x00000243,0x0004003d,0x00000025,0x00000245,
+	0x00000244,0x0008004f,0x000000bd,0x00000246,
+	0x00000245,0x00000245,0x00000000,0x00000001,
+	0x00000002,0x0004003d,0x00000002,0x00000247,
+	0x0000023a,0x00050041,0x000001b8,0x00000248,
+	0x0000021b,0x00000247,0x0004003d,0x000000bd,
+	0x00000249,0x00000248,0x00050083,0x000000bd,
+	0x0000024a,0x00000246,0x00000249,0x0003003e,
+	0x00000242,0x0000024a,0x0004003d,0x000000bd,
+	0x0000024b,0x00000242,0x0004003d,0x000000bd,
+	0x0000024c,0x00000242,0x00050094,0x0000000e,
+	0x0000024d,0x0000024b,0x0000024c,0x0004003d,
+	0x0000000e,0x0000024e,0x00000238,0x000500b8,
+	0x0000003c,0x0000024f,0x0000024d,0x0000024e,
+	0x000300f7,0x00000250,0x00000000,0x000400fa,
+	0x0000024f,0x00000251,0x00000250,0x000200f8,
+	0x00000251,0x0004003d,0x00000002,0x00000252,
+	0x0000023a,0x0003003e,0x00000237,0x00000252,
+	0x0004003d,0x000000bd,0x00000253,0x00000242,
+	0x0004003d,0x000000bd,0x00000254,0x00000242,
+	0x00050094,0x0000000e,0x00000255,0x00000253,
+	0x00000254,0x0003003e,0x00000238,0x00000255,
+	0x000200f9,0x00000250,0x000200f8,0x00000250,
+	0x000200f9,0x0000023e,0x000200f8,0x0000023e,
+	0x0004003d,0x00000002,0x00000256,0x0000023a,
+	0x00050080,0x00000002,0x00000257,0x00000256,
+	0x00000067,0x0003003e,0x0000023a,0x00000257,
+	0x000200f9,0x0000023b,0x000200f8,0x0000023f,
+	0x0004003d,0x00000002,0x00000258,0x0000022e,
+	0x0004003d,0x00000002,0x00000259,0x00000237,
+	0x0004003d,0x00000002,0x0000025a,0x0000022f,
+	0x00050084,0x00000002,0x0000025b,0x0000025a,
+	0x00000058,0x000500c4,0x00000002,0x0000025c,
+	0x00000259,0x0000025b,0x000500c5,0x00000002,
+	0x0000025d,0x00000258,0x0000025c,0x0003003e,
+	0x0000022e,0x0000025d,0x000200f9,0x00000233,
+	0x000200f8,0x00000233,0x0004003d,0x00000002,
+	0x0000025e,0x0000022f,0x00050080,0x00000002,
+	0x0000025f,0x0000025e,0x00000067,0x0003003e,
+	0x0000022f,0x0000025f,0x000200f9,0x00000230,
+	0x000200f8,0x00000234,0x0004003d,0x00000002,
+	0x00000260,0x000001f6,0x0004003d,0x00000002,
+	0x00000261,0x000001fb,0x000500c4,0x00000002,
+	0x00000262,0x00000261,0x0000001f,0x000500c5,
+	0x00000002,0x00000263,0x00000260,0x00000262,
+	0x0004003d,0x00000002,0x00000264,0x0000022e,
+	0x00050050,0x000001e8,0x00000265,0x00000263,
+	0x00000264,0x000200fe,0x00000265,0x00010038,
+	0x00050036,0x000001e8,0x00000031,0x00000000,
+	0x00000266,0x000200f8,0x00000267,0x0004003b,
+	0x00000035,0x00000268,0x00000007,0x0004003b,
+	0x00000035,0x00000269,0x00000007,0x0004003b,
+	0x00000049,0x0000026a,0x00000007,0x0004003b,
+	0x00000049,0x0000027f,0x00000007,0x0004003b,
+	0x00000049,0x00000284,0x00000007,0x0004003b,
+	0x0000028a,0x00000289,0x00000007,0x0004003b,
+	0x00000049,0x00000296,0x00000007,0x0004003b,
+	0x00000049,0x0000029e,0x00000007,0x0004003b,
+	0x00000049,0x000002b0,0x00000007,0x0004003b,
+	0x00000049,0x000002ba,0x00000007,0x0003003e,
+	0x00000268,0x000000ab,0x0003003e,0x00000269,
+	0x0000000f,0x0003003e,0x0000026a,0x000000a5,
+	0x000200f9,0x0000026b,0x000200f8,0x0000026b,
+	0x000400f6,0x0000026f,0x0000026e,0x00000000,
+	0x000200f9,0x0000026c,0x000200f8,0x0000026c,
+	0x0004003d,0x00000002,0x00000270,0x0000026a,
+	0x000500b0,0x0000003c,0x00000271,0x00000270,
+	0x0000001f,0x000400fa,0x00000271,0x0000026d,
+	0x0000026f,0x000200f8,0x0000026d,0x0004003d,
+	0x0000000e,0x00000272,0x00000268,0x0004003d,
+	0x00000002,0x00000273,0x0000026a,0x00060041,
+	0x00000275,0x00000274,0x00000024,0x00000273,
+	0x00000127,0x0004003d,0x0000000e,0x00000276,
+	0x00000274,0x0007000c,0x0000000e,0x00000277,
+	0x00000001,0x00000025,0x00000272,0x00000276,
+	0x0003003e,0x00000268,0x00000277,0x0004003d,
+	0x0000000e,0x00000278,0x00000269,0x0004003d,
+	0x00000002,0x00000279,0x0000026a,0x00060041,
+	0x00000275,0x0000027a,0x00000024,0x00000279,
+	0x00000127,0x0004003d,0x0000000e,0x0000027b,
+	0x0000027a,0x0007000c,0x0000000e,0x0000027c,
+	0x00000001,0x00000028,0x00000278,0x0000027b,
+	0x0003003e,0x00000269,0x0000027c,0x000200f9,
+	0x0000026e,0x000200f8,0x0000026e,0x0004003d,
+	0x00000002,0x0000027d,0x0000026a,0x00050080,
+	0x00000002,0x0000027e,0x0000027d,0x00000067,
+	0x0003003e,0x0000026a,0x0000027e,0x000200f9,
+	0x0000026b,0x000200f8,0x0000026f,0x0004003d,
+	0x0000000e,0x00000280,0x00000269,0x00050081,
+	0x0000000e,0x00000281,0x00000280,0x000001c7,
+	0x0006000c,0x0000000e,0x00000282,0x00000001,
+	0x00000008,0x00000281,0x0004006d,0x00000002,
+	0x00000283,0x00000282,0x0003003e,0x0000027f,
+	0x00000283,0x0004003d,0x0000000e,0x00000285,
+	0x00000268,0x00050081,0x0000000e,0x00000286,
+	0x00000285,0x000001c7,0x0006000c,0x0000000e,
+	0x00000287,0x00000001,0x00000008,0x00000286,
+	0x0004006d,0x00000002,0x00000288,0x00000287,
+	0x0003003e,0x00000284,0x00000288,0x0004003d,
+	0x00000002,0x0000028b,0x0000027f,0x0004003d,
+	0x00000002,0x0000028c,0x00000284,0x000500c4,
+	0x00000002,0x0000028d,0x0000028c,0x00000090,
+	0x000500c5,0x00000002,0x0000028e,0x0000028b,
+	0x0000028d,0x00050050,0x000001e8,0x0000028f,
+	0x0000028e,0x000000a5,0x0003003e,0x00000289,
+	0x0000028f,0x0004003d,0x00000002,0x00000290,
+	0x0000027f,0x0004003d,0x00000002,0x00000291,
+	0x00000284,0x000500aa,0x0000003c,0x00000292,
+	0x00000290,0x00000291,0x000300f7,0x00000293,
+	0x00000000,0x000400fa,0x00000292,0x00000294,
+	0x00000293,0x000200f8,0x00000294,0x0004003d,
+	0x000001e8,0x00000295,0x00000289,0x000200fe,
+	0x00000295,0x000200f8,0x00000293,0x0003003e,
+	0x00000296,0x000000a5,0x000200f9,0x00000297,
+	0x000200f8,0x00000297,0x000400f6,0x0000029b,
+	0x0000029a,0x00000000,0x000200f9,0x00000298,
+	0x000200f8,0x00000298,0x0004003d,0x00000002,
+	0x0000029c,0x00000296,0x000500b0,0x0000003c,
+	0x0000029d,0x0000029c,0x0000001f,0x000400fa,
+	0x0000029d,0x00000299,0x0000029b,0x000200f8,
+	0x00000299,0x0004003d,0x00000002,0x0000029f,
+	0x00000296,0x00060041,0x00000275,0x000002a0,
+	0x00000024,0x0000029f,0x00000127,0x0004003d,
+	0x0000000e,0x000002a1,0x000002a0,0x0004003d,
+	0x00000002,0x000002a2,0x00000284,0x00040070,
+	0x0000000e,0x000002a3,0x000002a2,0x00050083,
+	0x0000000e,0x000002a4,0x000002a1,0x000002a3,
+	0x0004003d,0x00000002,0x000002a5,0x0000027f,
+	0x0004003d,0x00000002,0x000002a6,0x00000284,
+	0x00050082,0x00000002,0x000002a7,0x000002a5,
+	0x000002a6,0x00040070,0x0000000e,0x000002a8,
+	0x000002a7,0x00050088,0x0000000e,0x000002a9,
+	0x000002a4,0x000002a8,0x00050085,0x0000000e,
+	0x000002ab,0x000002a9,0x000002aa,0x00050081,
+	0x0000000e,0x000002ac,0x000002ab,0x000001c7,
+	0x0006000c,0x0000000e,0x000002ad,0x00000001,
+	0x00000008,0x000002ac,0x0008000c,0x0000000e,
+	0x000002ae,0x00000001,0x0000002b,0x000002ad,
+	0x0000000f,0x000002aa,0x0004006d,0x00000002,
+	0x000002af,0x000002ae,0x0003003e,0x0000029e,
+	0x000002af,0x0004003d,0x00000002,0x000002b1,
+	0x0000029e,0x000500aa,0x0000003c,0x000002b3,
+	0x000002b1,0x000002b2,0x0004003d,0x00000002,
+	0x000002b4,0x0000029e,0x000500aa,0x0000003c,
+	0x000002b5,0x000002b4,0x000000a5,0x0004003d,
+	0x00000002,0x000002b6,0x0000029e,0x00050082,
+	0x00000002,0x000002b7,0x00000090,0x000002b6,
+	0x000600a9,0x00000002,0x000002b8,0x000002b5,
+	0x00000067,0x000002b7,0x000600a9,0x00000002,
+	0x000002b9,0x000002b3,0x000000a5,0x000002b8,
+	0x0003003e,0x000002b0,0x000002b9,0x0004003d,
+	0x00000002,0x000002bb,0x00000296,0x00050084,
+	0x00000002,0x000002bc,0x000002bb,0x00000056,
+	0x00050080,0x00000002,0x000002bd,0x0000001f,
+	0x000002bc,0x0003003e,0x000002ba,0x000002bd,
+	0x0004003d,0x00000002,0x000002be,0x000002ba,
+	0x000500ae,0x0000003c,0x000002c0,0x000002be,
+	0x000002bf,0x000300f7,0x000002c1,0x00000000,
+	0x000400fa,0x000002c0,0x000002c2,0x000002c3,
+	0x000200f8,0x000002c2,0x00050041,0x00000049,
+	0x000002c4,0x00000289,0x000000b3,0x0004003d,
+	0x00000002,0x000002c5,0x000002c4,0x0004003d,
+	0x00000002,0x000002c6,0x000002b0,0x0004003d,
+	0x00000002,0x000002c7,0x000002ba,0x00050082,
+	0x00000002,0x000002c8,0x000002c7,0x000002bf,
+	0x000500c4,0x00000002,0x000002c9,0x000002c6,
+	0x000002c8,0x000500c5,0x00000002,0x000002ca,
+	0x000002c5,0x000002c9,0x00050041,0x00000049,
+	0x000002cb,0x00000289,0x000000b3,0x0003003e,
+	0x000002cb,0x000002ca,0x000200f9,0x000002c1,
+	0x000200f8,0x000002c3,0x00050041,0x00000049,
+	0x000002cc,0x00000289,0x0000005d,0x0004003d,
+	0x00000002,0x000002cd,0x000002cc,0x0004003d,
+	0x00000002,0x000002ce,0x000002b0,0x0004003d,
+	0x00000002,0x000002cf,0x000002ba,0x000500c4,
+	0x00000002,0x000002d0,0x000002ce,0x000002cf,
+	0x000500c5,0x00000002,0x000002d1,0x000002cd,
+	0x000002d0,0x00050041,0x00000049,0x000002d2,
+	0x00000289,0x0000005d,0x0003003e,0x000002d2,
+	0x000002d1,0x0004003d,0x00000002,0x000002d3,
+	0x000002ba,0x000500ac,0x0000003c,0x000002d5,
+	0x000002d3,0x000002d4,0x000300f7,0x000002d6,
+	0x00000000,0x000400fa,0x000002d5,0x000002d7,
+	0x000002d6,0x000200f8,0x000002d7,0x00050041,
+	0x00000049,0x000002d8,0x00000289,0x000000b3,
+	0x0004003d,0x00000002,0x000002d9,0x000002d8,
+	0x0004003d,0x00000002,0x000002da,0x000002b0,
+	0x0004003d,0x00000002,0x000002db,0x000002ba,
+	0x00050082,0x00000002,0x000002dc,0x000002bf,
+	0x000002db,0x000500c2,0x00000002,0x000002dd,
+	0x000002da,0x000002dc,0x000500c5,0x00000002,
+	0x000002de,0x000002d9,0x000002dd,0x00050041,
+	0x00000049,0x000002df,0x00000289,0x000000b3,
+	0x0003003e,0x000002df,0x000002de,0x000200f9,
+	0x000002d6,0x000200f8,0x000002d6,0x000200f9,
+	0x000002c1,0x000200f8,0x000002c1,0x000200f9,
+	0x0000029a,0x000200f8,0x0000029a,0x0004003d,
+	0x00000002,0x000002e0,0x00000296,0x00050080,
+	0x00000002,0x000002e1,0x000002e0,0x00000067,
+	0x0003003e,0x00000296,0x000002e1,0x000200f9,
+	0x00000297,0x000200f8,0x0000029b,0x0004003d,
+	0x000001e8,0x000002e2,0x00000289,0x000200fe,
+	0x000002e2,0x00010038,0x00050036,0x000000c6,
+	0x00000032,0x00000000,0x000002e4,0x00030037,
+	0x000002e3,0x000002e5,0x00030037,0x00000049,
+	0x000002e6,0x00030037,0x00000049,0x000002e7,
+	0x00030037,0x00000049,0x000002e8,0x000200f8,
+	0x000002e9,0x0004003b,0x00000049,0x000002ea,
+	0x00000007,0x0004003b,0x00000049,0x000002ed,
+	0x00000007,0x0004003d,0x00000002,0x000002eb,
+	0x000002e6,0x000500c2,0x00000002,0x000002ec,
+	0x000002eb,0x000001d2,0x0003003e,0x000002ea,
+	0x000002ec,0x0004003d,0x00000002,0x000002ee,
+	0x000002e6,0x000500c7,0x00000002,0x000002ef,
+	0x000002ee,0x000001e1,0x0003003e,0x000002ed,
+	0x000002ef,0x0004003d,0x00000002,0x000002f0,
+	0x000002ea,0x00050041,0x00000049,0x000002f1,
+	0x000002e5,0x000002f0,0x0004003d,0x00000002,
+	0x000002f2,0x000002f1,0x0004003d,0x00000002,
+	0x000002f3,0x000002e7,0x0004003d,0x00000002,
+	0x000002f4,0x000002ed,0x000500c4,0x00000002,
+	0x000002f5,0x000002f3,0x000002f4,0x000500c5,
+	0x00000002,0x000002f6,0x000002f2,0x000002f5,
+	0x00050041,0x00000049,0x000002f7,0x000002e5,
+	0x000002f0,0x0003003e,0x000002f7,0x000002f6,
+	0x0004003d,0x00000002,0x000002f8,0x000002ed,
+	0x0004003d,0x00000002,0x000002f9,0x000002e8,
+	0x00050080,0x00000002,0x000002fa,0x000002f8,
+	0x000002f9,0x000500ac,0x0000003c,0x000002fb,
+	0x000002fa,0x000002bf,0x000300f7,0x000002fc,
+	0x00000000,0x000400fa,0x000002fb,0x000002fd,
+	0x000002fc,0x000200f8,0x000002fd,0x0004003d,
+	0x00000002,0x000002fe,0x000002ea,0x00050080,
+	0x00000002,0x000002ff,0x000002fe,0x00000067,
+	0x00050041,0x00000049,0x00000300,0x000002e5,
+	0x000002ff,0x0004003d,0x00000002,0x00000301,
+	0x00000300,0x0004003d,0x00000002,0x00000302,
+	0x000002e7,0x0004003d,0x00000002,0x00000303,
+	0x000002ed,0x00050082,0x00000002,0x00000304,
+	0x000002bf,0x00000303,0x000500c2,0x00000002,
+	0x00000305,0x00000302,0x00000304,0x000500c5,
+	0x00000002,0x00000306,0x00000301,0x00000305,
+	0x00050041,0x00000049,0x00000307,0x000002e5,
+	0x000002ff,0x0003003e,0x00000307,0x00000306,
+	0x000200f9,0x000002fc,0x000200f8,0x000002fc,
+	0x0004003d,0x00000002,0x00000308,0x000002e6,
+	0x0004003d,0x00000002,0x00000309,0x000002e8,
+	0x00050080,0x00000002,0x0000030a,0x00000308,
+	0x00000309,0x0003003e,0x000002e6,0x0000030a,
+	0x000100fd,0x00010038,0x00050036,0x00000088,
+	0x00000033,0x00000000,0x0000030b,0x00030037,
+	0x00000049,0x0000030c,0x000200f8,0x0000030d,
+	0x0004003b,0x00000310,0x0000030e,0x00000007,
+	0x0004003b,0x00000049,0x00000311,0x00000007,
+	0x0004003b,0x00000049,0x00000313,0x00000007,
+	0x0004003b,0x00000054,0x00000314,0x00000007,
+	0x0004003b,0x00000054,0x00000315,0x00000007,
+	0x0004003b,0x0000031d,0x0000031b,0x00000007,
+	0x0004003b,0x00000320,0x0000031e,0x00000007,
+	0x0004003b,0x00000049,0x00000321,0x00000007,
+	0x0004003b,0x00000035,0x00000329,0x00000007,
+	0x0004003b,0x00000049,0x0000032a,0x00000007,
+	0x0004003b,0x000002e3,0x00000332,0x00000007,
+	0x0004003b,0x00000054,0x00000343,0x00000007,
+	0x0004003b,0x00000054,0x00000363,0x00000007,
+	0x0004003b,0x00000054,0x0000036c,0x00000007,
+	0x0004003b,0x00000054,0x00000375,0x00000007,
+	0x0004003b,0x00000035,0x00000379,0x00000007,
+	0x0004003b,0x00000380,0x0000037e,0x00000007,
+	0x0004003b,0x00000049,0x00000381,0x00000007,
+	0x0004003b,0x00000035,0x00000389,0x00000007,
+	0x0004003b,0x00000049,0x00000395,0x00000007,
+	0x0004003b,0x00000035,0x00000396,0x00000007,
+	0x0004003b,0x00000049,0x00000397,0x00000007,
+	0x0004003b,0x00000035,0x0000039f,0x00000007,
+	0x0004003b,0x00000054,0x000003b0,0x00000007,
+	0x0004003b,0x00000049,0x000003d8,0x00000007,
+	0x0004003b,0x00000049,0x000003de,0x00000007,
+	0x0004003b,0x000002e3,0x000003ef,0x00000007,
+	0x0004003b,0x00000049,0x000003f1,0x00000007,
+	0x0004003b,0x000002e3,0x000003f2,0x00000007,
+	0x0004003b,0x00000049,0x000003f4,0x00000007,
+	0x0004003b,0x00000049,0x000003f6,0x00000007,
+	0x0004003b,0x00000049,0x000003f8,0x00000007,
+	0x0004003b,0x00000049,0x000003fc,0x00000007,
+	0x0004003b,0x000002e3,0x00000404,0x00000007,
+	0x0004003b,0x00000049,0x00000406,0x00000007,
+	0x0004003b,0x00000049,0x00000408,0x00000007,
+	0x0004003b,0x00000049,0x0000040d,0x00000007,
+	0x0004003b,0x000002e3,0x00000411,0x00000007,
+	0x0004003b,0x00000049,0x00000413,0x00000007,
+	0x0004003b,0x00000049,0x00000415,0x00000007,
+	0x0004003b,0x00000049,0x0000041b,0x00000007,
+	0x0004003b,0x000002e3,0x00000421,0x00000007,
+	0x0004003b,0x00000049,0x00000423,0x00000007,
+	0x0004003b,0x00000049,0x00000425,0x00000007,
+	0x0004003b,0x00000049,0x00000429,0x00000007,
+	0x0004003b,0x000002e3,0x0000042d,0x00000007,
+	0x0004003b,0x00000049,0x0000042f,0x00000007,
+	0x0004003b,0x00000049,0x00000431,0x00000007,
+	0x0004003b,0x00000049,0x00000436,0x00000007,
+	0x0004003b,0x000002e3,0x0000043a,0x00000007,
+	0x0004003b,0x00000049,0x0000043c,0x00000007,
+	0x0004003b,0x00000049,0x0000043e,0x00000007,
+	0x0004003b,0x00000049,0x00000441,0x00000007,
+	0x0004003b,0x00000049,0x00000445,0x00000007,
+	0x0004003b,0x000002e3,0x0000044d,0x00000007,
+	0x0004003b,0x00000049,0x0000044f,0x00000007,
+	0x0004003b,0x00000049,0x00000451,0x00000007,
+	0x0004003b,0x00000049,0x00000455,0x00000007,
+	0x0004003d,0x00000002,0x00000312,0x0000030c,
+	0x0003003e,0x00000311,0x00000312,0x0003003e,
+	0x00000313,0x00000074,0x00080039,0x000000c6,
+	0x00000316,0x0000002d,0x00000311,0x00000313,
+	0x00000314,0x00000315,0x0004003d,0x00000025,
+	0x00000317,0x00000314,0x00050041,0x00000054,
+	0x00000318,0x0000030e,0x0000005d,0x0003003e,
+	0x00000318,0x00000317,0x0004003d,0x00000025,
+	0x00000319,0x00000315,0x00050041,0x00000054,
+	0x0000031a,0x0000030e,0x000000b3,0x0003003e,
+	0x0000031a,0x00000319,0x0003003e,0x00000321,
+	0x000000a5,0x000200f9,0x00000322,0x000200f8,
+	0x00000322,0x000400f6,0x00000326,0x00000325,
+	0x00000000,0x000200f9,0x00000323,0x000200f8,
+	0x00000323,0x0004003d,0x00000002,0x00000327,
+	0x00000321,0x000500b0,0x0000003c,0x00000328,
+	0x00000327,0x00000058,0x000400fa,0x00000328,
+	0x00000324,0x00000326,0x000200f8,0x00000324,
+	0x0003003e,0x00000329,0x00000239,0x0003003e,
+	0x0000032a,0x000000a5,0x000200f9,0x0000032b,
+	0x000200f8,0x0000032b,0x000400f6,0x0000032f,
+	0x0000032e,0x00000000,0x000200f9,0x0000032c,
+	0x000200f8,0x0000032c,0x0004003d,0x00000002,
+	0x00000330,0x0000032a,0x000500b0,0x0000003c,
+	0x00000331,0x00000330,0x00000058,0x000400fa,
+	0x00000331,0x0000032d,0x0000032f,0x000200f8,
+	0x0000032d,0x0004003d,0x00000002,0x00000333,
+	0x00000321,0x00050041,0x00000054,0x00000334,
+	0x0000030e,0x00000333,0x0004003d,0x00000025,
+	0x00000335,0x00000334,0x0004003d,0x00000002,
+	0x00000336,0x0000032a,0x00040070,0x0000000e,
+	0x00000337,0x00000336,0x00070050,0x00000025,
+	0x00000338,0x00000337,0x00000337,0x00000337,
+	0x00000337,0x00050083,0x00000025,0x00000339,
+	0x00000335,0x00000338,0x00050088,0x00000025,
+	0x0000033b,0x00000339,0x0000033a,0x00050081,
+	0x00000025,0x0000033d,0x0000033b,0x0000033c,
+	0x0006000c,0x00000025,0x0000033e,0x00000001,
+	0x00000008,0x0000033d,0x0008000c,0x00000025,
+	0x00000341,0x00000001,0x0000002b,0x0000033e,
+	0x000000c2,0x00000340,0x0004006d,0x00000088,
+	0x00000342,0x00000341,0x0003003e,0x00000332,
+	0x00000342,0x0004003d,0x00000088,0x00000344,
+	0x00000332,0x000500c4,0x00000088,0x00000346,
+	0x00000344,0x00000345,0x0004003d,0x00000002,
+	0x00000347,0x0000032a,0x00070050,0x00000088,
+	0x00000348,0x00000347,0x00000347,0x00000347,
+	0x00000347,0x000500c5,0x00000088,0x00000349,
+	0x00000346,0x00000348,0x00040070,0x00000025,
+	0x0000034a,0x00000349,0x0004003d,0x00000002,
+	0x0000034b,0x00000321,0x00050041,0x00000054,
+	0x0000034c,0x0000030e,0x0000034b,0x0004003d,
+	0x00000025,0x0000034d,0x0000034c,0x00050083,
+	0x00000025,0x0000034e,0x0000034a,0x0000034d,
+	0x0003003e,0x00000343,0x0000034e,0x0004003d,
+	0x00000025,0x0000034f,0x00000343,0x0004003d,
+	0x00000025,0x00000350,0x00000343,0x00050094,
+	0x0000000e,0x00000351,0x0000034f,0x00000350,
+	0x0004003d,0x0000000e,0x00000352,0x00000329,
+	0x000500b8,0x0000003c,0x00000353,0x00000351,
+	0x00000352,0x000300f7,0x00000354,0x00000000,
+	0x000400fa,0x00000353,0x00000355,0x00000354,
+	0x000200f8,0x00000355,0x0004003d,0x00000025,
+	0x00000356,0x00000343,0x0004003d,0x00000025,
+	0x00000357,0x00000343,0x00050094,0x0000000e,
+	0x00000358,0x00000356,0x00000357,0x0003003e,
+	0x00000329,0x00000358,0x0004003d,0x00000002,
+	0x00000359,0x00000321,0x0004003d,0x00000088,
+	0x0000035a,0x00000332,0x00050041,0x000002e3,
+	0x0000035b,0x0000031b,0x00000359,0x0003003e,
+	0x0000035b,0x0000035a,0x0004003d,0x00000002,
+	0x0000035c,0x00000321,0x0004003d,0x00000002,
+	0x0000035d,0x0000032a,0x00050041,0x00000049,
+	0x0000035e,0x0000031e,0x0000035c,0x0003003e,
+	0x0000035e,0x0000035d,0x000200f9,0x00000354,
+	0x000200f8,0x00000354,0x000200f9,0x0000032e,
+	0x000200f8,0x0000032e,0x0004003d,0x00000002,
+	0x0000035f,0x0000032a,0x00050080,0x00000002,
+	0x00000360,0x0000035f,0x00000067,0x0003003e,
+	0x0000032a,0x00000360,0x000200f9,0x0000032b,
+	0x000200f8,0x0000032f,0x000200f9,0x00000325,
+	0x000200f8,0x00000325,0x0004003d,0x00000002,
+	0x00000361,0x00000321,0x00050080,0x00000002,
+	0x00000362,0x00000361,0x00000067,0x0003003e,
+	0x00000321,0x00000362,0x000200f9,0x00000322,
+	0x000200f8,0x00000326,0x00050041,0x000002e3,
+	0x00000364,0x0000031b,0x0000005d,0x0004003d,
+	0x00000088,0x00000365,0x00000364,0x000500c4,
+	0x00000088,0x00000366,0x00000365,0x00000345,
+	0x00050041,0x00000049,0x00000367,0x0000031e,
+	0x0000005d,0x0004003d,0x00000002,0x00000368,
+	0x00000367,0x00070050,0x00000088,0x00000369,
+	0x00000368,0x00000368,0x00000368,0x00000368,
+	0x000500c5,0x00000088,0x0000036a,0x00000366,
+	0x00000369,0x00040070,0x00000025,0x0000036b,
+	0x0000036a,0x0003003e,0x00000363,0x0000036b,
+	0x00050041,0x000002e3,0x0000036d,0x0000031b,
+	0x000000b3,0x0004003d,0x00000088,0x0000036e,
+	0x0000036d,0x000500c4,0x00000088,0x0000036f,
+	0x0000036e,0x00000345,0x00050041,0x00000049,
+	0x00000370,0x0000031e,0x000000b3,0x0004003d,
+	0x00000002,0x00000371,0x00000370,0x00070050,
+	0x00000088,0x00000372,0x00000371,0x00000371,
+	0x00000371,0x00000371,0x000500c5,0x00000088,
+	0x00000373,0x0000036f,0x00000372,0x00040070,
+	0x00000025,0x00000374,0x00000373,0x0003003e,
+	0x0000036c,0x00000374,0x0004003d,0x00000025,
+	0x00000376,0x0000036c,0x0004003d,0x00000025,
+	0x00000377,0x00000363,0x00050083,0x00000025,
+	0x00000378,0x00000376,0x00000377,0x0003003e,
+	0x00000375,0x00000378,0x0004003d,0x00000025,
+	0x0000037a,0x00000375,0x0004003d,0x00000025,
+	0x0000037b,0x00000375,0x00050094,0x0000000e,
+	0x0000037c,0x0000037a,0x0000037b,0x0007000c,
+	0x0000000e,0x0000037d,0x00000001,0x00000028,
+	0x0000037c,0x00000158,0x0003003e,0x00000379,
+	0x0000037d,0x0003003e,0x00000381,0x000000a5,
+	0x000200f9,0x00000382,0x000200f8,0x00000382,
+	0x000400f6,0x00000386,0x00000385,0x00000000,
+	0x000200f9,0x00000383,0x000200f8,0x00000383,
+	0x0004003d,0x00000002,0x00000387,0x00000381,
+	0x000500b0,0x0000003c,0x00000388,0x00000387,
+	0x0000001f,0x000400fa,0x00000388,0x00000384,
+	0x00000386,0x000200f8,0x00000384,0x0004003d,
+	0x00000002,0x0000038a,0x00000381,0x00050041,
+	0x000000ce,0x0000038b,0x00000024,0x0000038a,
+	0x0004003d,0x00000025,0x0000038c,0x0000038b,
+	0x0004003d,0x00000025,0x0000038d,0x00000363,
+	0x00050083,0x00000025,0x0000038e,0x0000038c,
+	0x0000038d,0x0004003d,0x00000025,0x0000038f,
+	0x00000375,0x00050094,0x0000000e,0x00000390,
+	0x0000038e,0x0000038f,0x0004003d,0x0000000e,
+	0x00000391,0x00000379,0x00050088,0x0000000e,
+	0x00000392,0x00000390,0x00000391,0x0008000c,
+	0x0000000e,0x00000393,0x00000001,0x0000002b,
+	0x00000392,0x0000000f,0x000000c1,0x00050085,
+	0x0000000e,0x00000394,0x00000393,0x0000001e,
+	0x0003003e,0x00000389,0x00000394,0x0003003e,
+	0x00000395,0x000000a5,0x0003003e,0x00000396,
+	0x00000239,0x0003003e,0x00000397,0x000000a5,
+	0x000200f9,0x00000398,0x000200f8,0x00000398,
+	0x000400f6,0x0000039c,0x0000039b,0x00000000,
+	0x000200f9,0x00000399,0x000200f8,0x00000399,
+	0x0004003d,0x00000002,0x0000039d,0x00000397,
+	0x000500b0,0x0000003c,0x0000039e,0x0000039d,
+	0x0000001f,0x000400fa,0x0000039e,0x0000039a,
+	0x0000039c,0x000200f8,0x0000039a,0x0004003d,
+	0x00000002,0x000003a0,0x0000030c,0x000500aa,
+	0x0000003c,0x000003a1,0x000003a0,0x000000a5,
+	0x000300f7,0x000003a2,0x00000000,0x000400fa,
+	0x000003a1,0x000003a3,0x000003a4,0x000200f8,
+	0x000003a3,0x0004003d,0x0000000e,0x000003a5,
+	0x00000389,0x0004003d,0x00000002,0x000003a6,
+	0x00000397,0x00050041,0x00000275,0x000003a7,
+	0x00000022,0x000003a6,0x0004003d,0x0000000e,
+	0x000003a8,0x000003a7,0x00050083,0x0000000e,
+	0x000003a9,0x000003a5,0x000003a8,0x0004003d,
+	0x0000000e,0x000003aa,0x00000389,0x0004003d,
+	0x00000002,0x000003ab,0x00000397,0x00050041,
+	0x00000275,0x000003ac,0x00000022,0x000003ab,
+	0x0004003d,0x0000000e,0x000003ad,0x000003ac,
+	0x00050083,0x0000000e,0x000003ae,0x000003aa,
+	0x000003ad,0x00050085,0x0000000e,0x000003af,
+	0x000003a9,0x000003ae,0x0003003e,0x0000039f,
+	0x000003af,0x000200f9,0x000003a2,0x000200f8,
+	0x000003a4,0x0004003d,0x00000002,0x000003b1,
+	0x00000381,0x00050041,0x000000ce,0x000003b2,
+	0x00000024,0x000003b1,0x0004003d,0x00000025,
+	0x000003b3,0x000003b2,0x0004003d,0x00000025,
+	0x000003b4,0x00000363,0x0004003d,0x00000002,
+	0x000003b5,0x00000397,0x00050041,0x00000275,
+	0x000003b6,0x00000022,0x000003b5,0x0004003d,
+	0x0000000e,0x000003b7,0x000003b6,0x00050083,
+	0x0000000e,0x000003b8,0x0000001e,0x000003b7,
+	0x0005008e,0x00000025,0x000003b9,0x000003b4,
+	0x000003b8,0x0004003d,0x00000025,0x000003ba,
+	0x0000036c,0x0004003d,0x00000002,0x000003bb,
+	0x00000397,0x00050041,0x00000275,0x000003bc,
+	0x00000022,0x000003bb,0x0004003d,0x0000000e,
+	0x000003bd,0x000003bc,0x0005008e,0x00000025,
+	0x000003be,0x000003ba,0x000003bd,0x00050081,
+	0x00000025,0x000003bf,0x000003b9,0x000003be,
+	0x00050081,0x00000025,0x000003c2,0x000003bf,
+	0x000003c1,0x00050088,0x00000025,0x000003c4,
+	0x000003c2,0x000003c3,0x0006000c,0x00000025,
+	0x000003c5,0x00000001,0x00000008,0x000003c4,
+	0x00050083,0x00000025,0x000003c6,0x000003b3,
+	0x000003c5,0x0003003e,0x000003b0,0x000003c6,
+	0x0004003d,0x00000025,0x000003c7,0x000003b0,
+	0x0004003d,0x00000025,0x000003c8,0x000003b0,
+	0x00050094,0x0000000e,0x000003c9,0x000003c7,
+	0x000003c8,0x0003003e,0x0000039f,0x000003c9,
+	0x000200f9,0x000003a2,0x000200f8,0x000003a2,
+	0x0004003d,0x0000000e,0x000003ca,0x0000039f,
+	0x0004003d,0x0000000e,0x000003cb,0x00000396,
+	0x000500b8,0x0000003c,0x000003cc,0x000003ca,
+	0x000003cb,0x000300f7,0x000003cd,0x00000000,
+	0x000400fa,0x000003cc,0x000003ce,0x000003cd,
+	0x000200f8,0x000003ce,0x0004003d,0x00000002,
+	0x000003cf,0x00000397,0x0003003e,0x00000395,
+	0x000003cf,0x0004003d,0x0000000e,0x000003d0,
+	0x0000039f,0x0003003e,0x00000396,0x000003d0,
+	0x000200f9,0x000003cd,0x000200f8,0x000003cd,
+	0x000200f9,0x0000039b,0x000200f8,0x0000039b,
+	0x0004003d,0x00000002,0x000003d1,0x00000397,
+	0x00050080,0x00000002,0x000003d2,0x000003d1,
+	0x00000067,0x0003003e,0x00000397,0x000003d2,
+	0x000200f9,0x00000398,0x000200f8,0x0000039c,
+	0x0004003d,0x00000002,0x000003d3,0x00000381,
+	0x0004003d,0x00000002,0x000003d4,0x00000395,
+	0x00050041,0x00000049,0x000003d5,0x0000037e,
+	0x000003d3,0x0003003e,0x000003d5,0x000003d4,
+	0x000200f9,0x00000385,0x000200f8,0x00000385,
+	0x0004003d,0x00000002,0x000003d6,0x00000381,
+	0x00050080,0x00000002,0x000003d7,0x000003d6,
+	0x00000067,0x0003003e,0x00000381,0x000003d7,
+	0x000200f9,0x00000382,0x000200f8,0x00000386,
+	0x0003003e,0x000003d8,0x000000a5,0x00050041,
+	0x00000049,0x000003d9,0x0000037e,0x0000005d,
+	0x0004003d,0x00000002,0x000003da,0x000003d9,
+	0x000500ae,0x0000003c,0x000003db,0x000003da,
+	0x00000090,0x000300f7,0x000003dc,0x00000000,
+	0x000400fa,0x000003db,0x000003dd,0x000003dc,
+	0x000200f8,0x000003dd,0x0003003e,0x000003d8,
+	0x00000067,0x0003003e,0x000003de,0x000000a5,
+	0x000200f9,0x000003df,0x000200f8,0x000003df,
+	0x000400f6,0x000003e3,0x000003e2,0x00000000,
+	0x000200f9,0x000003e0,0x000200f8,0x000003e0,
+	0x0004003d,0x00000002,0x000003e4,0x000003de,
+	0x000500b0,0x0000003c,0x000003e5,0x000003e4,
+	0x0000001f,0x000400fa,0x000003e5,0x000003e1,
+	0x000003e3,0x000200f8,0x000003e1,0x0004003d,
+	0x00000002,0x000003e6,0x000003de,0x0004003d,
+	0x00000002,0x000003e8,0x000003de,0x00050041,
+	0x00000049,0x000003e9,0x0000037e,0x000003e8,
+	0x0004003d,0x00000002,0x000003ea,0x000003e9,
+	0x00050082,0x00000002,0x000003eb,0x000003e7,
+	0x000003ea,0x00050041,0x00000049,0x000003ec,
+	0x0000037e,0x000003e6,0x0003003e,0x000003ec,
+	0x000003eb,0x000200f9,0x000003e2,0x000200f8,
+	0x000003e2,0x0004003d,0x00000002,0x000003ed,
+	0x000003de,0x00050080,0x00000002,0x000003ee,
+	0x000003ed,0x00000067,0x0003003e,0x000003de,
+	0x000003ee,0x000200f9,0x000003df,0x000200f8,
+	0x000003e3,0x000200f9,0x000003dc,0x000200f8,
+	0x000003dc,0x0003003e,0x000003ef,0x000003f0,
+	0x0003003e,0x000003f1,0x000000a5,0x0004003d,
+	0x00000088,0x000003f3,0x000003ef,0x0003003e,
+	0x000003f2,0x000003f3,0x0004003d,0x00000002,
+	0x000003f5,0x000003f1,0x0003003e,0x000003f4,
+	0x000003f5,0x0003003e,0x000003f6,0x000003f7,
+	0x0003003e,0x000003f8,0x000002b2,0x00080039,
+	0x000000c6,0x000003f9,0x00000032,0x000003f2,
+	0x000003f4,0x000003f6,0x000003f8,0x0004003d,
+	0x00000088,0x000003fa,0x000003f2,0x0003003e,
+	0x000003ef,0x000003fa,0x0004003d,0x00000002,
+	0x000003fb,0x000003f4,0x0003003e,0x000003f1,
+	0x000003fb,0x0003003e,0x000003fc,0x000000a5,
+	0x000200f9,0x000003fd,0x000200f8,0x000003fd,
+	0x000400f6,0x00000401,0x00000400,0x00000000,
+	0x000200f9,0x000003fe,0x000200f8,0x000003fe,
+	0x0004003d,0x00000002,0x00000402,0x000003fc,
+	0x000500b0,0x0000003c,0x00000403,0x00000402,
+	0x00000074,0x000400fa,0x00000403,0x000003ff,
+	0x00000401,0x000200f8,0x000003ff,0x0004003d,
+	0x00000088,0x00000405,0x000003ef,0x0003003e,
+	0x00000404,0x00000405,0x0004003d,0x00000002,
+	0x00000407,0x000003f1,0x0003003e,0x00000406,
+	0x00000407,0x0004003d,0x00000002,0x00000409,
+	0x000003d8,0x0004003d,0x00000002,0x0000040a,
+	0x000003fc,0x00060041,0x00000049,0x0000040b,
+	0x0000031b,0x00000409,0x0000040a,0x0004003d,
+	0x00000002,0x0000040c,0x0000040b,0x0003003e,
+	0x00000408,0x0000040c,0x0003003e,0x0000040d,
+	0x000002b2,0x00080039,0x000000c6,0x0000040e,
+	0x00000032,0x00000404,0x00000406,0x00000408,
+	0x0000040d,0x0004003d,0x00000088,0x0000040f,
+	0x00000404,0x0003003e,0x000003ef,0x0000040f,
+	0x0004003d,0x00000002,0x00000410,0x00000406,
+	0x0003003e,0x000003f1,0x00000410,0x0004003d,
+	0x00000088,0x00000412,0x000003ef,0x0003003e,
+	0x00000411,0x00000412,0x0004003d,0x00000002,
+	0x00000414,0x000003f1,0x0003003e,0x00000413,
+	0x00000414,0x0004003d,0x00000002,0x00000416,
+	0x000003d8,0x00050082,0x00000002,0x00000417,
+	0x00000067,0x00000416,0x0004003d,0x00000002,
+	0x00000418,0x000003fc,0x00060041,0x00000049,
+	0x00000419,0x0000031b,0x00000417,0x00000418,
+	0x0004003d,0x00000002,0x0000041a,0x00000419,
+	0x0003003e,0x00000415,0x0000041a,0x0003003e,
+	0x0000041b,0x000002b2,0x00080039,0x000000c6,
+	0x0000041c,0x00000032,0x00000411,0x00000413,
+	0x00000415,0x0000041b,0x0004003d,0x00000088,
+	0x0000041d,0x00000411,0x0003003e,0x000003ef,
+	0x0000041d,0x0004003d,0x00000002,0x0000041e,
+	0x00000413,0x0003003e,0x000003f1,0x0000041e,
+	0x000200f9,0x00000400,0x000200f8,0x00000400,
+	0x0004003d,0x00000002,0x0000041f,0x000003fc,
+	0x00050080,0x00000002,0x00000420,0x0000041f,
+	0x00000067,0x0003003e,0x000003fc,0x00000420,
+	0x000200f9,0x000003fd,0x000200f8,0x00000401,
+	0x0004003d,0x00000088,0x00000422,0x000003ef,
+	0x0003003e,0x00000421,0x00000422,0x0004003d,
+	0x00000002,0x00000424,0x000003f1,0x0003003e,
+	0x00000423,0x00000424,0x0004003d,0x00000002,
+	0x00000426,0x000003d8,0x00050041,0x00000049,
+	0x00000427,0x0000031e,0x00000426,0x0004003d,
+	0x00000002,0x00000428,0x00000427,0x0003003e,
+	0x00000425,0x00000428,0x0003003e,0x00000429,
+	0x00000067,0x00080039,0x000000c6,0x0000042a,
+	0x00000032,0x00000421,0x00000423,0x00000425,
+	0x00000429,0x0004003d,0x00000088,0x0000042b,
+	0x00000421,0x0003003e,0x000003ef,0x0000042b,
+	0x0004003d,0x00000002,0x0000042c,0x00000423,
+	0x0003003e,0x000003f1,0x0000042c,0x0004003d,
+	0x00000088,0x0000042e,0x000003ef,0x0003003e,
+	0x0000042d,0x0000042e,0x0004003d,0x00000002,
+	0x00000430,0x000003f1,0x0003003e,0x0000042f,
+	0x00000430,0x0004003d,0x00000002,0x00000432,
+	0x000003d8,0x00050082,0x00000002,0x00000433,
+	0x00000067,0x00000432,0x00050041,0x00000049,
+	0x00000434,0x0000031e,0x00000433,0x0004003d,
+	0x00000002,0x00000435,0x00000434,0x0003003e,
+	0x00000431,0x00000435,0x0003003e,0x00000436,
+	0x00000067,0x00080039,0x000000c6,0x00000437,
+	0x00000032,0x0000042d,0x0000042f,0x00000431,
+	0x00000436,0x0004003d,0x00000088,0x00000438,
+	0x0000042d,0x0003003e,0x000003ef,0x00000438,
+	0x0004003d,0x00000002,0x00000439,0x0000042f,
+	0x0003003e,0x000003f1,0x00000439,0x0004003d,
+	0x00000088,0x0000043b,0x000003ef,0x0003003e,
+	0x0000043a,0x0000043b,0x0004003d,0x00000002,
+	0x0000043d,0x000003f1,0x0003003e,0x0000043c,
+	0x0000043d,0x00050041,0x00000049,0x0000043f,
+	0x0000037e,0x0000005d,0x0004003d,0x00000002,
+	0x00000440,0x0000043f,0x0003003e,0x0000043e,
+	0x00000440,0x0003003e,0x00000441,0x00000056,
+	0x00080039,0x000000c6,0x00000442,0x00000032,
+	0x0000043a,0x0000043c,0x0000043e,0x00000441,
+	0x0004003d,0x00000088,0x00000443,0x0000043a,
+	0x0003003e,0x000003ef,0x00000443,0x0004003d,
+	0x00000002,0x00000444,0x0000043c,0x0003003e,
+	0x000003f1,0x00000444,0x0003003e,0x00000445,
+	0x00000067,0x000200f9,0x00000446,0x000200f8,
+	0x00000446,0x000400f6,0x0000044a,0x00000449,
+	0x00000000,0x000200f9,0x00000447,0x000200f8,
+	0x00000447,0x0004003d,0x00000002,0x0000044b,
+	0x00000445,0x000500b0,0x0000003c,0x0000044c,
+	0x0000044b,0x0000001f,0x000400fa,0x0000044c,
+	0x00000448,0x0000044a,0x000200f8,0x00000448,
+	0x0004003d,0x00000088,0x0000044e,0x000003ef,
+	0x0003003e,0x0000044d,0x0000044e,0x0004003d,
+	0x00000002,0x00000450,0x000003f1,0x0003003e,
+	0x0000044f,0x00000450,0x0004003d,0x00000002,
+	0x00000452,0x00000445,0x00050041,0x00000049,
+	0x00000453,0x0000037e,0x00000452,0x0004003d,
+	0x00000002,0x00000454,0x00000453,0x0003003e,
+	0x00000451,0x00000454,0x0003003e,0x00000455,
+	0x00000074,0x00080039,0x000000c6,0x00000456,
+	0x00000032,0x0000044d,0x0000044f,0x00000451,
+	0x00000455,0x0004003d,0x00000088,0x00000457,
+	0x0000044d,0x0003003e,0x000003ef,0x00000457,
+	0x0004003d,0x00000002,0x00000458,0x0000044f,
+	0x0003003e,0x000003f1,0x00000458,0x000200f9,
+	0x00000449,0x000200f8,0x00000449,0x0004003d,
+	0x00000002,0x00000459,0x00000445,0x00050080,
+	0x00000002,0x0000045a,0x00000459,0x00000067,
+	0x0003003e,0x00000445,0x0000045a,0x000200f9,
+	0x00000446,0x000200f8,0x0000044a,0x0004003d,
+	0x00000088,0x0000045b,0x000003ef,0x000200fe,
+	0x0000045b,0x00010038,0x00050036,0x000000c6,
+	0x00000034,0x00000000,0x0000045c,0x000200f8,
+	0x0000045d,0x0004003b,0x0000028a,0x0000045e,
+	0x00000007,0x0004003b,0x00000049,0x0000046e,
+	0x00000007,0x0004003b,0x00000049,0x00000476,
+	0x00000007,0x0004003b,0x00000049,0x00000481,
+	0x00000007,0x0004003b,0x00000049,0x0000048d,
+	0x00000007,0x0004003b,0x00000049,0x00000498,
+	0x00000007,0x0004003b,0x0000028a,0x000004a5,
+	0x00000007,0x0004003b,0x00000049,0x000004a6,
+	0x00000007,0x0004003b,0x000002e3,0x000004b6,
+	0x00000007,0x0004003b,0x00000049,0x000004bc,
+	0x00000007,0x0004003b,0x000002e3,0x000004c1,
+	0x00000007,0x0004003b,0x00000049,0x000004c2,
+	0x00000007,0x0004003d,0x00000029,0x0000045f,
+	0x00000028,0x0007004f,0x000001e8,0x00000460,
+	0x0000045f,0x0000045f,0x00000000,0x00000001,
+	0x0003003e,0x0000045e,0x00000460,0x00050041,
+	0x00000049,0x00000461,0x0000045e,0x0000005d,
+	0x0004003d,0x00000002,0x00000462,0x00000461,
+	0x00050041,0x00000051,0x00000463,0x0000000c,
+	0x000000b8,0x0004003d,0x00000002,0x00000464,
+	0x00000463,0x000500ae,0x0000003c,0x00000465,
+	0x00000462,0x00000464,0x00050041,0x00000049,
+	0x00000466,0x0000045e,0x000000b3,0x0004003d,
+	0x00000002,0x00000467,0x00000466,0x00050041,
+	0x00000051,0x00000468,0x0000000c,0x00000127,
+	0x0004003d,0x00000002,0x00000469,0x00000468,
+	0x000500ae,0x0000003c,0x0000046a,0x00000467,
+	0x00000469,0x000500a6,0x0000003c,0x0000046b,
+	0x00000465,0x0000046a,0x000300f7,0x0000046c,
+	0x00000000,0x000400fa,0x0000046b,0x0000046d,
+	0x0000046c,0x000200f8,0x0000046d,0x000100fd,
+	0x000200f8,0x0000046c,0x0003003e,0x0000046e,
+	0x000000a5,0x000200f9,0x0000046f,0x000200f8,
+	0x0000046f,0x000400f6,0x00000473,0x00000472,
+	0x00000000,0x000200f9,0x00000470,0x000200f8,
+	0x00000470,0x0004003d,0x00000002,0x00000474,
+	0x0000046e,0x000500b0,0x0000003c,0x00000475,
+	0x00000474,0x0000001f,0x000400fa,0x00000475,
+	0x00000471,0x00000473,0x000200f8,0x00000471,
+	0x00050041,0x00000049,0x00000477,0x0000045e,
+	0x0000005d,0x0004003d,0x00000002,0x00000478,
+	0x00000477,0x00050084,0x00000002,0x00000479,
+	0x00000478,0x00000074,0x0004003d,0x00000002,
+	0x0000047a,0x0000046e,0x000500c7,0x00000002,
+	0x0000047b,0x0000047a,0x00000056,0x00050080,
+	0x00000002,0x0000047c,0x00000479,0x0000047b,
+	0x00050041,0x00000051,0x0000047d,0x0000000c,
+	0x0000005d,0x0004003d,0x00000002,0x0000047e,
+	0x0000047d,0x00050082,0x00000002,0x0000047f,
+	0x0000047e,0x00000067,0x0007000c,0x00000002,
+	0x00000480,0x00000001,0x00000026,0x0000047c,
+	0x0000047f,0x0003003e,0x00000476,0x00000480,
+	0x00050041,0x00000049,0x00000482,0x0000045e,
+	0x000000b3,0x0004003d,0x00000002,0x00000483,
+	0x00000482,0x00050084,0x00000002,0x00000484,
+	0x00000483,0x00000074,0x0004003d,0x00000002,
+	0x00000485,0x0000046e,0x000500c2,0x00000002,
+	0x00000486,0x00000485,0x00000058,0x00050080,
+	0x00000002,0x00000487,0x00000484,0x00000486,
+	0x00050041,0x00000051,0x00000488,0x0000000c,
+	0x000000b3,0x0004003d,0x00000002,0x00000489,
+	0x00000488,0x00050082,0x00000002,0x0000048a,
+	0x00000489,0x00000067,0x0007000c,0x00000002,
+	0x0000048b,0x00000001,0x00000026,0x00000487,
+	0x0000048a,0x0003003e,0x00000481,0x0000048b,
+	0x0004003d,0x00000002,0x0000048c,0x0000046e,
+	0x0004003d,0x00000002,0x0000048e,0x00000481,
+	0x00050041,0x00000051,0x0000048f,0x0000000c,
+	0x0000005d,0x0004003d,0x00000002,0x00000490,
+	0x0000048f,0x00050084,0x00000002,0x00000491,
+	0x0000048e,0x00000490,0x0004003d,0x00000002,
+	0x00000492,0x00000476,0x00050080,0x00000002,
+	0x00000493,0x00000491,0x00000492,0x0003003e,
+	0x0000048d,0x00000493,0x00050039,0x00000025,
+	0x00000494,0x0000002c,0x0000048d,0x00050041,
+	0x000000ce,0x00000495,0x00000024,0x0000048c,
+	0x0003003e,0x00000495,0x00000494,0x000200f9,
+	0x00000472,0x000200f8,0x00000472,0x0004003d,
+	0x00000002,0x00000496,0x0000046e,0x00050080,
+	0x00000002,0x00000497,0x00000496,0x00000067,
+	0x0003003e,0x0000046e,0x00000497,0x000200f9,
+	0x0000046f,0x000200f8,0x00000473,0x00050041,
+	0x00000049,0x00000499,0x0000045e,0x000000b3,
+	0x0004003d,0x00000002,0x0000049a,0x00000499,
+	0x00050041,0x00000051,0x0000049b,0x0000000c,
+	0x000000b8,0x0004003d,0x00000002,0x0000049c,
+	0x0000049b,0x00050084,0x00000002,0x0000049d,
+	0x0000049a,0x0000049c,0x00050041,0x00000049,
+	0x0000049e,0x0000045e,0x0000005d,0x0004003d,
+	0x00000002,0x0000049f,0x0000049e,0x00050080,
+	0x00000002,0x000004a0,0x0000049d,0x0000049f,
+	0x0003003e,0x00000498,0x000004a0,0x000500aa,
+	0x0000003c,0x000004a1,0x00000003,0x000000a5,
+	0x000300f7,0x000004a2,0x00000000,0x000400fa,
+	0x000004a1,0x000004a3,0x000004a4,0x000200f8,
+	0x000004a3,0x00050041,0x00000051,0x000004a8,
+	0x0000000c,0x000004a7,0x0004003d,0x00000002,
+	0x000004a9,0x000004a8,0x0003003e,0x000004a6,
+	0x000004a9,0x00050039,0x000001e8,0x000004aa,
+	0x00000030,0x000004a6,0x0003003e,0x000004a5,
+	0x000004aa,0x0004003d,0x00000002,0x000004ab,
+	0x00000498,0x00050084,0x00000002,0x000004ac,
+	0x000004ab,0x00000058,0x00050041,0x00000049,
+	0x000004ad,0x000004a5,0x0000005d,0x0004003d,
+	0x00000002,0x000004ae,0x000004ad,0x00060041,
+	0x00000061,0x000004af,0x00000009,0x0000005d,
+	0x000004ac,0x0003003e,0x000004af,0x000004ae,
+	0x0004003d,0x00000002,0x000004b0,0x00000498,
+	0x00050084,0x00000002,0x000004b1,0x000004b0,
+	0x00000058,0x00050080,0x00000002,0x000004b2,
+	0x000004b1,0x00000067,0x00050041,0x00000049,
+	0x000004b3,0x000004a5,0x000000b3,0x0004003d,
+	0x00000002,0x000004b4,0x000004b3,0x00060041,
+	0x00000061,0x000004b5,0x00000009,0x0000005d,
+	0x000004b2,0x0003003e,0x000004b5,0x000004b4,
+	0x000200f9,0x000004a2,0x000200f8,0x000004a4,
+	0x000500aa,0x0000003c,0x000004b7,0x00000003,
+	0x00000067,0x000300f7,0x000004b8,0x00000000,
+	0x000400fa,0x000004b7,0x000004b9,0x000004ba,
+	0x000200f8,0x000004b9,0x00040039,0x000001e8,
+	0x000004bb,0x00000031,0x00050041,0x00000051,
+	0x000004bd,0x0000000c,0x000004a7,0x0004003d,
+	0x00000002,0x000004be,0x000004bd,0x0003003e,
+	0x000004bc,0x000004be,0x00050039,0x000001e8,
+	0x000004bf,0x00000030,0x000004bc,0x00050050,
+	0x00000088,0x000004c0,0x000004bb,0x000004bf,
+	0x0003003e,0x000004c1,0x000004c0,0x000200f9,
+	0x000004b8,0x000200f8,0x000004ba,0x00050041,
+	0x00000051,0x000004c3,0x0000000c,0x000004a7,
+	0x0004003d,0x00000002,0x000004c4,0x000004c3,
+	0x0003003e,0x000004c2,0x000004c4,0x00050039,
+	0x00000088,0x000004c5,0x00000033,0x000004c2,
+	0x0003003e,0x000004c1,0x000004c5,0x000200f9,
+	0x000004b8,0x000200f8,0x000004b8,0x0004003d,
+	0x00000088,0x000004c6,0x000004c1,0x0003003e,
+	0x000004b6,0x000004c6,0x0004003d,0x00000002,
+	0x000004c7,0x00000498,0x00050084,0x00000002,
+	0x000004c8,0x000004c7,0x00000074,0x00050041,
+	0x00000049,0x000004c9,0x000004b6,0x0000005d,
+	0x0004003d,0x00000002,0x000004ca,0x000004c9,
+	0x00060041,0x00000061,0x000004cb,0x00000009,
+	0x0000005d,0x000004c8,0x0003003e,0x000004cb,
+	0x000004ca,0x0004003d,0x00000002,0x000004cc,
+	0x00000498,0x00050084,0x00000002,0x000004cd,
+	0x000004cc,0x00000074,0x00050080,0x00000002,
+	0x000004ce,0x000004cd,0x00000067,0x00050041,
+	0x00000049,0x000004cf,0x000004b6,0x000000b3,
+	0x0004003d,0x00000002,0x000004d0,0x000004cf,
+	0x00060041,0x00000061,0x000004d1,0x00000009,
+	0x0000005d,0x000004ce,0x0003003e,0x000004d1,
+	0x000004d0,0x0004003d,0x00000002,0x000004d2,
+	0x00000498,0x00050084,0x00000002,0x000004d3,
+	0x000004d2,0x00000074,0x00050080,0x00000002,
+	0x000004d4,0x000004d3,0x00000058,0x00050041,
+	0x00000049,0x000004d5,0x000004b6,0x000000b8,
+	0x0004003d,0x00000002,0x000004d6,0x000004d5,
+	0x00060041,0x00000061,0x000004d7,0x00000009,
+	0x0000005d,0x000004d4,0x0003003e,0x000004d7,
+	0x000004d6,0x0004003d,0x00000002,0x000004d8,
+	0x00000498,0x00050084,0x00000002,0x000004d9,
+	0x000004d8,0x00000074,0x00050080,0x00000002,
+	0x000004da,0x000004d9,0x00000056,0x00050041,
+	0x00000049,0x000004db,0x000004b6,0x00000127,
+	0x0004003d,0x00000002,0x000004dc,0x000004db,
+	0x00060041,0x00000061,0x000004dd,0x00000009,
+	0x0000005d,0x000004da,0x0003003e,0x000004dd,
+	0x000004dc,0x000200f9,0x000004a2,0x000200f8,
+	0x000004a2,0x000100fd,0x00010038
+};
+} // namespace Shader
+
+static VkPipeline CreateTrianglePipeline(VkDevice device, VkPipelineLayout pipelineLayout, VkRenderPass renderPass, VkPipelineCache pipelineCache)
+{
+    if (pipelineLayout == VK_NULL_HANDLE)
+        return VK_NULL_HANDLE;  
+    if (device == VK_NULL_HANDLE)
+        return VK_NULL_HANDLE;
+    if (renderPass == VK_NULL_HANDLE)
+        return VK_NULL_HANDLE;
+
+    bool success = true;
+    VkGraphicsPipelineCreateInfo pipelineCreateInfo = {};
+     
+    VkPipelineShaderStageCreateInfo shaderStages[2] = {};
+    shaderStages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    shaderStages[0].pName = "main";
+    shaderStages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    shaderStages[1].pName = "main";
+    
+    if (success)
+    {
+        VkShaderModuleCreateInfo moduleCreateInfo = {};
+        moduleCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        moduleCreateInfo.codeSize = sizeof(Shader::vertexShaderSpirv);
+        moduleCreateInfo.pCode = Shader::vertexShaderSpirv;
+        success = vkCreateShaderModule(device, &moduleCreateInfo, NULL, &shaderStages[0].module) == VK_SUCCESS;
+    }
+
+    if (success)
+    {
+        VkShaderModuleCreateInfo moduleCreateInfo = {};
+        moduleCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        moduleCreateInfo.codeSize = sizeof(Shader::fragmentShaderSpirv);
+        moduleCreateInfo.pCode = Shader::fragmentShaderSpirv;
+        success = vkCreateShaderModule(device, &moduleCreateInfo, NULL, &shaderStages[1].module) == VK_SUCCESS;
+    }
+
+    VkPipeline pipeline;
+    if (success)
+    {
+        pipelineCreateInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        pipelineCreateInfo.layout = pipelineLayout;
+        pipelineCreateInfo.renderPass = renderPass;
+
+        VkPipelineInputAssemblyStateCreateInfo inputAssemblyState = {};
+        inputAssemblyState.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
         inputAssemblyState.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
 
         VkPipelineRasterizationStateCreateInfo rasterizationState = {};
@@ -440,6 +5005,47 @@ static VkPipeline CreateTrianglePipeline(VkDevice device, VkPipelineLayout pipel
     return success ? pipeline : VK_NULL_HANDLE;
 }
 
+// Compute shaders of namespace Shader. They only access storage buffers: textures created by Unity may lack
+// VK_IMAGE_USAGE_STORAGE_BIT, so pixels are copied into a buffer and back out of it around the dispatch.
+enum ComputeShader
+{
+    kComputeConvert = 0,
+    kComputeGenerate = 1,
+    kComputeCompress = 2,   // followed by one pipeline per BCFormat
+    kComputeShaderCount = kComputeCompress + 3,
+};
+
+// Every compute shader reads storage buffer binding 0, writes binding 1 and takes up to this many bytes of push constants
+static const uint32_t kComputePushConstantBytes = 128;
+
+// Threads per workgroup along x and y, local_size_x and local_size_y of the compute shaders
+static const uint32_t kComputeGroupSize = 8;
+
+static VkPipeline CreateComputePipeline(VkDevice device, VkPipelineLayout pipelineLayout, const uint32_t* spirv, size_t spirvBytes, const VkSpecializationInfo* specialization)
+{
+    VkShaderModuleCreateInfo moduleCreateInfo = {};
+    moduleCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    moduleCreateInfo.codeSize = spirvBytes;
+    moduleCreateInfo.pCode = spirv;
+    VkShaderModule module;
+    if (vkCreateShaderModule(device, &moduleCreateInfo, NULL, &module) != VK_SUCCESS)
+        return VK_NULL_HANDLE;
+
+    VkComputePipelineCreateInfo pipelineCreateInfo = {};
+    pipelineCreateInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+    pipelineCreateInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    pipelineCreateInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipelineCreateInfo.stage.module = module;
+    pipelineCreateInfo.stage.pName = "main";
+    pipelineCreateInfo.stage.pSpecializationInfo = specialization;
+    pipelineCreateInfo.layout = pipelineLayout;
+
+    VkPipeline pipeline;
+    const bool success = vkCreateComputePipelines(device, VK_NULL_HANDLE, 1, &pipelineCreateInfo, NULL, &pipeline) == VK_SUCCESS;
+    vkDestroyShaderModule(device, module, NULL);
+    return success ? pipeline : VK_NULL_HANDLE;
+}
+
 class RenderAPI_Vulkan : public RenderAPI
 {
 public:
@@ -451,53 +5057,235 @@ public:
     virtual void* BeginModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int* outRowPitch);
     virtual void EndModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr);
     virtual void DoCopyTexture(void* sourceTexture, int sourceX, int sourceY, int sourceWidth, int sourceHeight, void* destinationTexture, int destinationX, int destinationY);
-    virtual bool CreateTexture(int width, int height, int format, int textureIndex);
+    virtual bool CreateTexture(int width, int height, int format, int mipCount, int textureIndex);
     virtual void DestroyTexture(int textureIndex);
     virtual void* GetTexturePointer(int textureIndex);
+    virtual void CreateTextures(const DGTextureDesc* descs, int* textureIndices, int count);
+    virtual void DestroyTextures(const int* textureIndices, int count);
+    virtual bool CreateTextureArray(int width, int height, int layers, int format, int textureIndex);
     virtual void SetTextureColor(float red, float green, float blue, float alpha, void* targetTexture);
+    virtual void SubmitCommands(const DGCommand* commands, int count);
+    virtual void GenerateMips(void* texture);
+    virtual void BlitTexture(void* sourceTexture, int sourceX, int sourceY, int sourceWidth, int sourceHeight, void* destinationTexture, int destinationX, int destinationY, int destinationWidth, int destinationHeight, int filter);
+    virtual int GetSupportedConvertOptions();
+    virtual bool SupportsCompressTexture() { return true; }
+    virtual bool SupportsGenerateTexture() { return true; }
+    virtual void GenerateTexture(void* texture, int layer, const DGGenerateParams& params);
+    virtual bool GetTextureSize(void* texture, int* outWidth, int* outHeight);
+    virtual bool RecordReadback(int ticket, void* texture, int x, int y, int width, int height);
+    virtual int PollReadback(int ticket, const void** outData);
+    virtual void ReleaseReadback(int ticket);
+    virtual bool UploadTexture(void* texture, int layer, int x, int y, int width, int height, const void* data, int dataRowPitch);
+    virtual bool UploadCompressedTexture(void* texture, int layer, int x, int y, int width, int height, const void* rgba, int rgbaRowPitch, int quality);
+    virtual int GetTextureBCFormat(void* texture);
+    virtual bool GetTextureBlockInfo(void* texture, int* outBlockBytes, int* outBlockWidth, int* outBlockHeight);
+    virtual void SetTexturePoolCapacity(int capacity);
+    virtual void TrimTexturePool(int maxPooled);
+    virtual void CollectGarbage();
 
 private:
     typedef std::vector<VulkanBuffer> VulkanBuffers;
-    typedef std::map<unsigned long long, VulkanBuffers> DeleteQueue;
+
+    // Image prepared for a transfer command
+    struct TransferImage
+    {
+        VkImage image;
+        VkImageLayout layout;
+        VkFormat format;
+        VkExtent3D extent;
+        uint32_t layers;
+        unsigned int plugin;    // slot in m_Images, kNoSlot for images owned by Unity
+    };
+
+    // Image prepared for mip generation, every level is in layout
+    struct MipChainImage
+    {
+        VkImage image;
+        VkImageLayout layout;
+        VkExtent3D extent;
+        uint32_t mipLevels;
+        VkFilter filter;
+    };
+
+    // Space reserved in m_UploadRing between AllocateUpload and RecordUpload
+    struct Upload
+    {
+        VkDeviceSize offset;
+        unsigned int allocation;
+        int size;
+    };
+
+    // Readback copied into m_ReadbackRing, or into a buffer of its own when the ring is full
+    struct Readback
+    {
+        VkDeviceSize offset;
+        unsigned int allocation;
+        VulkanBuffer dedicated;
+        unsigned long long frameNumber;
+        int size;
+    };
+
+    // Destroyed texture waiting for the GPU, recycled ones go back into m_TexturePool instead of being destroyed
+    struct RetiredImage
+    {
+        unsigned int slot;
+        bool recycle;
+    };
+
+    // Everything retired while the GPU was recording one frame
+    struct RetiredFrame
+    {
+        unsigned long long frameNumber;
+        VulkanBuffers buffers;
+        std::vector<RetiredImage> images;
+        std::vector<VkDescriptorPool> descriptorPools;
+    };
 
 private:
-    bool CreateVulkanBuffer(size_t bytes, VulkanBuffer* buffer, VkBufferUsageFlags usage);
-    bool CreateVulkanImage(int width, int height, int format, VkImageUsageFlags usage, UnityVulkanImage* outImage);
+    bool CreateVulkanBuffer(size_t bytes, VulkanBuffer* buffer, VkBufferUsageFlags usage, VkMemoryPropertyFlags preferredFlags = 0);
+    bool CreateVulkanImage(int width, int height, int format, int mipLevels, int arrayLayers, VkImageUsageFlags usage, UnityVulkanImage* outImage, DeviceMemoryBlock* outMemory);
+    void CreatePluginImages(const DGTextureDesc* descs, int arrayLayers, int* textureIndices, int count);
     void ImmediateDestroyVulkanBuffer(const VulkanBuffer& buffer);
     void SafeDestroy(unsigned long long frameNumber, const VulkanBuffer& buffer);
+    RetiredFrame& RetireFrame(unsigned long long frameNumber);
     void GarbageCollect(bool force = false);
+    void RecordCopyTexture(void* sourceTexture, int sourceLayer, void* destinationTexture, int destinationLayer, const DGCopyRegion* regions, int count);
+    void RecordClearTexture(float red, float green, float blue, float alpha, void* targetTexture, int layer);
+    void RecordClearImage(float red, float green, float blue, float alpha, void* targetTexture, const TransferImage& targetImage, int layer, const DGRect* rects, int count);
+    void RecordClearTextures(const DGCommand* commands, int count);
+    void RecordGenerateMips(void* const* textures, int count);
+    bool AccessMipChainImage(void* texture, VkCommandBuffer commandBuffer, MipChainImage* outImage);
+    void RecordBlitTexture(void* sourceTexture, int sourceLayer, const VkRect2D& sourceRect, void* destinationTexture, int destinationLayer, const VkRect2D& destinationRect, int filter);
+    void RecordResampleTexture(const TransferImage& source, int sourceLayer, const VkRect2D& sourceRect, const TransferImage& destination, int destinationLayer, const VkRect2D& destinationRect, const UnityVulkanRecordingState& recordingState);
+    void RecordConvertTexture(const DGCommand& command);
+    bool CreateScratchImage(int width, int height, VkFormat format, const UnityVulkanRecordingState& recordingState, VkImage* outImage);
+    bool RecordComputeConvert(const DGCommand& command, const TransferImage& source, const TransferImage& destination);
+    void RecordCompressTexture(const DGCommand& command);
+    bool CreateComputeBuffer(VkDeviceSize size, const UnityVulkanRecordingState& recordingState, VkBuffer* outBuffer);
+    VkDeviceSize GetComputeOutputOffset(VkDeviceSize inputSize);
+    VkPipeline GetComputePipeline(int shader);
+    VkDescriptorSet AllocateComputeSet(const UnityVulkanRecordingState& recordingState);
+    bool RecordComputeDispatch(int shader, VkBuffer buffer, VkDeviceSize inputOffset, VkDeviceSize inputSize, VkDeviceSize outputOffset, VkDeviceSize outputSize, const void* constants, uint32_t constantBytes, uint32_t width, uint32_t height, const UnityVulkanRecordingState& recordingState);
+    VkFormatFeatureFlags GetFormatFeatures(VkFormat format);
+    unsigned int FindPluginImage(void* texture);
+    bool AccessTransferImage(void* texture, bool write, TransferImage* outImage);
+    void SyncTransferHazards(VkCommandBuffer commandBuffer, unsigned int read, unsigned int write);
+    bool GetTextureFormat(void* texture, VkFormat* outFormat);
+    void DestroyPluginImage(unsigned int slot);
+    void* AllocateUpload(void* texture, int width, int height, int* outRowPitch);
+    bool RecordUpload(void* texture, int layer, int x, int y, int width, int height, int rowPitch, void* dataPtr);
+    bool RecordUploadRects(void* texture, int layer, const VkRect2D* rects, int count, int rowPitch, void* dataPtr, int bandHeight);
+    void RecordClearBlocks(const float* color, void* targetTexture, const TransferImage& targetImage, int layer);
 
 private:
     IUnityGraphicsVulkan* m_UnityVulkan;
     UnityVulkanInstance m_Instance;
-    VulkanBuffer m_TextureStagingBuffer;
+    VkPhysicalDeviceProperties m_DeviceProperties;
+    DeviceMemoryAllocator m_MemoryAllocator;
     VulkanBuffer m_VertexStagingBuffer;
     UnityVulkanImage m_UnityImage;
-    std::map<unsigned long long, VulkanBuffers> m_DeleteQueue;
+
+    // Frames of retired resources in increasing frame number order. Used as a ring so the slots and their vectors are
+    // reused instead of allocating every frame. Uploads may retire staging buffers from the main thread.
+    std::mutex m_RetiredFramesMutex;
+    std::vector<RetiredFrame> m_RetiredFrames;
+    size_t m_RetiredFrameHead;
+    size_t m_RetiredFrameCount;
+
     VkPipelineLayout m_TrianglePipelineLayout;
     VkPipeline m_TrianglePipeline;
     VkRenderPass m_TrianglePipelineRenderPass;
 
-    int m_UsedTextureCount;
-    std::vector<UnityVulkanImage*> m_Textures;
-};
+    // Compute pipelines, created on first use, and their shared layouts
+    VkDescriptorSetLayout m_ComputeSetLayout;
+    VkPipelineLayout m_ComputePipelineLayout;
+    VkPipeline m_ComputePipelines[kComputeShaderCount];
 
+    // Descriptor sets of the dispatches are allocated from m_DescriptorPool until it runs out. A full pool is retired with
+    // the frame and reset once the GPU finished it, m_FreeDescriptorPools keeps the reset ones for reuse.
+    VkDescriptorPool m_DescriptorPool;
+    std::vector<VkDescriptorPool> m_FreeDescriptorPools;   // guarded by m_RetiredFramesMutex
 
-RenderAPI* CreateRenderAPI_Vulkan()
-{
-    return new RenderAPI_Vulkan();
-}
+    // Images created by this plugin. These stay in VK_IMAGE_LAYOUT_GENERAL for transfers so the plugin can track
+    // hazards itself instead of asking Unity for a barrier on every access.
+    PluginImageTable m_Images;
+
+    // Slot in m_Images of every texture index, kNoSlot for unused indices. Textures are created, destroyed and looked
+    // up from any thread.
+    TextureIndexMap<unsigned int> m_Textures;
+
+    // Textures are created on any thread while transfers are recorded on the render thread
+    std::mutex m_PluginImagesMutex;
+    std::unordered_map<VkImage, unsigned int> m_PluginImages;
+    std::vector<unsigned int> m_PendingTransferImages;
+    unsigned long long m_TransferBatch;
+
+    // Destroyed textures waiting to be handed out again by CreateTexture, oldest first. Pooled images stay registered
+    // in m_PluginImages so their tracked state carries over to the next owner.
+    std::mutex m_TexturePoolMutex;      // guards m_TexturePool, m_TexturePoolCapacity and m_DestroyedTextures
+    std::deque<unsigned int> m_TexturePool;
+    int m_TexturePoolCapacity;
+
+    // Textures destroyed since the last flush event and, render thread only, those destroyed before it. Textures are retired
+    // one flush event late so every command queued before DestroyTexture has been recorded by then.
+    std::vector<RetiredImage> m_DestroyedTextures;
+    std::vector<RetiredImage> m_RetiringTextures;
+
+    StagingRing m_UploadRing;
+    std::unordered_map<void*, Upload> m_Uploads;
+    StagingRing m_ReadbackRing;
+    std::unordered_map<int, Readback> m_Readbacks;
+
+    // Scratch storage reused between calls so recording copies does not allocate every frame
+    std::vector<VkImageCopy> m_CopyRegions;
+    std::vector<DGCopyRegion> m_CommandRegions;
+    std::vector<void*> m_MipTextures;
+    std::vector<MipChainImage> m_MipChainImages;
+    std::vector<VkRect2D> m_ClearRects;
+    std::vector<DGRect> m_ClearCommandRects;
+    std::vector<TransferImage> m_ClearImages;
+    std::vector<VkBufferImageCopy> m_UploadRegions;
+
+    // Scratch image the rectangle clears of a format share within a frame. It is retired with the frame it was created in,
+    // a clear in a later frame or one needing a larger image creates a new one.
+    struct ClearScratch
+    {
+        VkImage image;
+        unsigned long long frameNumber;
+        uint32_t width;
+        uint32_t height;
+    };
+    std::unordered_map<int, ClearScratch> m_ClearScratch;
+
+    // Format features of optimal tiling images, looked up once per format on the render thread
+    std::unordered_map<int, VkFormatFeatureFlags> m_FormatFeatures;
+};
+
+
+RenderAPI* CreateRenderAPI_Vulkan()
+{
+    return new RenderAPI_Vulkan();
+}
 
 RenderAPI_Vulkan::RenderAPI_Vulkan()
     : m_UnityVulkan(NULL)
-    , m_TextureStagingBuffer()
+    , m_DeviceProperties()
     , m_VertexStagingBuffer()
     , m_UnityImage()
     , m_TrianglePipelineLayout(VK_NULL_HANDLE)
     , m_TrianglePipeline(VK_NULL_HANDLE)
     , m_TrianglePipelineRenderPass(VK_NULL_HANDLE)
-    , m_UsedTextureCount(0)
+    , m_ComputeSetLayout(VK_NULL_HANDLE)
+    , m_ComputePipelineLayout(VK_NULL_HANDLE)
+    , m_DescriptorPool(VK_NULL_HANDLE)
+    , m_Textures(PluginImageTable::kNoSlot)
+    , m_TransferBatch(0)
+    , m_TexturePoolCapacity(kDefaultTexturePoolCapacity)
+    , m_RetiredFrameHead(0)
+    , m_RetiredFrameCount(0)
 {
+    for (int i = 0; i < kComputeShaderCount; ++i)
+        m_ComputePipelines[i] = VK_NULL_HANDLE;
 }
 
 void RenderAPI_Vulkan::ProcessDeviceEvent(UnityGfxDeviceEventType type, IUnityInterfaces* interfaces)
@@ -511,11 +5299,21 @@ void RenderAPI_Vulkan::ProcessDeviceEvent(UnityGfxDeviceEventType type, IUnityIn
         // Make sure Vulkan API functions are loaded
         LoadVulkanAPI(m_Instance.getInstanceProcAddr, m_Instance.instance);
 
+        // These don't change for the lifetime of the device, query them once instead of for every buffer and image
+        {
+            VkPhysicalDeviceMemoryProperties memoryProperties;
+            vkGetPhysicalDeviceMemoryProperties(m_Instance.physicalDevice, &memoryProperties);
+            vkGetPhysicalDeviceProperties(m_Instance.physicalDevice, &m_DeviceProperties);
+            m_MemoryAllocator.Initialize(m_Instance.device, memoryProperties, m_DeviceProperties.limits.bufferImageGranularity);
+        }
+
+        // kDGRenderEventFlushCommands only records transfer commands, so Unity can end the render pass up front
+        // instead of every queued command doing it and there is no reason to wait for the previous frame.
         UnityVulkanPluginEventConfig config_1;
         config_1.graphicsQueueAccess = kUnityVulkanGraphicsQueueAccess_DontCare;
-        config_1.renderPassPrecondition = kUnityVulkanRenderPass_EnsureInside;
-        config_1.flags = kUnityVulkanEventConfigFlag_EnsurePreviousFrameSubmission | kUnityVulkanEventConfigFlag_ModifiesCommandBuffersState;
-        m_UnityVulkan->ConfigureEvent(1, &config_1);
+        config_1.renderPassPrecondition = kUnityVulkanRenderPass_EnsureOutside;
+        config_1.flags = kUnityVulkanEventConfigFlag_ModifiesCommandBuffersState;
+        m_UnityVulkan->ConfigureEvent(kDGRenderEventFlushCommands, &config_1);
 
         // alternative way to intercept API
         m_UnityVulkan->InterceptVulkanAPI("vkCmdBeginRenderPass", (PFN_vkVoidFunction)Hook_vkCmdBeginRenderPass);
@@ -524,7 +5322,6 @@ void RenderAPI_Vulkan::ProcessDeviceEvent(UnityGfxDeviceEventType type, IUnityIn
 
         if (m_Instance.device != VK_NULL_HANDLE)
         {
-            GarbageCollect(true);
             if (m_TrianglePipeline != VK_NULL_HANDLE)
             {
                 vkDestroyPipeline(m_Instance.device, m_TrianglePipeline, NULL);
@@ -536,16 +5333,63 @@ void RenderAPI_Vulkan::ProcessDeviceEvent(UnityGfxDeviceEventType type, IUnityIn
                 m_TrianglePipelineLayout = VK_NULL_HANDLE;
             }
 
-            for (int i = 0; i < m_UsedTextureCount; i++)
+            // The device is going away, every image still in the table goes no matter who owns it
+            GarbageCollect(true);
+
+            for (int i = 0; i < kComputeShaderCount; ++i)
+            {
+                if (m_ComputePipelines[i] != VK_NULL_HANDLE)
+                    vkDestroyPipeline(m_Instance.device, m_ComputePipelines[i], NULL);
+                m_ComputePipelines[i] = VK_NULL_HANDLE;
+            }
+            if (m_ComputePipelineLayout != VK_NULL_HANDLE)
             {
-                if (m_Textures[i] != nullptr)
+                vkDestroyPipelineLayout(m_Instance.device, m_ComputePipelineLayout, NULL);
+                m_ComputePipelineLayout = VK_NULL_HANDLE;
+            }
+            if (m_ComputeSetLayout != VK_NULL_HANDLE)
+            {
+                vkDestroyDescriptorSetLayout(m_Instance.device, m_ComputeSetLayout, NULL);
+                m_ComputeSetLayout = VK_NULL_HANDLE;
+            }
+            if (m_DescriptorPool != VK_NULL_HANDLE)
+            {
+                vkDestroyDescriptorPool(m_Instance.device, m_DescriptorPool, NULL);
+                m_DescriptorPool = VK_NULL_HANDLE;
+            }
+            for (size_t i = 0; i < m_FreeDescriptorPools.size(); ++i)
+                vkDestroyDescriptorPool(m_Instance.device, m_FreeDescriptorPools[i], NULL);
+            m_FreeDescriptorPools.clear();
+            const unsigned int slotCount = m_Images.SlotCount();
+            for (unsigned int slot = 0; slot < slotCount; ++slot)
+            {
+                if (m_Images.Image(slot) != VK_NULL_HANDLE)
                 {
-                    DestroyTexture(i);
+                    vkDestroyImage(m_Instance.device, m_Images.Image(slot), NULL);
+                    m_MemoryAllocator.Free(m_Images.Memory(slot));
                 }
             }
         }
 
-        m_UsedTextureCount = 0;
+        m_Images.Clear();
+        m_ClearScratch.clear();
+        m_Textures.Clear();
+        m_TexturePool.clear();
+        m_DestroyedTextures.clear();
+        m_RetiringTextures.clear();
+        m_PluginImages.clear();
+        m_PendingTransferImages.clear();
+        m_MemoryAllocator.Destroy();
+
+        for (std::unordered_map<int, Readback>::iterator it = m_Readbacks.begin(); it != m_Readbacks.end(); ++it)
+            ImmediateDestroyVulkanBuffer(it->second.dedicated);
+        m_Readbacks.clear();
+        ImmediateDestroyVulkanBuffer(m_ReadbackRing.Buffer());
+        m_ReadbackRing.Reset(VulkanBuffer());
+        ImmediateDestroyVulkanBuffer(m_UploadRing.Buffer());
+        m_UploadRing.Reset(VulkanBuffer());
+        m_Uploads.clear();
+
         m_UnityVulkan = NULL;
         m_TrianglePipelineRenderPass = VK_NULL_HANDLE;
         m_Instance = UnityVulkanInstance();
@@ -554,7 +5398,7 @@ void RenderAPI_Vulkan::ProcessDeviceEvent(UnityGfxDeviceEventType type, IUnityIn
     }
 }
 
-bool RenderAPI_Vulkan::CreateVulkanBuffer(size_t sizeInBytes, VulkanBuffer* buffer, VkBufferUsageFlags usage)
+bool RenderAPI_Vulkan::CreateVulkanBuffer(size_t sizeInBytes, VulkanBuffer* buffer, VkBufferUsageFlags usage, VkMemoryPropertyFlags preferredFlags /*= 0*/)
 {
     if (sizeInBytes == 0)
         return false;
@@ -574,13 +5418,14 @@ bool RenderAPI_Vulkan::CreateVulkanBuffer(size_t sizeInBytes, VulkanBuffer* buff
     if (vkCreateBuffer(m_Instance.device, &bufferCreateInfo, NULL, &buffer->buffer) != VK_SUCCESS)
         return false;
 
-    VkPhysicalDeviceMemoryProperties physicalDeviceProperties;
-    vkGetPhysicalDeviceMemoryProperties(m_Instance.physicalDevice, &physicalDeviceProperties);
+    const VkPhysicalDeviceMemoryProperties& physicalDeviceProperties = m_MemoryAllocator.MemoryProperties();
 
     VkMemoryRequirements memoryRequirements;
     vkGetBufferMemoryRequirements(m_Instance.device, buffer->buffer, &memoryRequirements);
 
-    const int memoryTypeIndex = FindMemoryTypeIndex(physicalDeviceProperties, memoryRequirements, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+    int memoryTypeIndex = FindMemoryTypeIndex(physicalDeviceProperties, memoryRequirements, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | preferredFlags);
+    if (memoryTypeIndex < 0)
+        memoryTypeIndex = FindMemoryTypeIndex(physicalDeviceProperties, memoryRequirements, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
     if (memoryTypeIndex < 0)
     {
         ImmediateDestroyVulkanBuffer(*buffer);
@@ -618,7 +5463,7 @@ bool RenderAPI_Vulkan::CreateVulkanBuffer(size_t sizeInBytes, VulkanBuffer* buff
     return true;
 }
 
-bool RenderAPI_Vulkan::CreateVulkanImage(int width, int height, int format, VkImageUsageFlags usage, UnityVulkanImage* outImage)
+bool RenderAPI_Vulkan::CreateVulkanImage(int width, int height, int format, int mipLevels, int arrayLayers, VkImageUsageFlags usage, UnityVulkanImage* outImage, DeviceMemoryBlock* outMemory)
 {
     VkImageCreateInfo imageInfo{};
     imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
@@ -626,11 +5471,11 @@ bool RenderAPI_Vulkan::CreateVulkanImage(int width, int height, int format, VkIm
     imageInfo.extent.width = width;
     imageInfo.extent.height = height;
     imageInfo.extent.depth = 1;
-    imageInfo.mipLevels = 1;
-    imageInfo.arrayLayers = 1;
+    imageInfo.mipLevels = (uint32_t)mipLevels;
+    imageInfo.arrayLayers = (uint32_t)arrayLayers;
     imageInfo.format = static_cast<VkFormat>(format);
     imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
-    imageInfo.initialLayout = VK_IMAGE_LAYOUT_GENERAL;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
     imageInfo.usage = usage;
     imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
     imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
@@ -650,50 +5495,41 @@ bool RenderAPI_Vulkan::CreateVulkanImage(int width, int height, int format, VkIm
     if (vkCreateImage(m_Instance.device, &imageInfo, NULL, &outImage->image) != VK_SUCCESS)
         return false;
 
-    VkPhysicalDeviceMemoryProperties physicalDeviceProperties;
-    vkGetPhysicalDeviceMemoryProperties(m_Instance.physicalDevice, &physicalDeviceProperties);
-
     VkMemoryRequirements memoryRequirements;
     vkGetImageMemoryRequirements(m_Instance.device, outImage->image, &memoryRequirements);
-    //vkGetBufferMemoryRequirements(m_Instance.device, buffer->buffer, &memoryRequirements);
-
-    const int memoryTypeIndex = FindMemoryTypeIndex(physicalDeviceProperties, memoryRequirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-    if (memoryTypeIndex < 0)
-    {
-        //ImmediateDestroyVulkanBuffer(*buffer);
-        return false;
-    }
-
-    VkMemoryAllocateInfo memoryAllocateInfo;
-    memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    memoryAllocateInfo.pNext = NULL;
-    memoryAllocateInfo.memoryTypeIndex = memoryTypeIndex;
-    memoryAllocateInfo.allocationSize = memoryRequirements.size;
-
-    if (vkAllocateMemory(m_Instance.device, &memoryAllocateInfo, NULL, &outImage->memory.memory) != VK_SUCCESS)
-    {
-        //ImmediateDestroyVulkanBuffer(*buffer);
-        return false;
-    }
 
-    /*
-    if (vkMapMemory(m_Instance.device, outImage->memory.memory, 0, VK_WHOLE_SIZE, 0, &outImage->memory.mapped) != VK_SUCCESS)
+    if (!m_MemoryAllocator.Allocate(memoryRequirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, outMemory))
     {
-        //ImmediateDestroyVulkanBuffer(*buffer);
+        vkDestroyImage(m_Instance.device, outImage->image, NULL);
+        *outImage = UnityVulkanImage();
         return false;
     }
-    */
 
-    //if (vkBindBufferMemory(m_Instance.device, buffer->buffer, buffer->deviceMemory, 0) != VK_SUCCESS)
-    if (vkBindImageMemory(m_Instance.device, outImage->image, outImage->memory.memory, 0) != VK_SUCCESS)
+    if (vkBindImageMemory(m_Instance.device, outImage->image, outMemory->memory, outMemory->offset) != VK_SUCCESS)
     {
-        //ImmediateDestroyVulkanBuffer(*buffer);
+        vkDestroyImage(m_Instance.device, outImage->image, NULL);
+        m_MemoryAllocator.Free(*outMemory);
+        *outImage = UnityVulkanImage();
+        *outMemory = DeviceMemoryBlock();
         return false;
     }
 
-    //outImage->memory.size = sizeInBytes;
-    outImage->memory.flags = physicalDeviceProperties.memoryTypes[memoryTypeIndex].propertyFlags;
-    outImage->memory.size = memoryAllocateInfo.allocationSize;
+    const int memoryTypeIndex = FindMemoryTypeIndex(m_MemoryAllocator.MemoryProperties(), memoryRequirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    outImage->memory.memory = outMemory->memory;
+    outImage->memory.offset = outMemory->offset;
+    outImage->memory.size = memoryRequirements.size;
+    outImage->memory.memoryTypeIndex = memoryTypeIndex;
+    outImage->memory.flags = m_MemoryAllocator.MemoryProperties().memoryTypes[memoryTypeIndex].propertyFlags;
+    outImage->layout = imageInfo.initialLayout;
+    outImage->aspect = VK_IMAGE_ASPECT_COLOR_BIT;
+    outImage->usage = imageInfo.usage;
+    outImage->format = imageInfo.format;
+    outImage->extent = imageInfo.extent;
+    outImage->tiling = imageInfo.tiling;
+    outImage->type = imageInfo.imageType;
+    outImage->samples = imageInfo.samples;
+    outImage->layers = imageInfo.arrayLayers;
+    outImage->mipCount = imageInfo.mipLevels;
 
     return true;
 }
@@ -725,7 +5561,32 @@ void RenderAPI_Vulkan::ImmediateDestroyVulkanImage(const VkImage& image)
 
 void RenderAPI_Vulkan::SafeDestroy(unsigned long long frameNumber, const VulkanBuffer& buffer)
 {
-    m_DeleteQueue[frameNumber].push_back(buffer);
+    std::lock_guard<std::mutex> lock(m_RetiredFramesMutex);
+    RetireFrame(frameNumber).buffers.push_back(buffer);
+}
+
+// Slot of the ring collecting resources retired in frameNumber, m_RetiredFramesMutex must be held.
+RenderAPI_Vulkan::RetiredFrame& RenderAPI_Vulkan::RetireFrame(unsigned long long frameNumber)
+{
+    // Frame numbers only grow, an older one joins the newest slot which is released later and therefore still safe
+    if (m_RetiredFrameCount > 0)
+    {
+        RetiredFrame& newest = m_RetiredFrames[(m_RetiredFrameHead + m_RetiredFrameCount - 1) % m_RetiredFrames.size()];
+        if (newest.frameNumber >= frameNumber)
+            return newest;
+    }
+
+    if (m_RetiredFrameCount == m_RetiredFrames.size())
+    {
+        std::rotate(m_RetiredFrames.begin(), m_RetiredFrames.begin() + m_RetiredFrameHead, m_RetiredFrames.end());
+        m_RetiredFrames.resize(m_RetiredFrames.empty() ? 4 : m_RetiredFrames.size() * 2);
+        m_RetiredFrameHead = 0;
+    }
+
+    RetiredFrame& frame = m_RetiredFrames[(m_RetiredFrameHead + m_RetiredFrameCount) % m_RetiredFrames.size()];
+    frame.frameNumber = frameNumber;
+    m_RetiredFrameCount++;
+    return frame;
 }
 
 void RenderAPI_Vulkan::GarbageCollect(bool force /*= false*/)
@@ -737,151 +5598,523 @@ void RenderAPI_Vulkan::GarbageCollect(bool force /*= false*/)
         if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
             return;
 
-    DeleteQueue::iterator it = m_DeleteQueue.begin();
-    while (it != m_DeleteQueue.end())
+    std::lock_guard<std::mutex> lock(m_RetiredFramesMutex);
+    while (m_RetiredFrameCount > 0)
     {
-        if (it->first <= recordingState.safeFrameNumber)
+        RetiredFrame& frame = m_RetiredFrames[m_RetiredFrameHead];
+        if (frame.frameNumber > recordingState.safeFrameNumber)
+            break;
+
+        for (size_t i = 0; i < frame.buffers.size(); ++i)
+            ImmediateDestroyVulkanBuffer(frame.buffers[i]);
+        for (size_t i = 0; i < frame.images.size(); ++i)
+        {
+            const RetiredImage& retired = frame.images[i];
+            if (!force && retired.recycle)
+            {
+                std::lock_guard<std::mutex> poolLock(m_TexturePoolMutex);
+                if ((int)m_TexturePool.size() < m_TexturePoolCapacity)
+                {
+                    m_TexturePool.push_back(retired.slot);
+                    continue;
+                }
+            }
+            DestroyPluginImage(retired.slot);
+        }
+        for (size_t i = 0; i < frame.descriptorPools.size(); ++i)
         {
-            for (size_t i = 0; i < it->second.size(); ++i)
-                ImmediateDestroyVulkanBuffer(it->second[i]);
-            m_DeleteQueue.erase(it++);
+            if (force)
+            {
+                vkDestroyDescriptorPool(m_Instance.device, frame.descriptorPools[i], NULL);
+                continue;
+            }
+            vkResetDescriptorPool(m_Instance.device, frame.descriptorPools[i], 0);
+            m_FreeDescriptorPools.push_back(frame.descriptorPools[i]);
         }
-        else
-            ++it;
+        frame.buffers.clear();
+        frame.images.clear();
+        frame.descriptorPools.clear();
+
+        m_RetiredFrameHead = (m_RetiredFrameHead + 1) % m_RetiredFrames.size();
+        m_RetiredFrameCount--;
     }
 }
 
-void* RenderAPI_Vulkan::BeginModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int* outRowPitch)
+void RenderAPI_Vulkan::CollectGarbage()
 {
-    *outRowPitch = textureWidth * 4;
-    const size_t stagingBufferSizeRequirements = *outRowPitch * textureHeight;
-
     UnityVulkanRecordingState recordingState;
     if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
-        return NULL;
+        return;
+
+    // Textures destroyed before the previous flush event. Commands queued before they were destroyed have been recorded
+    // by now, so the current frame is the last one that can use them.
+    if (!m_RetiringTextures.empty())
+    {
+        std::lock_guard<std::mutex> lock(m_RetiredFramesMutex);
+        std::vector<RetiredImage>& images = RetireFrame(recordingState.currentFrameNumber).images;
+        images.insert(images.end(), m_RetiringTextures.begin(), m_RetiringTextures.end());
+        m_RetiringTextures.clear();
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_TexturePoolMutex);
+        m_RetiringTextures.swap(m_DestroyedTextures);
+    }
 
-    SafeDestroy(recordingState.currentFrameNumber, m_TextureStagingBuffer);
-    //m_TextureStagingBuffer = VulkanBuffer();
-    //if (!CreateVulkanBuffer(stagingBufferSizeRequirements, &m_TextureStagingBuffer, VK_BUFFER_USAGE_TRANSFER_SRC_BIT))
-    //    return NULL;
+    GarbageCollect();
+}
 
-    return m_TextureStagingBuffer.mapped;
+void* RenderAPI_Vulkan::BeginModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int* outRowPitch)
+{
+    return AllocateUpload(textureHandle, textureWidth, textureHeight, outRowPitch);
 }
 
 void RenderAPI_Vulkan::EndModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr)
 {
-    return;
-    // cannot do resource uploads inside renderpass
-    m_UnityVulkan->EnsureOutsideRenderPass();
+    RecordUpload(textureHandle, 0, 0, 0, textureWidth, textureHeight, rowPitch, dataPtr);
+}
 
-    UnityVulkanImage image;
-    if (!m_UnityVulkan->AccessTexture(textureHandle, UnityVulkanWholeImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-        VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT, kUnityVulkanResourceAccess_PipelineBarrier, &image))
-        return;
+unsigned int RenderAPI_Vulkan::FindPluginImage(void* texture)
+{
+    std::lock_guard<std::mutex> lock(m_PluginImagesMutex);
+    std::unordered_map<VkImage, unsigned int>::iterator it = m_PluginImages.find(*(VkImage*)texture);
+    return it != m_PluginImages.end() ? it->second : PluginImageTable::kNoSlot;
+}
 
-    UnityVulkanRecordingState recordingState;
-    if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
-        return;
+// Images owned by Unity go through AccessTexture every time so Unity keeps track of them. Plugin images only do so
+// when Unity changed their layout since the plugin last used them, otherwise SyncTransferHazards orders the accesses.
+bool RenderAPI_Vulkan::AccessTransferImage(void* texture, bool write, TransferImage* outImage)
+{
+    const unsigned int plugin = FindPluginImage(texture);
+    if (plugin == PluginImageTable::kNoSlot)
+    {
+        const VkImageLayout layout = write ? VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL : VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        UnityVulkanImage image;
+        if (!m_UnityVulkan->AccessTexture(texture, UnityVulkanWholeImage, layout, VK_PIPELINE_STAGE_TRANSFER_BIT, write ? VK_ACCESS_TRANSFER_WRITE_BIT : VK_ACCESS_TRANSFER_READ_BIT, kUnityVulkanResourceAccess_PipelineBarrier, &image))
+            return false;
 
-    VkBufferImageCopy region;
-    region.bufferImageHeight = 0;
-    region.bufferRowLength = 0;
-    region.bufferOffset = 0;
-    region.imageOffset.x = 0;
-    region.imageOffset.y = 0;
-    region.imageOffset.z = 0;
-    region.imageExtent.width = textureWidth;
-    region.imageExtent.height = textureHeight;
-    region.imageExtent.depth = 1;
-    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    region.imageSubresource.baseArrayLayer = 0;
-    region.imageSubresource.layerCount = 1;
-    region.imageSubresource.mipLevel = 0;
-    vkCmdCopyBufferToImage(recordingState.commandBuffer, m_TextureStagingBuffer.buffer, image.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+        outImage->image = image.image;
+        outImage->layout = layout;
+        outImage->format = image.format;
+        outImage->extent = image.extent;
+        outImage->layers = image.layers;
+        outImage->plugin = PluginImageTable::kNoSlot;
+        return true;
+    }
+
+    if (m_Images.VerifiedBatch(plugin) != m_TransferBatch)
+    {
+        UnityVulkanImage image;
+        if (!m_UnityVulkan->AccessTexture(texture, UnityVulkanWholeImage, VK_IMAGE_LAYOUT_UNDEFINED, 0, 0, kUnityVulkanResourceAccess_ObserveOnly, &image))
+            return false;
+
+        if (image.layout != VK_IMAGE_LAYOUT_GENERAL)
+        {
+            // Unity used the image since, let it transition back and synchronize with its own accesses
+            if (!m_UnityVulkan->AccessTexture(texture, UnityVulkanWholeImage, VK_IMAGE_LAYOUT_GENERAL, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT, kUnityVulkanResourceAccess_PipelineBarrier, &image))
+                return false;
+            m_Images.PendingWrite(plugin) = false;
+            m_Images.PendingRead(plugin) = false;
+        }
+        m_Images.VerifiedBatch(plugin) = m_TransferBatch;
+    }
+
+    outImage->image = m_Images.Image(plugin);
+    outImage->layout = VK_IMAGE_LAYOUT_GENERAL;
+    outImage->format = m_Images.Format(plugin);
+    outImage->extent = m_Images.Extent(plugin);
+    outImage->layers = m_Images.ArrayLayers(plugin);
+    outImage->plugin = plugin;
+    return true;
+}
+
+// Records a barrier only when the next transfer reads a plugin image with an unfinished write or writes one with an
+// unfinished read or write. A single global memory barrier then covers every plugin image touched so far.
+void RenderAPI_Vulkan::SyncTransferHazards(VkCommandBuffer commandBuffer, unsigned int read, unsigned int write)
+{
+    const bool readPlugin = read != PluginImageTable::kNoSlot;
+    const bool writePlugin = write != PluginImageTable::kNoSlot;
+    const bool hazard = (readPlugin && m_Images.PendingWrite(read)) || (writePlugin && (m_Images.PendingWrite(write) || m_Images.PendingRead(write)));
+    if (hazard)
+    {
+        VkMemoryBarrier barrier;
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.pNext = NULL;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0, NULL, 0, NULL);
+
+        for (size_t i = 0; i < m_PendingTransferImages.size(); ++i)
+        {
+            m_Images.PendingWrite(m_PendingTransferImages[i]) = false;
+            m_Images.PendingRead(m_PendingTransferImages[i]) = false;
+        }
+        m_PendingTransferImages.clear();
+    }
+
+    if (readPlugin)
+    {
+        if (!m_Images.PendingRead(read) && !m_Images.PendingWrite(read))
+            m_PendingTransferImages.push_back(read);
+        m_Images.PendingRead(read) = true;
+    }
+    if (writePlugin)
+    {
+        if (!m_Images.PendingRead(write) && !m_Images.PendingWrite(write))
+            m_PendingTransferImages.push_back(write);
+        m_Images.PendingWrite(write) = true;
+    }
 }
 
 void RenderAPI_Vulkan::DoCopyTexture(void* sourceTexture, int sourceX, int sourceY, int sourceWidth, int sourceHeight, void* destinationTexture, int destinationX, int destinationY)
 {
     // cannot do resource uploads inside renderpass
     m_UnityVulkan->EnsureOutsideRenderPass();
+    ++m_TransferBatch;
+
+    DGCopyRegion region = { sourceX, sourceY, sourceWidth, sourceHeight, destinationX, destinationY };
+    RecordCopyTexture(sourceTexture, 0, destinationTexture, 0, &region, 1);
+}
 
-    UnityVulkanImage sourceImage;
-    if (!m_UnityVulkan->AccessTexture(sourceTexture, UnityVulkanWholeImage, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT, kUnityVulkanResourceAccess_PipelineBarrier, &sourceImage))
+// One layout transition per image and a single vkCmdCopyImage for all regions
+void RenderAPI_Vulkan::RecordCopyTexture(void* sourceTexture, int sourceLayer, void* destinationTexture, int destinationLayer, const DGCopyRegion* regions, int count)
+{
+    TransferImage sourceImage;
+    if (!AccessTransferImage(sourceTexture, false, &sourceImage) || (uint32_t)sourceLayer >= sourceImage.layers)
         return;
-    UnityVulkanImage destinationImage;
-    if (!m_UnityVulkan->AccessTexture(destinationTexture, UnityVulkanWholeImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT, kUnityVulkanResourceAccess_PipelineBarrier, &destinationImage))
+    TransferImage destinationImage;
+    if (!AccessTransferImage(destinationTexture, true, &destinationImage) || (uint32_t)destinationLayer >= destinationImage.layers)
         return;
 
     UnityVulkanRecordingState recordingState;
     if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
         return;
 
-    VkImageCopy region;
-    region.srcOffset.x = sourceX;
-    region.srcOffset.y = sourceY;
-    region.srcOffset.z = 0;
-    region.extent.width = sourceWidth;
-    region.extent.height = sourceHeight;
-    region.extent.depth = 1;
-    region.dstOffset.x = destinationX;
-    region.dstOffset.y = destinationY;
-    region.dstOffset.z = 0;
-    region.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    region.srcSubresource.baseArrayLayer = 0;
-    region.srcSubresource.layerCount = 1;
-    region.srcSubresource.mipLevel = 0;
-    region.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    region.dstSubresource.baseArrayLayer = 0;
-    region.dstSubresource.layerCount = 1;
-    region.dstSubresource.mipLevel = 0;
-    
-    vkCmdCopyImage(recordingState.commandBuffer, sourceImage.image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL , destinationImage.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    m_CopyRegions.resize(count);
+    for (int i = 0; i < count; ++i)
+    {
+        VkImageCopy& region = m_CopyRegions[i];
+        region.srcOffset.x = regions[i].sourceX;
+        region.srcOffset.y = regions[i].sourceY;
+        region.srcOffset.z = 0;
+        region.extent.width = regions[i].width;
+        region.extent.height = regions[i].height;
+        region.extent.depth = 1;
+        region.dstOffset.x = regions[i].destinationX;
+        region.dstOffset.y = regions[i].destinationY;
+        region.dstOffset.z = 0;
+        region.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.srcSubresource.baseArrayLayer = (uint32_t)sourceLayer;
+        region.srcSubresource.layerCount = 1;
+        region.srcSubresource.mipLevel = 0;
+        region.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.dstSubresource.baseArrayLayer = (uint32_t)destinationLayer;
+        region.dstSubresource.layerCount = 1;
+        region.dstSubresource.mipLevel = 0;
+    }
+
+    SyncTransferHazards(recordingState.commandBuffer, sourceImage.plugin, destinationImage.plugin);
+    vkCmdCopyImage(recordingState.commandBuffer, sourceImage.image, sourceImage.layout, destinationImage.image, destinationImage.layout, (uint32_t)count, m_CopyRegions.data());
 }
 
-bool RenderAPI_Vulkan::CreateTexture(int width, int height, int format, int textureIndex)
+bool RenderAPI_Vulkan::CreateTexture(int width, int height, int format, int mipCount, int textureIndex)
 {
-    // cannot do resource uploads inside renderpass
-    //m_UnityVulkan->EnsureOutsideRenderPass();
+    DGTextureDesc desc;
+    desc.width = width;
+    desc.height = height;
+    desc.format = format;
+    desc.mipCount = mipCount;
+    CreateTextures(&desc, &textureIndex, 1);
+    return textureIndex >= 0;
+}
+
+void RenderAPI_Vulkan::CreateTextures(const DGTextureDesc* descs, int* textureIndices, int count)
+{
+    CreatePluginImages(descs, 1, textureIndices, count);
+}
+
+bool RenderAPI_Vulkan::CreateTextureArray(int width, int height, int layers, int format, int textureIndex)
+{
+    DGTextureDesc desc;
+    desc.width = width;
+    desc.height = height;
+    desc.format = format;
+    desc.mipCount = 1;
+    CreatePluginImages(&desc, layers, &textureIndex, 1);
+    return textureIndex >= 0;
+}
 
-    if(textureIndex == m_UsedTextureCount)
+// Called on whichever thread creates the textures. Nothing here records commands, so it never waits for or runs on
+// Unity's render thread. The pool and the image registry are locked once for the whole batch.
+void RenderAPI_Vulkan::CreatePluginImages(const DGTextureDesc* descs, int arrayLayers, int* textureIndices, int count)
+{
+    const VkImageUsageFlags usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+
+    // Newest first, the texture destroyed last is the most likely to match again. Its contents are undefined just like
+    // those of a new image, and its pending transfer state is kept so the next access is still ordered correctly.
+    // Called concurrently from several threads, so the slot list lives on the stack unless the batch is large
+    unsigned int localSlots[16];
+    std::vector<unsigned int> heapSlots;
+    unsigned int* slots = localSlots;
+    if (count > 16)
     {
-        m_Textures.push_back(new UnityVulkanImage());
-        m_UsedTextureCount++;
+        heapSlots.resize(count);
+        slots = heapSlots.data();
     }
-    else
+    for (int t = 0; t < count; ++t)
+        slots[t] = PluginImageTable::kNoSlot;
+
+    {
+        std::lock_guard<std::mutex> lock(m_TexturePoolMutex);
+        for (int t = 0; t < count && !m_TexturePool.empty(); ++t)
+        {
+            if (textureIndices[t] < 0)
+                continue;
+            for (size_t i = m_TexturePool.size(); i-- > 0;)
+            {
+                const unsigned int pooled = m_TexturePool[i];
+                const VkExtent3D& extent = m_Images.Extent(pooled);
+                if ((int)extent.width == descs[t].width && (int)extent.height == descs[t].height && (int)m_Images.Format(pooled) == descs[t].format &&
+                    (int)m_Images.MipLevels(pooled) == descs[t].mipCount && (int)m_Images.ArrayLayers(pooled) == arrayLayers && m_Images.Usage(pooled) == usage)
+                {
+                    slots[t] = pooled;
+                    m_TexturePool.erase(m_TexturePool.begin() + i);
+                    break;
+                }
+            }
+        }
+    }
+
+    int createdImages = 0;
+    for (int t = 0; t < count; ++t)
+    {
+        if (textureIndices[t] < 0 || slots[t] != PluginImageTable::kNoSlot)
+            continue;
+
+        UnityVulkanImage image;
+        DeviceMemoryBlock memory;
+        if (!CreateVulkanImage(descs[t].width, descs[t].height, descs[t].format, descs[t].mipCount, arrayLayers, usage, &image, &memory))
+        {
+            textureIndices[t] = -1;
+            continue;
+        }
+
+        const unsigned int slot = m_Images.Allocate();
+        if (slot == PluginImageTable::kNoSlot)
+        {
+            vkDestroyImage(m_Instance.device, image.image, NULL);
+            m_MemoryAllocator.Free(memory);
+            textureIndices[t] = -1;
+            continue;
+        }
+        m_Images.Image(slot) = image.image;
+        m_Images.Memory(slot) = memory;
+        m_Images.Format(slot) = image.format;
+        m_Images.Extent(slot) = image.extent;
+        m_Images.Usage(slot) = image.usage;
+        m_Images.MipLevels(slot) = (uint32_t)image.mipCount;
+        m_Images.ArrayLayers(slot) = (uint32_t)image.layers;
+        slots[t] = slot;
+        ++createdImages;
+    }
+
+    if (createdImages > 0)
     {
-        m_Textures[textureIndex] = new UnityVulkanImage();
+        std::lock_guard<std::mutex> lock(m_PluginImagesMutex);
+        for (int t = 0; t < count; ++t)
+        {
+            if (textureIndices[t] >= 0)
+                m_PluginImages[m_Images.Image(slots[t])] = slots[t];
+        }
     }
 
-    return CreateVulkanImage(width, height, format, VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, m_Textures[textureIndex]);
+    for (int t = 0; t < count; ++t)
+    {
+        if (textureIndices[t] >= 0)
+            m_Textures.Set(textureIndices[t], slots[t]);
+    }
 }
 
+// The image is retired on the render thread once the GPU is done with it, see CollectGarbage. Until then it can't be
+// handed out again by the texture pool.
 void RenderAPI_Vulkan::DestroyTexture(int textureIndex)
 {
-    if(textureIndex >= m_UsedTextureCount || m_Textures[textureIndex] == nullptr)
-        return;
+    DestroyTextures(&textureIndex, 1);
+}
+
+void RenderAPI_Vulkan::DestroyTextures(const int* textureIndices, int count)
+{
+    std::lock_guard<std::mutex> lock(m_TexturePoolMutex);
+    for (int i = 0; i < count; ++i)
+    {
+        if (textureIndices[i] < 0)
+            continue;
+        const unsigned int slot = m_Textures.Exchange(textureIndices[i], PluginImageTable::kNoSlot);
+        if (slot == PluginImageTable::kNoSlot)
+            continue;
+
+        RetiredImage retired;
+        retired.slot = slot;
+        retired.recycle = true;
+        m_DestroyedTextures.push_back(retired);
+    }
+}
+
+// Destroys a retired image right away, called on the render thread once the GPU is done with it.
+void RenderAPI_Vulkan::DestroyPluginImage(unsigned int slot)
+{
+    const VkImage image = m_Images.Image(slot);
+    {
+        std::lock_guard<std::mutex> lock(m_PluginImagesMutex);
+        m_PluginImages.erase(image);
+    }
+    for (size_t i = 0; i < m_PendingTransferImages.size(); ++i)
+    {
+        if (m_PendingTransferImages[i] == slot)
+        {
+            m_PendingTransferImages.erase(m_PendingTransferImages.begin() + i);
+            break;
+        }
+    }
+
+    if(image != VK_NULL_HANDLE)
+        vkDestroyImage(m_Instance.device, image, NULL);
+    m_MemoryAllocator.Free(m_Images.Memory(slot));
+    m_Images.Release(slot);
+}
 
-    if(m_Textures[textureIndex]->image != VK_NULL_HANDLE)
-        vkDestroyImage(m_Instance.device, m_Textures[textureIndex]->image, NULL);
-    if(m_Textures[textureIndex]->memory.memory != VK_NULL_HANDLE)
-        vkFreeMemory(m_Instance.device, m_Textures[textureIndex]->memory.memory, NULL);
-    delete m_Textures[textureIndex];
-    m_Textures[textureIndex] = nullptr;
+void RenderAPI_Vulkan::SetTexturePoolCapacity(int capacity)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_TexturePoolMutex);
+        m_TexturePoolCapacity = capacity > 0 ? capacity : 0;
+    }
+    TrimTexturePool(capacity);
+}
+
+// Pooled images are no longer used by the GPU but the render thread still tracks them, so they are destroyed there as well.
+void RenderAPI_Vulkan::TrimTexturePool(int maxPooled)
+{
+    std::lock_guard<std::mutex> lock(m_TexturePoolMutex);
+    while ((int)m_TexturePool.size() > maxPooled && !m_TexturePool.empty())
+    {
+        RetiredImage retired;
+        retired.slot = m_TexturePool.front();
+        retired.recycle = false;
+        m_DestroyedTextures.push_back(retired);
+        m_TexturePool.pop_front();
+    }
 }
 
+// The VkImage lives in a chunk of m_Images that never moves, so the address stays valid for as long as Unity holds it
 void* RenderAPI_Vulkan::GetTexturePointer(int textureIndex)
 {
-    return (void*)&m_Textures[textureIndex]->image;
+    const unsigned int slot = m_Textures.Get(textureIndex);
+    return slot != PluginImageTable::kNoSlot ? (void*)&m_Images.Image(slot) : NULL;
 }
 
 void RenderAPI_Vulkan::SetTextureColor(float red, float green, float blue, float alpha, void* targetTexture)
 {
     // cannot do resource uploads inside renderpass
     m_UnityVulkan->EnsureOutsideRenderPass();
+    ++m_TransferBatch;
+
+    RecordClearTexture(red, green, blue, alpha, targetTexture, 0);
+}
+
+void RenderAPI_Vulkan::RecordClearTexture(float red, float green, float blue, float alpha, void* targetTexture, int layer)
+{
+    TransferImage targetImage;
+    if (!AccessTransferImage(targetTexture, true, &targetImage) || (uint32_t)layer >= targetImage.layers)
+        return;
+
+    RecordClearImage(red, green, blue, alpha, targetTexture, targetImage, layer, NULL, 0);
+}
+
+// Every image of a run of clear commands is accessed before the first clear is recorded, so the barriers Unity records for
+// images it owns all come first and the clears follow back to back. Plugin images only need a barrier when an earlier
+// transfer of the batch still touches one of them, and SyncTransferHazards covers all of those with one. A second clear
+// of an image owned by Unity has to follow Unity's barrier for it, the run is split there. Consecutive rectangle clears of
+// the same layer to the same color are recorded together, as one clear of all their rectangles.
+void RenderAPI_Vulkan::RecordClearTextures(const DGCommand* commands, int count)
+{
+    m_ClearImages.resize(count);
+    int begin = 0;
+    while (begin < count)
+    {
+        int end = begin;
+        for (; end < count; ++end)
+        {
+            void* texture = commands[end].destination;
+            if (end > begin && !ContinuesClearRects(commands[end - 1], commands[end]) && FindPluginImage(texture) == PluginImageTable::kNoSlot)
+            {
+                bool repeated = false;
+                for (int i = begin; i < end && !repeated; ++i)
+                    repeated = commands[i].destination == texture;
+                if (repeated)
+                    break;
+            }
+            if (!AccessTransferImage(texture, true, &m_ClearImages[end]) || (uint32_t)commands[end].destinationLayer >= m_ClearImages[end].layers)
+                m_ClearImages[end].image = VK_NULL_HANDLE;
+        }
+
+        for (int i = begin; i < end;)
+        {
+            const DGCommand& command = commands[i];
+            int next = i + 1;
+            if (command.type == kDGCommandClearRect)
+            {
+                m_ClearCommandRects.clear();
+                for (next = i; next < end && (next == i || ContinuesClearRects(commands[next - 1], commands[next])); ++next)
+                {
+                    const DGRect rect = { commands[next].destinationX, commands[next].destinationY, commands[next].width, commands[next].height };
+                    m_ClearCommandRects.push_back(rect);
+                }
+            }
+            if (m_ClearImages[i].image != VK_NULL_HANDLE)
+            {
+                const bool rects = command.type == kDGCommandClearRect;
+                RecordClearImage(command.color[0], command.color[1], command.color[2], command.color[3], command.destination, m_ClearImages[i], command.destinationLayer,
+                    rects ? m_ClearCommandRects.data() : NULL, rects ? (int)m_ClearCommandRects.size() : 0);
+            }
+            i = next;
+        }
+        begin = end;
+    }
+}
+
+// Clears the rectangles of a layer, clipped to the image, or the whole layer when rects is NULL. vkCmdClearColorImage
+// only clears whole layers and vkCmdClearAttachments needs the image bound in a render pass, which plugin images are not
+// created for. Rectangles are cleared in a scratch image as large as the biggest of them instead, and one vkCmdCopyImage
+// copies it into all of them. The scratch image is reused by later rectangle clears of the same format in the frame.
+void RenderAPI_Vulkan::RecordClearImage(float red, float green, float blue, float alpha, void* targetTexture, const TransferImage& targetImage, int layer, const DGRect* rects, int count)
+{
+    m_ClearRects.clear();
+    if (rects == NULL)
+    {
+        const VkRect2D rect = { { 0, 0 }, { targetImage.extent.width, targetImage.extent.height } };
+        m_ClearRects.push_back(rect);
+    }
+    for (int i = 0; rects != NULL && i < count; ++i)
+    {
+        const int x = std::max(rects[i].x, 0);
+        const int y = std::max(rects[i].y, 0);
+        const int right = std::min(rects[i].x + rects[i].width, (int)targetImage.extent.width);
+        const int bottom = std::min(rects[i].y + rects[i].height, (int)targetImage.extent.height);
+        if (right <= x || bottom <= y)
+            continue;
+        const VkRect2D rect = { { x, y }, { (uint32_t)(right - x), (uint32_t)(bottom - y) } };
+        m_ClearRects.push_back(rect);
+    }
+    if (m_ClearRects.empty())
+        return;
 
-    UnityVulkanImage targetImage;
-    if (!m_UnityVulkan->AccessTexture(targetTexture, UnityVulkanWholeImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT, kUnityVulkanResourceAccess_PipelineBarrier, &targetImage))
+    int blockBytes, blockWidth, blockHeight;
+    if (GetFormatBlockInfo(targetImage.format, &blockBytes, &blockWidth, &blockHeight) && blockWidth > 1)
+    {
+        const float color[4] = { red, green, blue, alpha };
+        RecordClearBlocks(color, targetTexture, targetImage, layer);
         return;
+    }
 
     UnityVulkanRecordingState recordingState;
     if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
@@ -891,12 +6124,1265 @@ void RenderAPI_Vulkan::SetTextureColor(float red, float green, float blue, float
     imageSubresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
     imageSubresourceRange.baseMipLevel = 0;
     imageSubresourceRange.levelCount = 1;
-    imageSubresourceRange.baseArrayLayer = 0;
+    imageSubresourceRange.baseArrayLayer = (uint32_t)layer;
     imageSubresourceRange.layerCount = 1;
 
     VkClearColorValue color = { red, green, blue, alpha };
 
-    vkCmdClearColorImage(recordingState.commandBuffer, targetImage.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &color, 1, &imageSubresourceRange);
+    const VkRect2D& first = m_ClearRects[0];
+    if (m_ClearRects.size() == 1 && first.extent.width == targetImage.extent.width && first.extent.height == targetImage.extent.height)
+    {
+        SyncTransferHazards(recordingState.commandBuffer, PluginImageTable::kNoSlot, targetImage.plugin);
+        vkCmdClearColorImage(recordingState.commandBuffer, targetImage.image, targetImage.layout, &color, 1, &imageSubresourceRange);
+        return;
+    }
+
+    uint32_t scratchWidth = 0;
+    uint32_t scratchHeight = 0;
+    for (size_t i = 0; i < m_ClearRects.size(); ++i)
+    {
+        scratchWidth = std::max(scratchWidth, m_ClearRects[i].extent.width);
+        scratchHeight = std::max(scratchHeight, m_ClearRects[i].extent.height);
+    }
+    ClearScratch& cached = m_ClearScratch[(int)targetImage.format];
+    if (cached.image == VK_NULL_HANDLE || cached.frameNumber != recordingState.currentFrameNumber || cached.width < scratchWidth || cached.height < scratchHeight)
+    {
+        // Grow past the image it replaces so alternating sizes don't create one every clear
+        if (cached.image != VK_NULL_HANDLE && cached.frameNumber == recordingState.currentFrameNumber)
+        {
+            scratchWidth = std::max(scratchWidth, cached.width);
+            scratchHeight = std::max(scratchHeight, cached.height);
+        }
+        VkImage image;
+        if (!CreateScratchImage((int)scratchWidth, (int)scratchHeight, targetImage.format, recordingState, &image))
+            return;
+        cached.image = image;
+        cached.frameNumber = recordingState.currentFrameNumber;
+        cached.width = scratchWidth;
+        cached.height = scratchHeight;
+    }
+    else
+    {
+        // The previous clear may still be copying out of it
+        RecordTransferBarrier(recordingState.commandBuffer);
+    }
+    const VkImage scratch = cached.image;
+
+    imageSubresourceRange.baseArrayLayer = 0;
+    vkCmdClearColorImage(recordingState.commandBuffer, scratch, VK_IMAGE_LAYOUT_GENERAL, &color, 1, &imageSubresourceRange);
+    RecordTransferBarrier(recordingState.commandBuffer);
+
+    m_CopyRegions.resize(m_ClearRects.size());
+    for (size_t i = 0; i < m_ClearRects.size(); ++i)
+    {
+        VkImageCopy& region = m_CopyRegions[i];
+        region.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.srcSubresource.mipLevel = 0;
+        region.srcSubresource.baseArrayLayer = 0;
+        region.srcSubresource.layerCount = 1;
+        region.dstSubresource = region.srcSubresource;
+        region.dstSubresource.baseArrayLayer = (uint32_t)layer;
+        region.srcOffset.x = 0;
+        region.srcOffset.y = 0;
+        region.srcOffset.z = 0;
+        region.dstOffset.x = m_ClearRects[i].offset.x;
+        region.dstOffset.y = m_ClearRects[i].offset.y;
+        region.dstOffset.z = 0;
+        region.extent.width = m_ClearRects[i].extent.width;
+        region.extent.height = m_ClearRects[i].extent.height;
+        region.extent.depth = 1;
+    }
+    SyncTransferHazards(recordingState.commandBuffer, PluginImageTable::kNoSlot, targetImage.plugin);
+    vkCmdCopyImage(recordingState.commandBuffer, scratch, VK_IMAGE_LAYOUT_GENERAL, targetImage.image, targetImage.layout, (uint32_t)m_CopyRegions.size(), m_CopyRegions.data());
+}
+
+// Size of the band of blocks a compressed clear writes to the upload ring
+static const int kClearBandBytes = 64 * 1024;
+
+// vkCmdClearColorImage can't clear compressed formats. The color is encoded into one block instead, a band of that block
+// as wide as the widest of m_ClearRects is written to the upload ring and a single vkCmdCopyBufferToImage repeats it down
+// every rectangle. Rectangles that are not aligned to blocks are skipped, only those touching the right or bottom edge of the
+// image may end in a partial block. Compressed formats the encoder does not know are left as they are.
+void RenderAPI_Vulkan::RecordClearBlocks(const float* color, void* targetTexture, const TransferImage& targetImage, int layer)
+{
+    const int format = GetBCFormat(targetImage.format);
+    if (format < 0)
+        return;
+
+    size_t kept = 0;
+    int width = 0;
+    int height = 0;
+    for (size_t i = 0; i < m_ClearRects.size(); ++i)
+    {
+        const VkRect2D& rect = m_ClearRects[i];
+        if (rect.offset.x % 4 != 0 || rect.offset.y % 4 != 0 ||
+            (rect.extent.width % 4 != 0 && rect.offset.x + rect.extent.width != targetImage.extent.width) ||
+            (rect.extent.height % 4 != 0 && rect.offset.y + rect.extent.height != targetImage.extent.height))
+            continue;
+        width = std::max(width, (int)rect.extent.width);
+        height = std::max(height, (int)rect.extent.height);
+        m_ClearRects[kept++] = rect;
+    }
+    m_ClearRects.resize(kept);
+    if (kept == 0)
+        return;
+
+    unsigned char block[16];
+    const bool srgb = targetImage.format == VK_FORMAT_BC1_RGB_SRGB_BLOCK || targetImage.format == VK_FORMAT_BC1_RGBA_SRGB_BLOCK ||
+        targetImage.format == VK_FORMAT_BC3_SRGB_BLOCK || targetImage.format == VK_FORMAT_BC7_SRGB_BLOCK;
+    const bool bc1Alpha = targetImage.format == VK_FORMAT_BC1_RGBA_UNORM_BLOCK || targetImage.format == VK_FORMAT_BC1_RGBA_SRGB_BLOCK;
+    EncodeBCSolidBlock(format, color, srgb, bc1Alpha, block);
+
+    const int blockBytes = GetBCBlockBytes(format);
+    const int blocksWide = (width + 3) / 4;
+    const int bandBlocks = std::max(1, std::min((height + 3) / 4, kClearBandBytes / (blocksWide * blockBytes)));
+    const int bandHeight = std::min(height, bandBlocks * 4);
+
+    int rowPitch;
+    unsigned char* dataPtr = (unsigned char*)AllocateUpload(targetTexture, width, bandHeight, &rowPitch);
+    if (dataPtr == NULL)
+        return;
+    for (int i = 0; i < blocksWide * bandBlocks; ++i)
+        memcpy(dataPtr + i * blockBytes, block, blockBytes);
+
+    RecordUploadRects(targetTexture, layer, m_ClearRects.data(), (int)m_ClearRects.size(), rowPitch, dataPtr, bandHeight);
+}
+
+// Whether region writes any pixel one of regions writes as well
+static bool CopyDestinationOverlaps(const DGCopyRegion& region, const std::vector<DGCopyRegion>& regions)
+{
+    for (size_t i = 0; i < regions.size(); ++i)
+    {
+        const DGCopyRegion& other = regions[i];
+        if (region.destinationX < other.destinationX + other.width && other.destinationX < region.destinationX + region.width &&
+            region.destinationY < other.destinationY + other.height && other.destinationY < region.destinationY + region.height)
+            return true;
+    }
+    return false;
+}
+
+void RenderAPI_Vulkan::SubmitCommands(const DGCommand* commands, int count)
+{
+    // cannot do resource uploads inside renderpass, leave it once for the whole batch
+    m_UnityVulkan->EnsureOutsideRenderPass();
+    ++m_TransferBatch;
+
+    int i = 0;
+    while (i < count)
+    {
+        const DGCommand& command = commands[i];
+        if (command.type == kDGCommandClear || command.type == kDGCommandClearRect)
+        {
+            int end = i;
+            while (end < count && (commands[end].type == kDGCommandClear || commands[end].type == kDGCommandClearRect))
+                ++end;
+            RecordClearTextures(commands + i, end - i);
+            i = end;
+            continue;
+        }
+
+        if (command.type == kDGCommandBlit)
+        {
+            const VkRect2D sourceRect = { { command.sourceX, command.sourceY }, { (uint32_t)command.width, (uint32_t)command.height } };
+            const VkRect2D destinationRect = { { command.destinationX, command.destinationY }, { (uint32_t)command.destinationWidth, (uint32_t)command.destinationHeight } };
+            RecordBlitTexture(command.source, command.sourceLayer, sourceRect, command.destination, command.destinationLayer, destinationRect, command.filter);
+            ++i;
+            continue;
+        }
+
+        if (command.type == kDGCommandConvert)
+        {
+            RecordConvertTexture(command);
+            ++i;
+            continue;
+        }
+
+        if (command.type == kDGCommandCompress)
+        {
+            RecordCompressTexture(command);
+            ++i;
+            continue;
+        }
+
+        // Consecutive mip generations share their per level barriers
+        if (command.type == kDGCommandGenerateMips)
+        {
+            m_MipTextures.clear();
+            while (i < count && commands[i].type == kDGCommandGenerateMips)
+                m_MipTextures.push_back(commands[i++].destination);
+            RecordGenerateMips(m_MipTextures.data(), (int)m_MipTextures.size());
+            continue;
+        }
+
+        // Consecutive copies between the same pair of texture layers become one vkCmdCopyImage. The regions of a copy are
+        // not ordered, so the run ends before a region writing over an earlier one, which then follows after a barrier.
+        // Copies within one texture get a vkCmdCopyImage each since a region may read what another one writes.
+        m_CommandRegions.clear();
+        int end = i;
+        while (end < count && commands[end].type == kDGCommandCopy && commands[end].source == command.source && commands[end].destination == command.destination &&
+            commands[end].sourceLayer == command.sourceLayer && commands[end].destinationLayer == command.destinationLayer)
+        {
+            DGCopyRegion region = { commands[end].sourceX, commands[end].sourceY, commands[end].width, commands[end].height, commands[end].destinationX, commands[end].destinationY };
+            if (end > i && (command.source == command.destination || CopyDestinationOverlaps(region, m_CommandRegions)))
+                break;
+            m_CommandRegions.push_back(region);
+            ++end;
+        }
+        RecordCopyTexture(command.source, command.sourceLayer, command.destination, command.destinationLayer, m_CommandRegions.data(), (int)m_CommandRegions.size());
+        i = end;
+    }
+}
+
+VkFormatFeatureFlags RenderAPI_Vulkan::GetFormatFeatures(VkFormat format)
+{
+    std::unordered_map<int, VkFormatFeatureFlags>::iterator it = m_FormatFeatures.find((int)format);
+    if (it == m_FormatFeatures.end())
+    {
+        VkFormatProperties properties;
+        vkGetPhysicalDeviceFormatProperties(m_Instance.physicalDevice, format, &properties);
+        it = m_FormatFeatures.insert(std::make_pair((int)format, properties.optimalTilingFeatures)).first;
+    }
+    return it->second;
+}
+
+void RenderAPI_Vulkan::BlitTexture(void* sourceTexture, int sourceX, int sourceY, int sourceWidth, int sourceHeight, void* destinationTexture, int destinationX, int destinationY, int destinationWidth, int destinationHeight, int filter)
+{
+    // cannot do resource uploads inside renderpass
+    m_UnityVulkan->EnsureOutsideRenderPass();
+    ++m_TransferBatch;
+
+    const VkRect2D sourceRect = { { sourceX, sourceY }, { (uint32_t)sourceWidth, (uint32_t)sourceHeight } };
+    const VkRect2D destinationRect = { { destinationX, destinationY }, { (uint32_t)destinationWidth, (uint32_t)destinationHeight } };
+    RecordBlitTexture(sourceTexture, 0, sourceRect, destinationTexture, 0, destinationRect, filter);
+}
+
+// vkCmdBlitImage when both formats support it, which also converts between formats. Otherwise equally sized rectangles
+// are copied and differently sized ones resampled with copies, see RecordResampleTexture.
+void RenderAPI_Vulkan::RecordBlitTexture(void* sourceTexture, int sourceLayer, const VkRect2D& sourceRect, void* destinationTexture, int destinationLayer, const VkRect2D& destinationRect, int filter)
+{
+    TransferImage sourceImage;
+    if (!AccessTransferImage(sourceTexture, false, &sourceImage) || (uint32_t)sourceLayer >= sourceImage.layers)
+        return;
+    TransferImage destinationImage;
+    if (!AccessTransferImage(destinationTexture, true, &destinationImage) || (uint32_t)destinationLayer >= destinationImage.layers)
+        return;
+
+    const VkFormatFeatureFlags sourceFeatures = GetFormatFeatures(sourceImage.format);
+    const VkFormatFeatureFlags destinationFeatures = GetFormatFeatures(destinationImage.format);
+    if ((sourceFeatures & VK_FORMAT_FEATURE_BLIT_SRC_BIT) == 0 || (destinationFeatures & VK_FORMAT_FEATURE_BLIT_DST_BIT) == 0)
+    {
+        if (sourceRect.extent.width == destinationRect.extent.width && sourceRect.extent.height == destinationRect.extent.height)
+        {
+            const DGCopyRegion region = { sourceRect.offset.x, sourceRect.offset.y, (int)sourceRect.extent.width, (int)sourceRect.extent.height, destinationRect.offset.x, destinationRect.offset.y };
+            RecordCopyTexture(sourceTexture, sourceLayer, destinationTexture, destinationLayer, &region, 1);
+            return;
+        }
+
+        UnityVulkanRecordingState recordingState;
+        if (m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
+            RecordResampleTexture(sourceImage, sourceLayer, sourceRect, destinationImage, destinationLayer, destinationRect, recordingState);
+        return;
+    }
+
+    UnityVulkanRecordingState recordingState;
+    if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
+        return;
+
+    const bool linear = filter == kDGFilterLinear && (sourceFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT) != 0;
+
+    SyncTransferHazards(recordingState.commandBuffer, sourceImage.plugin, destinationImage.plugin);
+    RecordImageBlit(recordingState.commandBuffer, sourceImage.image, sourceImage.layout, sourceLayer, sourceRect, destinationImage.image, destinationImage.layout, destinationLayer, destinationRect, linear ? VK_FILTER_LINEAR : VK_FILTER_NEAREST);
+}
+
+int RenderAPI_Vulkan::GetSupportedConvertOptions()
+{
+    return kDGConvertOptionsAll;
+}
+
+// Plain format conversions are a vkCmdBlitImage of the same size. The sRGB curve alone is applied by a blit too: the unorm
+// side of the blit is aliased by copying it to or from a scratch image of its sRGB format, which makes the blit decode
+// or encode on the way. Swizzles, premultiplies and formats vkCmdBlitImage can't convert go through the convert
+// compute shader instead, see RecordComputeConvert.
+void RenderAPI_Vulkan::RecordConvertTexture(const DGCommand& command)
+{
+    const VkRect2D sourceRect = { { command.sourceX, command.sourceY }, { (uint32_t)command.width, (uint32_t)command.height } };
+    const VkRect2D destinationRect = { { command.destinationX, command.destinationY }, { (uint32_t)command.width, (uint32_t)command.height } };
+
+    TransferImage sourceImage;
+    if (!AccessTransferImage(command.source, false, &sourceImage) || (uint32_t)command.sourceLayer >= sourceImage.layers)
+        return;
+    TransferImage destinationImage;
+    if (!AccessTransferImage(command.destination, true, &destinationImage) || (uint32_t)command.destinationLayer >= destinationImage.layers)
+        return;
+
+    // Decoding and encoding again cancels out
+    const int options = command.convertOptions == (kDGConvertSRGBToLinear | kDGConvertLinearToSRGB) ? 0 : command.convertOptions;
+    const bool blits = (GetFormatFeatures(sourceImage.format) & VK_FORMAT_FEATURE_BLIT_SRC_BIT) != 0 && (GetFormatFeatures(destinationImage.format) & VK_FORMAT_FEATURE_BLIT_DST_BIT) != 0;
+    if (options == 0 && blits)
+    {
+        RecordBlitTexture(command.source, command.sourceLayer, sourceRect, command.destination, command.destinationLayer, destinationRect, kDGFilterNearest);
+        return;
+    }
+
+    const bool decode = options == kDGConvertSRGBToLinear;
+    const bool encode = options == kDGConvertLinearToSRGB;
+    const VkFormat scratchFormat = decode || encode ? GetSRGBFormat(decode ? sourceImage.format : destinationImage.format) : VK_FORMAT_UNDEFINED;
+    const VkFormat blitSourceFormat = decode ? scratchFormat : sourceImage.format;
+    const VkFormat blitDestinationFormat = decode ? destinationImage.format : scratchFormat;
+    if (scratchFormat == VK_FORMAT_UNDEFINED || (GetFormatFeatures(blitSourceFormat) & VK_FORMAT_FEATURE_BLIT_SRC_BIT) == 0 || (GetFormatFeatures(blitDestinationFormat) & VK_FORMAT_FEATURE_BLIT_DST_BIT) == 0)
+    {
+        // Without a shader for the formats a plain conversion is left to RecordBlitTexture, which copies equal formats
+        if (!RecordComputeConvert(command, sourceImage, destinationImage) && options == 0)
+            RecordBlitTexture(command.source, command.sourceLayer, sourceRect, command.destination, command.destinationLayer, destinationRect, kDGFilterNearest);
+        return;
+    }
+
+    UnityVulkanRecordingState recordingState;
+    if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
+        return;
+    VkImage scratch;
+    if (!CreateScratchImage(command.width, command.height, scratchFormat, recordingState, &scratch))
+        return;
+
+    const VkRect2D scratchRect = { { 0, 0 }, sourceRect.extent };
+    SyncTransferHazards(recordingState.commandBuffer, sourceImage.plugin, destinationImage.plugin);
+    if (decode)
+    {
+        RecordImageCopy(recordingState.commandBuffer, sourceImage.image, sourceImage.layout, command.sourceLayer, sourceRect, scratch, VK_IMAGE_LAYOUT_GENERAL, 0, scratchRect.offset);
+        RecordTransferBarrier(recordingState.commandBuffer);
+        RecordImageBlit(recordingState.commandBuffer, scratch, VK_IMAGE_LAYOUT_GENERAL, 0, scratchRect, destinationImage.image, destinationImage.layout, command.destinationLayer, destinationRect, VK_FILTER_NEAREST);
+    }
+    else
+    {
+        RecordImageBlit(recordingState.commandBuffer, sourceImage.image, sourceImage.layout, command.sourceLayer, sourceRect, scratch, VK_IMAGE_LAYOUT_GENERAL, 0, scratchRect, VK_FILTER_NEAREST);
+        RecordTransferBarrier(recordingState.commandBuffer);
+        RecordImageCopy(recordingState.commandBuffer, scratch, VK_IMAGE_LAYOUT_GENERAL, 0, scratchRect, destinationImage.image, destinationImage.layout, command.destinationLayer, destinationRect.offset);
+    }
+}
+
+// The source rectangle is copied into a storage buffer, converted texel by texel into a second range of it and copied
+// into the destination from there. Both formats need a texel format code, see GetComputeTexelFormat. Returns false
+// when nothing was recorded.
+bool RenderAPI_Vulkan::RecordComputeConvert(const DGCommand& command, const TransferImage& source, const TransferImage& destination)
+{
+    const int sourceFormat = GetComputeTexelFormat(source.format);
+    const int destinationFormat = GetComputeTexelFormat(destination.format);
+    if (sourceFormat < 0 || destinationFormat < 0)
+        return false;
+    if ((uint32_t)command.sourceX >= source.extent.width || (uint32_t)command.sourceY >= source.extent.height ||
+        (uint32_t)command.destinationX >= destination.extent.width || (uint32_t)command.destinationY >= destination.extent.height)
+        return false;
+    const uint32_t width = std::min((uint32_t)command.width, std::min(source.extent.width - command.sourceX, destination.extent.width - command.destinationX));
+    const uint32_t height = std::min((uint32_t)command.height, std::min(source.extent.height - command.sourceY, destination.extent.height - command.destinationY));
+
+    int sourceBytes, destinationBytes, blockWidth, blockHeight;
+    GetFormatBlockInfo(source.format, &sourceBytes, &blockWidth, &blockHeight);
+    GetFormatBlockInfo(destination.format, &destinationBytes, &blockWidth, &blockHeight);
+    const VkDeviceSize inputSize = (VkDeviceSize)width * height * sourceBytes;
+    const VkDeviceSize outputOffset = GetComputeOutputOffset(inputSize);
+    const VkDeviceSize outputSize = (VkDeviceSize)width * height * destinationBytes;
+
+    UnityVulkanRecordingState recordingState;
+    if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
+        return false;
+    VkBuffer buffer;
+    if (GetComputePipeline(kComputeConvert) == VK_NULL_HANDLE || !CreateComputeBuffer(outputOffset + outputSize, recordingState, &buffer))
+        return false;
+
+    // Mirrors Params of convert.comp
+    const uint32_t constants[6] = { width, height, (uint32_t)sourceFormat, (uint32_t)destinationFormat, (uint32_t)command.convertOptions, (uint32_t)command.swizzle };
+
+    const VkRect2D sourceRect = { { command.sourceX, command.sourceY }, { width, height } };
+    const VkRect2D destinationRect = { { command.destinationX, command.destinationY }, { width, height } };
+    const VkBufferImageCopy sourceRegion = BufferImageRegion(0, 0, command.sourceLayer, sourceRect);
+    const VkBufferImageCopy destinationRegion = BufferImageRegion(outputOffset, 0, command.destinationLayer, destinationRect);
+    SyncTransferHazards(recordingState.commandBuffer, source.plugin, destination.plugin);
+    vkCmdCopyImageToBuffer(recordingState.commandBuffer, source.image, source.layout, buffer, 1, &sourceRegion);
+    if (RecordComputeDispatch(kComputeConvert, buffer, 0, inputSize, outputOffset, outputSize, constants, sizeof(constants), width, height, recordingState))
+        vkCmdCopyBufferToImage(recordingState.commandBuffer, buffer, destination.image, destination.layout, 1, &destinationRegion);
+    return true;
+}
+
+// Block compressed images can't be written by shaders, so the source rectangle is copied into a storage buffer, every
+// 4x4 block is encoded by one thread of the compress shader into a second range of it and the blocks are copied into the
+// destination from there, the way Metal does it.
+void RenderAPI_Vulkan::RecordCompressTexture(const DGCommand& command)
+{
+    TransferImage sourceImage;
+    if (!AccessTransferImage(command.source, false, &sourceImage) || (uint32_t)command.sourceLayer >= sourceImage.layers)
+        return;
+    TransferImage destinationImage;
+    if (!AccessTransferImage(command.destination, true, &destinationImage) || (uint32_t)command.destinationLayer >= destinationImage.layers)
+        return;
+    const int encoder = GetBCFormat(destinationImage.format);
+    int sourceFormat = GetComputeTexelFormat(sourceImage.format);
+    if (encoder < 0 || sourceFormat < 0)
+        return;
+
+    // Partial blocks are only allowed at the right and bottom edge of the destination
+    if ((uint32_t)command.destinationX >= destinationImage.extent.width || (uint32_t)command.destinationY >= destinationImage.extent.height ||
+        (uint32_t)command.sourceX >= sourceImage.extent.width || (uint32_t)command.sourceY >= sourceImage.extent.height)
+        return;
+    const uint32_t width = std::min(((uint32_t)command.width + 3) & ~3u, destinationImage.extent.width - command.destinationX);
+    const uint32_t height = std::min(((uint32_t)command.height + 3) & ~3u, destinationImage.extent.height - command.destinationY);
+    const uint32_t blocksWide = (width + 3) / 4;
+    const uint32_t blocksHigh = (height + 3) / 4;
+
+    // Source pixels past the rectangle repeat its last row and column
+    const uint32_t sourceWidth = std::min((uint32_t)command.width, sourceImage.extent.width - command.sourceX);
+    const uint32_t sourceHeight = std::min((uint32_t)command.height, sourceImage.extent.height - command.sourceY);
+
+    // sRGB sources are decoded for unorm blocks, sRGB blocks keep the encoded values
+    const VkFormat blockFormat = destinationImage.format;
+    if (blockFormat == VK_FORMAT_BC1_RGB_SRGB_BLOCK || blockFormat == VK_FORMAT_BC1_RGBA_SRGB_BLOCK || blockFormat == VK_FORMAT_BC3_SRGB_BLOCK || blockFormat == VK_FORMAT_BC7_SRGB_BLOCK)
+        sourceFormat &= 3;
+
+    int texelBytes, blockWidth, blockHeight;
+    GetFormatBlockInfo(sourceImage.format, &texelBytes, &blockWidth, &blockHeight);
+    const VkDeviceSize inputSize = (VkDeviceSize)sourceWidth * sourceHeight * texelBytes;
+    const VkDeviceSize outputOffset = GetComputeOutputOffset(inputSize);
+    const VkDeviceSize outputSize = (VkDeviceSize)blocksWide * blocksHigh * GetBCBlockBytes(encoder);
+
+    UnityVulkanRecordingState recordingState;
+    if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
+        return;
+    VkBuffer buffer;
+    if (GetComputePipeline(kComputeCompress + encoder) == VK_NULL_HANDLE || !CreateComputeBuffer(outputOffset + outputSize, recordingState, &buffer))
+        return;
+
+    // Mirrors Params of compress.comp
+    const uint32_t constants[6] = { sourceWidth, sourceHeight, blocksWide, blocksHigh, (uint32_t)command.quality, (uint32_t)sourceFormat };
+
+    const VkRect2D sourceRect = { { command.sourceX, command.sourceY }, { sourceWidth, sourceHeight } };
+    const VkRect2D destinationRect = { { command.destinationX, command.destinationY }, { width, height } };
+    const VkBufferImageCopy sourceRegion = BufferImageRegion(0, 0, command.sourceLayer, sourceRect);
+    const VkBufferImageCopy destinationRegion = BufferImageRegion(outputOffset, blocksWide * 4, command.destinationLayer, destinationRect);
+    SyncTransferHazards(recordingState.commandBuffer, sourceImage.plugin, destinationImage.plugin);
+    vkCmdCopyImageToBuffer(recordingState.commandBuffer, sourceImage.image, sourceImage.layout, buffer, 1, &sourceRegion);
+    if (RecordComputeDispatch(kComputeCompress + encoder, buffer, 0, inputSize, outputOffset, outputSize, constants, sizeof(constants), blocksWide, blocksHigh, recordingState))
+        vkCmdCopyBufferToImage(recordingState.commandBuffer, buffer, destinationImage.image, destinationImage.layout, 1, &destinationRegion);
+}
+
+// Storage buffer for the pixels of a single compute command. It is retired right away so it goes away with the frame.
+bool RenderAPI_Vulkan::CreateComputeBuffer(VkDeviceSize size, const UnityVulkanRecordingState& recordingState, VkBuffer* outBuffer)
+{
+    VulkanBuffer buffer;
+    if (!CreateVulkanBuffer((size_t)size, &buffer, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT))
+        return false;
+    SafeDestroy(recordingState.currentFrameNumber, buffer);
+    *outBuffer = buffer.buffer;
+    return true;
+}
+
+// Offset of the output range following an input range of a compute buffer
+VkDeviceSize RenderAPI_Vulkan::GetComputeOutputOffset(VkDeviceSize inputSize)
+{
+    const VkDeviceSize alignment = std::max<VkDeviceSize>(m_DeviceProperties.limits.minStorageBufferOffsetAlignment, 16);
+    return (inputSize + alignment - 1) / alignment * alignment;
+}
+
+VkPipeline RenderAPI_Vulkan::GetComputePipeline(int shader)
+{
+    if (m_ComputePipelines[shader] != VK_NULL_HANDLE)
+        return m_ComputePipelines[shader];
+
+    if (m_ComputeSetLayout == VK_NULL_HANDLE)
+    {
+        VkDescriptorSetLayoutBinding bindings[2] = {};
+        for (uint32_t i = 0; i < 2; ++i)
+        {
+            bindings[i].binding = i;
+            bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            bindings[i].descriptorCount = 1;
+            bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        }
+        VkDescriptorSetLayoutCreateInfo setLayoutCreateInfo = {};
+        setLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        setLayoutCreateInfo.bindingCount = 2;
+        setLayoutCreateInfo.pBindings = bindings;
+        if (vkCreateDescriptorSetLayout(m_Instance.device, &setLayoutCreateInfo, NULL, &m_ComputeSetLayout) != VK_SUCCESS)
+        {
+            m_ComputeSetLayout = VK_NULL_HANDLE;
+            return VK_NULL_HANDLE;
+        }
+    }
+
+    if (m_ComputePipelineLayout == VK_NULL_HANDLE)
+    {
+        VkPushConstantRange pushConstantRange;
+        pushConstantRange.offset = 0;
+        pushConstantRange.size = kComputePushConstantBytes;
+        pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo = {};
+        pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipelineLayoutCreateInfo.setLayoutCount = 1;
+        pipelineLayoutCreateInfo.pSetLayouts = &m_ComputeSetLayout;
+        pipelineLayoutCreateInfo.pushConstantRangeCount = 1;
+        pipelineLayoutCreateInfo.pPushConstantRanges = &pushConstantRange;
+        if (vkCreatePipelineLayout(m_Instance.device, &pipelineLayoutCreateInfo, NULL, &m_ComputePipelineLayout) != VK_SUCCESS)
+        {
+            m_ComputePipelineLayout = VK_NULL_HANDLE;
+            return VK_NULL_HANDLE;
+        }
+    }
+
+    switch (shader)
+    {
+    case kComputeConvert:
+        m_ComputePipelines[shader] = CreateComputePipeline(m_Instance.device, m_ComputePipelineLayout, Shader::convertShaderSpirv, sizeof(Shader::convertShaderSpirv), NULL);
+        break;
+    case kComputeGenerate:
+        m_ComputePipelines[shader] = CreateComputePipeline(m_Instance.device, m_ComputePipelineLayout, Shader::generateShaderSpirv, sizeof(Shader::generateShaderSpirv), NULL);
+        break;
+    case kComputeCompress + kBCFormatBC1:
+    case kComputeCompress + kBCFormatBC3:
+    case kComputeCompress + kBCFormatBC7:
+        {
+            const uint32_t format = (uint32_t)(shader - kComputeCompress);
+            const VkSpecializationMapEntry entry = { 0, 0, sizeof(format) };
+            VkSpecializationInfo specialization;
+            specialization.mapEntryCount = 1;
+            specialization.pMapEntries = &entry;
+            specialization.dataSize = sizeof(format);
+            specialization.pData = &format;
+            m_ComputePipelines[shader] = CreateComputePipeline(m_Instance.device, m_ComputePipelineLayout, Shader::compressShaderSpirv, sizeof(Shader::compressShaderSpirv), &specialization);
+        }
+        break;
+    }
+    return m_ComputePipelines[shader];
+}
+
+// Descriptor set with both storage buffer bindings, valid for the current frame
+VkDescriptorSet RenderAPI_Vulkan::AllocateComputeSet(const UnityVulkanRecordingState& recordingState)
+{
+    for (int attempt = 0; attempt < 2; ++attempt)
+    {
+        if (m_DescriptorPool == VK_NULL_HANDLE)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_RetiredFramesMutex);
+                if (!m_FreeDescriptorPools.empty())
+                {
+                    m_DescriptorPool = m_FreeDescriptorPools.back();
+                    m_FreeDescriptorPools.pop_back();
+                }
+            }
+            if (m_DescriptorPool == VK_NULL_HANDLE)
+            {
+                const uint32_t kSetsPerPool = 64;
+                VkDescriptorPoolSize poolSize;
+                poolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                poolSize.descriptorCount = 2 * kSetsPerPool;
+                VkDescriptorPoolCreateInfo poolCreateInfo = {};
+                poolCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+                poolCreateInfo.maxSets = kSetsPerPool;
+                poolCreateInfo.poolSizeCount = 1;
+                poolCreateInfo.pPoolSizes = &poolSize;
+                if (vkCreateDescriptorPool(m_Instance.device, &poolCreateInfo, NULL, &m_DescriptorPool) != VK_SUCCESS)
+                {
+                    m_DescriptorPool = VK_NULL_HANDLE;
+                    return VK_NULL_HANDLE;
+                }
+            }
+        }
+
+        VkDescriptorSetAllocateInfo allocateInfo = {};
+        allocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocateInfo.descriptorPool = m_DescriptorPool;
+        allocateInfo.descriptorSetCount = 1;
+        allocateInfo.pSetLayouts = &m_ComputeSetLayout;
+        VkDescriptorSet set;
+        if (vkAllocateDescriptorSets(m_Instance.device, &allocateInfo, &set) == VK_SUCCESS)
+            return set;
+
+        // The pool is full, the sets in it may be used up to the current frame
+        std::lock_guard<std::mutex> lock(m_RetiredFramesMutex);
+        RetireFrame(recordingState.currentFrameNumber).descriptorPools.push_back(m_DescriptorPool);
+        m_DescriptorPool = VK_NULL_HANDLE;
+    }
+    return VK_NULL_HANDLE;
+}
+
+// Runs a compute shader with a thread per element of width x height. Binding 0 is the input range of buffer, filled by
+// the transfers recorded before, binding 1 the output range, read by the transfers recorded after. Returns false when
+// nothing was recorded.
+bool RenderAPI_Vulkan::RecordComputeDispatch(int shader, VkBuffer buffer, VkDeviceSize inputOffset, VkDeviceSize inputSize, VkDeviceSize outputOffset, VkDeviceSize outputSize, const void* constants, uint32_t constantBytes, uint32_t width, uint32_t height, const UnityVulkanRecordingState& recordingState)
+{
+    const VkPipeline pipeline = GetComputePipeline(shader);
+    if (pipeline == VK_NULL_HANDLE)
+        return false;
+    const VkDescriptorSet set = AllocateComputeSet(recordingState);
+    if (set == VK_NULL_HANDLE)
+        return false;
+
+    VkDescriptorBufferInfo bufferInfos[2];
+    bufferInfos[0].buffer = buffer;
+    bufferInfos[0].offset = inputOffset;
+    bufferInfos[0].range = inputSize;
+    bufferInfos[1].buffer = buffer;
+    bufferInfos[1].offset = outputOffset;
+    bufferInfos[1].range = outputSize;
+    VkWriteDescriptorSet write = {};
+    write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    write.dstSet = set;
+    write.dstBinding = 0;
+    write.descriptorCount = 2;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    write.pBufferInfo = bufferInfos;
+    vkUpdateDescriptorSets(m_Instance.device, 1, &write, 0, NULL);
+
+    VkCommandBuffer commandBuffer = recordingState.commandBuffer;
+    RecordMemoryBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT);
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_ComputePipelineLayout, 0, 1, &set, 0, NULL);
+    vkCmdPushConstants(commandBuffer, m_ComputePipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, constantBytes, constants);
+    vkCmdDispatch(commandBuffer, (width + kComputeGroupSize - 1) / kComputeGroupSize, (height + kComputeGroupSize - 1) / kComputeGroupSize, 1);
+    RecordMemoryBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT);
+    return true;
+}
+
+// Mirrors Params of generate.comp
+struct GenerateShaderConstants
+{
+    float colorA[4];
+    float colorB[4];
+    float points[4];
+    float cellSize;
+    float lacunarity;
+    float gain;
+    uint32_t generator;
+    uint32_t octaves;
+    uint32_t seed;
+    uint32_t x;
+    uint32_t y;
+    uint32_t width;
+    uint32_t height;
+    uint32_t format;
+};
+
+// The generate shader draws the pattern into a storage buffer, which is copied into the rectangle. Formats without a
+// texel format code, compressed ones included, are left as they are.
+void RenderAPI_Vulkan::GenerateTexture(void* texture, int layer, const DGGenerateParams& params)
+{
+    // cannot do resource uploads inside renderpass
+    m_UnityVulkan->EnsureOutsideRenderPass();
+    ++m_TransferBatch;
+
+    TransferImage image;
+    if (!AccessTransferImage(texture, true, &image) || (uint32_t)layer >= image.layers)
+        return;
+    const int format = GetComputeTexelFormat(image.format);
+    if (format < 0 || (uint32_t)params.x >= image.extent.width || (uint32_t)params.y >= image.extent.height)
+        return;
+    const uint32_t width = std::min((uint32_t)params.width, image.extent.width - params.x);
+    const uint32_t height = std::min((uint32_t)params.height, image.extent.height - params.y);
+
+    int texelBytes, blockWidth, blockHeight;
+    GetFormatBlockInfo(image.format, &texelBytes, &blockWidth, &blockHeight);
+    const VkDeviceSize size = (VkDeviceSize)width * height * texelBytes;
+
+    UnityVulkanRecordingState recordingState;
+    if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
+        return;
+    VkBuffer buffer;
+    if (!CreateComputeBuffer(size, recordingState, &buffer))
+        return;
+
+    GenerateShaderConstants constants;
+    memcpy(constants.colorA, params.colorA, sizeof(constants.colorA));
+    memcpy(constants.colorB, params.colorB, sizeof(constants.colorB));
+    constants.points[0] = params.start[0];
+    constants.points[1] = params.start[1];
+    constants.points[2] = params.end[0];
+    constants.points[3] = params.end[1];
+    constants.cellSize = params.cellSize;
+    constants.lacunarity = params.lacunarity;
+    constants.gain = params.gain;
+    constants.generator = (uint32_t)params.generator;
+    constants.octaves = (uint32_t)params.octaves;
+    constants.seed = params.seed;
+    constants.x = (uint32_t)params.x;
+    constants.y = (uint32_t)params.y;
+    constants.width = width;
+    constants.height = height;
+    constants.format = (uint32_t)format;
+
+    // Nothing is read, the output range is bound to both bindings
+    const VkRect2D rect = { { params.x, params.y }, { width, height } };
+    const VkBufferImageCopy region = BufferImageRegion(0, 0, layer, rect);
+    if (!RecordComputeDispatch(kComputeGenerate, buffer, 0, size, 0, size, &constants, sizeof(constants), width, height, recordingState))
+        return;
+    SyncTransferHazards(recordingState.commandBuffer, PluginImageTable::kNoSlot, image.plugin);
+    vkCmdCopyBufferToImage(recordingState.commandBuffer, buffer, image.image, image.layout, 1, &region);
+}
+
+// Image for the intermediate results of a single command, or the rectangle clears of a frame, in VK_IMAGE_LAYOUT_GENERAL
+// and ready for transfers. It is retired right away so it goes away with the frame, and never enters the texture pool.
+bool RenderAPI_Vulkan::CreateScratchImage(int width, int height, VkFormat format, const UnityVulkanRecordingState& recordingState, VkImage* outImage)
+{
+    UnityVulkanImage image;
+    DeviceMemoryBlock memory;
+    if (!CreateVulkanImage(width, height, format, 1, 1, VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT, &image, &memory))
+        return false;
+    const unsigned int slot = m_Images.Allocate();
+    if (slot == PluginImageTable::kNoSlot)
+    {
+        vkDestroyImage(m_Instance.device, image.image, NULL);
+        m_MemoryAllocator.Free(memory);
+        return false;
+    }
+    m_Images.Image(slot) = image.image;
+    m_Images.Memory(slot) = memory;
+
+    VkImageMemoryBarrier toGeneral;
+    toGeneral.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    toGeneral.pNext = NULL;
+    toGeneral.srcAccessMask = 0;
+    toGeneral.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+    toGeneral.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    toGeneral.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+    toGeneral.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    toGeneral.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    toGeneral.image = image.image;
+    toGeneral.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    toGeneral.subresourceRange.baseMipLevel = 0;
+    toGeneral.subresourceRange.levelCount = 1;
+    toGeneral.subresourceRange.baseArrayLayer = 0;
+    toGeneral.subresourceRange.layerCount = 1;
+    vkCmdPipelineBarrier(recordingState.commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, NULL, 0, NULL, 1, &toGeneral);
+
+    RetiredImage retired;
+    retired.slot = slot;
+    retired.recycle = false;
+    std::lock_guard<std::mutex> lock(m_RetiredFramesMutex);
+    RetireFrame(recordingState.currentFrameNumber).images.push_back(retired);
+
+    *outImage = image.image;
+    return true;
+}
+
+// Nearest neighbour scaling for formats vkCmdBlitImage can't handle, compressed ones included. Compute shaders can't
+// write those formats either, so the resample is done with copies: the sampled source columns go into a temporary image
+// first and its sampled rows into the destination after, one region per destination column and row. Compressed formats
+// are resampled in whole blocks. Both formats need the same block size.
+void RenderAPI_Vulkan::RecordResampleTexture(const TransferImage& source, int sourceLayer, const VkRect2D& sourceRect, const TransferImage& destination, int destinationLayer, const VkRect2D& destinationRect, const UnityVulkanRecordingState& recordingState)
+{
+    int blockBytes, blockWidth, blockHeight;
+    int destinationBlockBytes, destinationBlockWidth, destinationBlockHeight;
+    if (!GetFormatBlockInfo(source.format, &blockBytes, &blockWidth, &blockHeight) ||
+        !GetFormatBlockInfo(destination.format, &destinationBlockBytes, &destinationBlockWidth, &destinationBlockHeight) ||
+        blockBytes != destinationBlockBytes || blockWidth != destinationBlockWidth || blockHeight != destinationBlockHeight)
+        return;
+    if (sourceRect.offset.x % blockWidth != 0 || sourceRect.offset.y % blockHeight != 0 || destinationRect.offset.x % blockWidth != 0 || destinationRect.offset.y % blockHeight != 0)
+        return;
+
+    const uint32_t sourceColumns = (sourceRect.extent.width + blockWidth - 1) / blockWidth;
+    const uint32_t sourceRows = (sourceRect.extent.height + blockHeight - 1) / blockHeight;
+    const uint32_t columns = (destinationRect.extent.width + blockWidth - 1) / blockWidth;
+    const uint32_t rows = (destinationRect.extent.height + blockHeight - 1) / blockHeight;
+
+    VkImage scratch;
+    if (!CreateScratchImage((int)(columns * blockWidth), (int)(sourceRows * blockHeight), destination.format, recordingState, &scratch))
+        return;
+
+    SyncTransferHazards(recordingState.commandBuffer, source.plugin, destination.plugin);
+
+    // Sample at the center of every destination block
+    m_CopyRegions.resize(columns);
+    for (uint32_t i = 0; i < columns; ++i)
+    {
+        const uint32_t column = (2 * i + 1) * sourceColumns / (2 * columns);
+        VkImageCopy& region = m_CopyRegions[i];
+        region.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.srcSubresource.mipLevel = 0;
+        region.srcSubresource.baseArrayLayer = (uint32_t)sourceLayer;
+        region.srcSubresource.layerCount = 1;
+        region.dstSubresource = region.srcSubresource;
+        region.dstSubresource.baseArrayLayer = 0;
+        region.srcOffset.x = sourceRect.offset.x + (int32_t)(column * blockWidth);
+        region.srcOffset.y = sourceRect.offset.y;
+        region.srcOffset.z = 0;
+        region.dstOffset.x = (int32_t)(i * blockWidth);
+        region.dstOffset.y = 0;
+        region.dstOffset.z = 0;
+        region.extent.width = (uint32_t)blockWidth;
+        region.extent.height = sourceRows * blockHeight;
+        region.extent.depth = 1;
+    }
+    vkCmdCopyImage(recordingState.commandBuffer, source.image, source.layout, scratch, VK_IMAGE_LAYOUT_GENERAL, columns, m_CopyRegions.data());
+    RecordTransferBarrier(recordingState.commandBuffer);
+
+    m_CopyRegions.resize(rows);
+    for (uint32_t i = 0; i < rows; ++i)
+    {
+        const uint32_t row = (2 * i + 1) * sourceRows / (2 * rows);
+        VkImageCopy& region = m_CopyRegions[i];
+        region.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.srcSubresource.mipLevel = 0;
+        region.srcSubresource.baseArrayLayer = 0;
+        region.srcSubresource.layerCount = 1;
+        region.dstSubresource = region.srcSubresource;
+        region.dstSubresource.baseArrayLayer = (uint32_t)destinationLayer;
+        region.srcOffset.x = 0;
+        region.srcOffset.y = (int32_t)(row * blockHeight);
+        region.srcOffset.z = 0;
+        region.dstOffset.x = destinationRect.offset.x;
+        region.dstOffset.y = destinationRect.offset.y + (int32_t)(i * blockHeight);
+        region.dstOffset.z = 0;
+        region.extent.width = columns * blockWidth;
+        region.extent.height = (uint32_t)blockHeight;
+        region.extent.depth = 1;
+    }
+    vkCmdCopyImage(recordingState.commandBuffer, scratch, VK_IMAGE_LAYOUT_GENERAL, destination.image, destination.layout, rows, m_CopyRegions.data());
+}
+
+void RenderAPI_Vulkan::GenerateMips(void* texture)
+{
+    // cannot do resource uploads inside renderpass
+    m_UnityVulkan->EnsureOutsideRenderPass();
+    ++m_TransferBatch;
+
+    RecordGenerateMips(&texture, 1);
+}
+
+// Every level of the image ends up in one layout usable as blit source and destination. Plugin images already are in
+// VK_IMAGE_LAYOUT_GENERAL, images owned by Unity are moved there through AccessTexture. Fails for images without
+// lower levels and for formats that can't be blitted, such as compressed ones.
+bool RenderAPI_Vulkan::AccessMipChainImage(void* texture, VkCommandBuffer commandBuffer, MipChainImage* outImage)
+{
+    const unsigned int plugin = FindPluginImage(texture);
+    VkFormat format;
+    if (plugin != PluginImageTable::kNoSlot)
+    {
+        TransferImage transferImage;
+        if (m_Images.MipLevels(plugin) <= 1 || !AccessTransferImage(texture, true, &transferImage))
+            return false;
+
+        outImage->image = transferImage.image;
+        outImage->layout = transferImage.layout;
+        outImage->extent = transferImage.extent;
+        outImage->mipLevels = m_Images.MipLevels(plugin);
+        format = transferImage.format;
+    }
+    else
+    {
+        UnityVulkanImage image;
+        if (!m_UnityVulkan->AccessTexture(texture, UnityVulkanWholeImage, VK_IMAGE_LAYOUT_UNDEFINED, 0, 0, kUnityVulkanResourceAccess_ObserveOnly, &image) || image.mipCount <= 1)
+            return false;
+        if (!m_UnityVulkan->AccessTexture(texture, UnityVulkanWholeImage, VK_IMAGE_LAYOUT_GENERAL, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT, kUnityVulkanResourceAccess_PipelineBarrier, &image))
+            return false;
+
+        outImage->image = image.image;
+        outImage->layout = VK_IMAGE_LAYOUT_GENERAL;
+        outImage->extent = image.extent;
+        outImage->mipLevels = (uint32_t)image.mipCount;
+        format = image.format;
+    }
+
+    const VkFormatFeatureFlags features = GetFormatFeatures(format);
+    const VkFormatFeatureFlags blitFeatures = VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT;
+    if ((features & blitFeatures) != blitFeatures)
+        return false;
+
+    outImage->filter = (features & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT) != 0 ? VK_FILTER_LINEAR : VK_FILTER_NEAREST;
+    SyncTransferHazards(commandBuffer, plugin, plugin);
+    return true;
+}
+
+// Each level is blitted from the one above it. All images advance one level at a time, so a single barrier per level
+// orders the next blits of every image and a batch costs as many barriers as its longest chain has levels.
+void RenderAPI_Vulkan::RecordGenerateMips(void* const* textures, int count)
+{
+    UnityVulkanRecordingState recordingState;
+    if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
+        return;
+
+    m_MipChainImages.clear();
+    uint32_t levelCount = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        MipChainImage image;
+        if (!AccessMipChainImage(textures[i], recordingState.commandBuffer, &image))
+            continue;
+        m_MipChainImages.push_back(image);
+        if (image.mipLevels > levelCount)
+            levelCount = image.mipLevels;
+    }
+
+    for (uint32_t level = 1; level < levelCount; ++level)
+    {
+        if (level > 1)
+        {
+            VkMemoryBarrier barrier;
+            barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            barrier.pNext = NULL;
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            vkCmdPipelineBarrier(recordingState.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0, NULL, 0, NULL);
+        }
+
+        for (size_t i = 0; i < m_MipChainImages.size(); ++i)
+        {
+            const MipChainImage& image = m_MipChainImages[i];
+            if (level >= image.mipLevels)
+                continue;
+
+            VkImageBlit blit;
+            blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            blit.srcSubresource.mipLevel = level - 1;
+            blit.srcSubresource.baseArrayLayer = 0;
+            blit.srcSubresource.layerCount = 1;
+            blit.srcOffsets[0].x = 0;
+            blit.srcOffsets[0].y = 0;
+            blit.srcOffsets[0].z = 0;
+            blit.srcOffsets[1].x = (int32_t)std::max(image.extent.width >> (level - 1), 1u);
+            blit.srcOffsets[1].y = (int32_t)std::max(image.extent.height >> (level - 1), 1u);
+            blit.srcOffsets[1].z = 1;
+            blit.dstSubresource = blit.srcSubresource;
+            blit.dstSubresource.mipLevel = level;
+            blit.dstOffsets[0] = blit.srcOffsets[0];
+            blit.dstOffsets[1].x = (int32_t)std::max(image.extent.width >> level, 1u);
+            blit.dstOffsets[1].y = (int32_t)std::max(image.extent.height >> level, 1u);
+            blit.dstOffsets[1].z = 1;
+            vkCmdBlitImage(recordingState.commandBuffer, image.image, image.layout, image.image, image.layout, 1, &blit, image.filter);
+        }
+    }
+}
+
+bool RenderAPI_Vulkan::GetTextureSize(void* texture, int* outWidth, int* outHeight)
+{
+    UnityVulkanImage image;
+    if (!m_UnityVulkan->AccessTexture(texture, UnityVulkanWholeImage, VK_IMAGE_LAYOUT_UNDEFINED, 0, 0, kUnityVulkanResourceAccess_ObserveOnly, &image))
+        return false;
+
+    *outWidth = (int)image.extent.width;
+    *outHeight = (int)image.extent.height;
+    return true;
+}
+
+bool RenderAPI_Vulkan::GetTextureFormat(void* texture, VkFormat* outFormat)
+{
+    const unsigned int plugin = FindPluginImage(texture);
+    if (plugin != PluginImageTable::kNoSlot)
+    {
+        *outFormat = m_Images.Format(plugin);
+        return true;
+    }
+
+    UnityVulkanImage image;
+    if (!m_UnityVulkan->AccessTexture(texture, UnityVulkanWholeImage, VK_IMAGE_LAYOUT_UNDEFINED, 0, 0, kUnityVulkanResourceAccess_ObserveOnly, &image))
+        return false;
+    *outFormat = image.format;
+    return true;
+}
+
+// All CPU uploads are written straight into one persistently mapped ring. Its space is reclaimed once the frame that
+// copied out of it is safe, so uploading never creates or destroys buffers unless an upload is larger than the whole ring.
+static const VkDeviceSize kUploadRingSize = 32 * 1024 * 1024;
+
+void* RenderAPI_Vulkan::AllocateUpload(void* texture, int width, int height, int* outRowPitch)
+{
+    VkFormat format;
+    int blockBytes, blockWidth, blockHeight;
+    if (width <= 0 || height <= 0 || !GetTextureFormat(texture, &format) || !GetFormatBlockInfo(format, &blockBytes, &blockWidth, &blockHeight))
+        return NULL;
+
+    const int rowPitch = ((width + blockWidth - 1) / blockWidth) * blockBytes;
+    const int size = rowPitch * ((height + blockHeight - 1) / blockHeight);
+
+    UnityVulkanRecordingState recordingState;
+    if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
+        return NULL;
+    m_UploadRing.Reclaim(recordingState.safeFrameNumber);
+
+    if (m_UploadRing.Buffer().buffer == VK_NULL_HANDLE || (VkDeviceSize)size > m_UploadRing.Buffer().sizeInBytes)
+    {
+        VkDeviceSize ringSize = kUploadRingSize;
+        while (ringSize < (VkDeviceSize)size)
+            ringSize *= 2;
+
+        VulkanBuffer buffer;
+        if (!CreateVulkanBuffer(ringSize, &buffer, VK_BUFFER_USAGE_TRANSFER_SRC_BIT))
+            return NULL;
+
+        // Uploads still in flight keep reading the old ring until this frame is done
+        if (m_UploadRing.Buffer().buffer != VK_NULL_HANDLE)
+            SafeDestroy(recordingState.currentFrameNumber, m_UploadRing.Buffer());
+        m_UploadRing.Reset(buffer);
+        m_Uploads.clear();
+    }
+
+    Upload upload;
+    upload.size = size;
+    // bufferOffset has to be a multiple of the texel block size and 4
+    if (!m_UploadRing.Allocate(size, blockBytes * 4, &upload.offset, &upload.allocation))
+        return NULL;
+
+    void* dataPtr = (unsigned char*)m_UploadRing.Buffer().mapped + upload.offset;
+    m_Uploads[dataPtr] = upload;
+    *outRowPitch = rowPitch;
+    return dataPtr;
+}
+
+bool RenderAPI_Vulkan::RecordUpload(void* texture, int layer, int x, int y, int width, int height, int rowPitch, void* dataPtr)
+{
+    const VkRect2D rect = { { x, y }, { (uint32_t)width, (uint32_t)height } };
+    return RecordUploadRects(texture, layer, &rect, 1, rowPitch, dataPtr, height);
+}
+
+// The first bandHeight rows of dataPtr are copied over and over down every rectangle with a single vkCmdCopyBufferToImage
+bool RenderAPI_Vulkan::RecordUploadRects(void* texture, int layer, const VkRect2D* rects, int count, int rowPitch, void* dataPtr, int bandHeight)
+{
+    std::unordered_map<void*, Upload>::iterator it = m_Uploads.find(dataPtr);
+    if (it == m_Uploads.end())
+        return false;
+    const Upload upload = it->second;
+    m_Uploads.erase(it);
+
+    const VulkanBuffer& buffer = m_UploadRing.Buffer();
+    if ((buffer.deviceMemoryFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == 0)
+    {
+        // Offsets must be multiples of nonCoherentAtomSize, which is at most 256
+        const VkDeviceSize begin = upload.offset / 256 * 256;
+        const VkDeviceSize end = (upload.offset + upload.size + 255) / 256 * 256;
+
+        VkMappedMemoryRange range;
+        range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        range.pNext = NULL;
+        range.memory = buffer.deviceMemory;
+        range.offset = begin;
+        range.size = end >= buffer.deviceMemorySize ? VK_WHOLE_SIZE : end - begin;
+        vkFlushMappedMemoryRanges(m_Instance.device, 1, &range);
+    }
+
+    // cannot do resource uploads inside renderpass
+    m_UnityVulkan->EnsureOutsideRenderPass();
+    ++m_TransferBatch;
+
+    TransferImage image;
+    int blockBytes, blockWidth, blockHeight;
+    UnityVulkanRecordingState recordingState;
+    bool valid = AccessTransferImage(texture, true, &image) && (uint32_t)layer < image.layers &&
+        GetFormatBlockInfo(image.format, &blockBytes, &blockWidth, &blockHeight) && rowPitch % blockBytes == 0 && bandHeight > 0 &&
+        m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare);
+    for (int i = 0; valid && i < count; ++i)
+        valid = rects[i].offset.x + rects[i].extent.width <= image.extent.width && rects[i].offset.y + rects[i].extent.height <= image.extent.height;
+    if (!valid)
+    {
+        m_UploadRing.Release(upload.allocation);
+        return false;
+    }
+
+    m_UploadRegions.clear();
+    for (int i = 0; i < count; ++i)
+    {
+        for (uint32_t bandY = 0; bandY < rects[i].extent.height; bandY += (uint32_t)bandHeight)
+        {
+            VkBufferImageCopy region;
+            region.bufferOffset = upload.offset;
+            region.bufferRowLength = rowPitch / blockBytes * blockWidth;
+            region.bufferImageHeight = 0;
+            region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            region.imageSubresource.mipLevel = 0;
+            region.imageSubresource.baseArrayLayer = (uint32_t)layer;
+            region.imageSubresource.layerCount = 1;
+            region.imageOffset.x = rects[i].offset.x;
+            region.imageOffset.y = rects[i].offset.y + (int32_t)bandY;
+            region.imageOffset.z = 0;
+            region.imageExtent.width = rects[i].extent.width;
+            region.imageExtent.height = std::min((uint32_t)bandHeight, rects[i].extent.height - bandY);
+            region.imageExtent.depth = 1;
+            m_UploadRegions.push_back(region);
+        }
+    }
+
+    SyncTransferHazards(recordingState.commandBuffer, PluginImageTable::kNoSlot, image.plugin);
+    vkCmdCopyBufferToImage(recordingState.commandBuffer, buffer.buffer, image.image, image.layout, (uint32_t)m_UploadRegions.size(), m_UploadRegions.data());
+
+    m_UploadRing.Retire(upload.allocation, recordingState.currentFrameNumber);
+    return true;
+}
+
+bool RenderAPI_Vulkan::UploadTexture(void* texture, int layer, int x, int y, int width, int height, const void* data, int dataRowPitch)
+{
+    int rowPitch;
+    unsigned char* dataPtr = (unsigned char*)AllocateUpload(texture, width, height, &rowPitch);
+    if (dataPtr == NULL)
+        return false;
+
+    const int rowCount = m_Uploads[dataPtr].size / rowPitch;
+    const int copyPitch = dataRowPitch < rowPitch ? dataRowPitch : rowPitch;
+    for (int row = 0; row < rowCount; ++row)
+        memcpy(dataPtr + row * rowPitch, (const unsigned char*)data + row * dataRowPitch, copyPitch);
+
+    return RecordUpload(texture, layer, x, y, width, height, rowPitch, dataPtr);
+}
+
+bool RenderAPI_Vulkan::UploadCompressedTexture(void* texture, int layer, int x, int y, int width, int height, const void* rgba, int rgbaRowPitch, int quality)
+{
+    const int format = GetTextureBCFormat(texture);
+    if (format < 0)
+        return false;
+
+    int rowPitch;
+    unsigned char* dataPtr = (unsigned char*)AllocateUpload(texture, width, height, &rowPitch);
+    if (dataPtr == NULL)
+        return false;
+
+    // The encoder threads write their rows of blocks straight into the upload ring
+    EncodeBCBlocks(format, quality, (const unsigned char*)rgba, width, height, rgbaRowPitch, dataPtr, rowPitch);
+    return RecordUpload(texture, layer, x, y, width, height, rowPitch, dataPtr);
+}
+
+int RenderAPI_Vulkan::GetTextureBCFormat(void* texture)
+{
+    VkFormat format;
+    if (!GetTextureFormat(texture, &format))
+        return -1;
+    return GetBCFormat(format);
+}
+
+bool RenderAPI_Vulkan::GetTextureBlockInfo(void* texture, int* outBlockBytes, int* outBlockWidth, int* outBlockHeight)
+{
+    VkFormat format;
+    return GetTextureFormat(texture, &format) && GetFormatBlockInfo(format, outBlockBytes, outBlockWidth, outBlockHeight);
+}
+
+// Readbacks share one HOST_CACHED staging ring. A readback that does not fit gets a buffer of its own.
+static const VkDeviceSize kReadbackRingSize = 16 * 1024 * 1024;
+
+bool RenderAPI_Vulkan::RecordReadback(int ticket, void* texture, int x, int y, int width, int height)
+{
+    // cannot do resource uploads inside renderpass
+    m_UnityVulkan->EnsureOutsideRenderPass();
+    ++m_TransferBatch;
+
+    TransferImage sourceImage;
+    if (!AccessTransferImage(texture, false, &sourceImage))
+        return false;
+
+    int blockBytes, blockWidth, blockHeight;
+    if (!GetFormatBlockInfo(sourceImage.format, &blockBytes, &blockWidth, &blockHeight))
+        return false;
+    if ((uint32_t)(x + width) > sourceImage.extent.width || (uint32_t)(y + height) > sourceImage.extent.height)
+        return false;
+    if (x % blockWidth != 0 || y % blockHeight != 0)
+        return false;
+
+    const int size = ((width + blockWidth - 1) / blockWidth) * ((height + blockHeight - 1) / blockHeight) * blockBytes;
+
+    if (m_ReadbackRing.Buffer().buffer == VK_NULL_HANDLE)
+    {
+        VulkanBuffer buffer;
+        if (CreateVulkanBuffer(kReadbackRingSize, &buffer, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_CACHED_BIT))
+            m_ReadbackRing.Reset(buffer);
+    }
+
+    Readback readback;
+    readback.dedicated = VulkanBuffer();
+    readback.size = size;
+    // bufferOffset has to be a multiple of the texel block size and 4
+    if (!m_ReadbackRing.Allocate(size, blockBytes * 4, &readback.offset, &readback.allocation))
+    {
+        readback.offset = 0;
+        if (!CreateVulkanBuffer(size, &readback.dedicated, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_CACHED_BIT))
+            return false;
+    }
+    const VulkanBuffer& buffer = readback.dedicated.buffer != VK_NULL_HANDLE ? readback.dedicated : m_ReadbackRing.Buffer();
+
+    UnityVulkanRecordingState recordingState;
+    if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
+    {
+        if (readback.dedicated.buffer != VK_NULL_HANDLE)
+            ImmediateDestroyVulkanBuffer(readback.dedicated);
+        else
+            m_ReadbackRing.Release(readback.allocation);
+        return false;
+    }
+
+    VkBufferImageCopy region;
+    region.bufferOffset = readback.offset;
+    region.bufferRowLength = 0;
+    region.bufferImageHeight = 0;
+    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.mipLevel = 0;
+    region.imageSubresource.baseArrayLayer = 0;
+    region.imageSubresource.layerCount = 1;
+    region.imageOffset.x = x;
+    region.imageOffset.y = y;
+    region.imageOffset.z = 0;
+    region.imageExtent.width = width;
+    region.imageExtent.height = height;
+    region.imageExtent.depth = 1;
+
+    SyncTransferHazards(recordingState.commandBuffer, sourceImage.plugin, PluginImageTable::kNoSlot);
+    vkCmdCopyImageToBuffer(recordingState.commandBuffer, sourceImage.image, sourceImage.layout, buffer.buffer, 1, &region);
+
+    // Make the copy visible to the host once the frame fence has been waited on
+    VkMemoryBarrier barrier;
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.pNext = NULL;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    vkCmdPipelineBarrier(recordingState.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 1, &barrier, 0, NULL, 0, NULL);
+
+    readback.frameNumber = recordingState.currentFrameNumber;
+    m_Readbacks[ticket] = readback;
+    return true;
+}
+
+int RenderAPI_Vulkan::PollReadback(int ticket, const void** outData)
+{
+    std::unordered_map<int, Readback>::iterator it = m_Readbacks.find(ticket);
+    if (it == m_Readbacks.end())
+        return -1;
+
+    UnityVulkanRecordingState recordingState;
+    if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
+        return 0;
+    if (it->second.frameNumber > recordingState.safeFrameNumber)
+        return 0;
+
+    const Readback& readback = it->second;
+    const VulkanBuffer& buffer = readback.dedicated.buffer != VK_NULL_HANDLE ? readback.dedicated : m_ReadbackRing.Buffer();
+    if ((buffer.deviceMemoryFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == 0)
+    {
+        // Offsets must be multiples of nonCoherentAtomSize, which is at most 256
+        const VkDeviceSize begin = readback.offset / 256 * 256;
+        const VkDeviceSize end = (readback.offset + readback.size + 255) / 256 * 256;
+
+        VkMappedMemoryRange range;
+        range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        range.pNext = NULL;
+        range.memory = buffer.deviceMemory;
+        range.offset = begin;
+        range.size = end >= buffer.deviceMemorySize ? VK_WHOLE_SIZE : end - begin;
+        vkInvalidateMappedMemoryRanges(m_Instance.device, 1, &range);
+    }
+
+    *outData = (const unsigned char*)buffer.mapped + readback.offset;
+    return readback.size;
+}
+
+void RenderAPI_Vulkan::ReleaseReadback(int ticket)
+{
+    std::unordered_map<int, Readback>::iterator it = m_Readbacks.find(ticket);
+    if (it == m_Readbacks.end())
+        return;
+
+    if (it->second.dedicated.buffer != VK_NULL_HANDLE)
+    {
+        UnityVulkanRecordingState recordingState;
+        if (m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
+            SafeDestroy(recordingState.currentFrameNumber, it->second.dedicated);
+        else
+            ImmediateDestroyVulkanBuffer(it->second.dedicated);
+    }
+    else
+    {
+        m_ReadbackRing.Release(it->second.allocation);
+    }
+    m_Readbacks.erase(it);
 }
 
 #endif // #if SUPPORT_VULKAN
@@ -2,66 +2,1654 @@
 
 #include "PlatformBase.h"
 #include "RenderAPI.h"
+#include "BlockCompression.h"
 
 #include <assert.h>
+#include <limits.h>
 #include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 using namespace std;
 
 static RenderAPI* s_CurrentAPI = NULL;
 
-static int m_TextureCount = 0;
-static vector<int> m_FreeTextureIndexs;
-static int m_FreeIndexCount = 0;
+// --------------------------------------------------------------------------
+// Texture handles
+// Textures are referred to by 32-bit handles: the backend texture index in the low kTextureIndexBits bits and the
+// generation of that index above it. Destroying a texture bumps the generation, so a stale handle no longer matches
+// its slot and is rejected with one load instead of reaching the backend. Free indices are kept on a lock-free stack
+// whose head carries an ABA tag. Handles are always positive, -1 means creation failed.
+// Create, destroy and GetNativeTexturePointer may be called from any thread. Every thread keeps a few free indices of
+// its own so job threads creating and destroying textures in a loop rarely touch the shared stack.
+
+static const int kMaxTextures = 1 << kTextureIndexBits;
+static const uint32_t kTextureIndexMask = kMaxTextures - 1;
+static const uint32_t kTextureGenerationMask = (1u << (31 - kTextureIndexBits)) - 1;
+
+// Per index: generation << 1 | alive. Generations start at 1 so 0 is never a valid handle.
+static std::atomic<uint32_t> s_TextureSlotState[kMaxTextures];
+// Free stack links, index + 1 of the next free index with 0 ending the stack
+static std::atomic<uint32_t> s_FreeTextureNext[kMaxTextures];
+// Free stack head, index + 1 of the top in the low 32 bits and a tag bumped on every change in the high 32 bits
+static std::atomic<uint64_t> s_FreeTextureHead(0);
+// Indices that have never been handed out start here
+static std::atomic<uint32_t> s_FreshTextureIndex(0);
+// Bumped by ResetTextureHandles, indices cached by a thread under an older epoch belong to a destroyed device
+static std::atomic<uint32_t> s_TextureHandleEpoch(0);
+
+static void PushFreeTextureIndex(uint32_t index);
+
+// Free indices owned by one thread. Whatever is left when the thread exits goes back to the shared stack.
+struct TextureIndexCache
+{
+	static const int kCapacity = 32;
+
+	uint32_t indices[kCapacity];
+	int count;
+	uint32_t epoch;
+
+	TextureIndexCache() : count(0), epoch(0) {}
+	~TextureIndexCache()
+	{
+		if (epoch == s_TextureHandleEpoch.load(std::memory_order_acquire))
+		{
+			for (int i = 0; i < count; ++i)
+				PushFreeTextureIndex(indices[i]);
+		}
+		count = 0;
+	}
+
+	// Drops indices cached before the last device reset
+	void Validate()
+	{
+		const uint32_t current = s_TextureHandleEpoch.load(std::memory_order_acquire);
+		if (epoch != current)
+		{
+			epoch = current;
+			count = 0;
+		}
+	}
+};
+
+static thread_local TextureIndexCache t_TextureIndexCache;
+
+static inline int MakeTextureHandle(uint32_t index, uint32_t generation)
+{
+	return (int)((generation << kTextureIndexBits) | index);
+}
+
+static inline uint32_t TextureHandleIndex(int handle)
+{
+	return (uint32_t)handle & kTextureIndexMask;
+}
+
+static bool IsTextureAlive(int handle)
+{
+	if (handle <= 0)
+		return false;
+	const uint32_t index = TextureHandleIndex(handle);
+	const uint32_t generation = (uint32_t)handle >> kTextureIndexBits;
+	return s_TextureSlotState[index].load(std::memory_order_acquire) == ((generation << 1) | 1);
+}
+
+static void PushFreeTextureIndex(uint32_t index)
+{
+	uint64_t head = s_FreeTextureHead.load(std::memory_order_relaxed);
+	uint64_t newHead;
+	do
+	{
+		s_FreeTextureNext[index].store((uint32_t)head, std::memory_order_relaxed);
+		newHead = (((head >> 32) + 1) << 32) | (index + 1);
+	} while (!s_FreeTextureHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+}
+
+static bool PopFreeTextureIndex(uint32_t* outIndex)
+{
+	uint64_t head = s_FreeTextureHead.load(std::memory_order_acquire);
+	while ((uint32_t)head != 0)
+	{
+		const uint32_t index = (uint32_t)head - 1;
+		const uint64_t newHead = (((head >> 32) + 1) << 32) | s_FreeTextureNext[index].load(std::memory_order_relaxed);
+		if (s_FreeTextureHead.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire))
+		{
+			*outIndex = index;
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool TakeTextureIndex(uint32_t* outIndex)
+{
+	TextureIndexCache& cache = t_TextureIndexCache;
+	cache.Validate();
+	if (cache.count > 0)
+	{
+		*outIndex = cache.indices[--cache.count];
+		return true;
+	}
+	return PopFreeTextureIndex(outIndex);
+}
+
+static void ReturnTextureIndex(uint32_t index)
+{
+	TextureIndexCache& cache = t_TextureIndexCache;
+	cache.Validate();
+	if (cache.count < TextureIndexCache::kCapacity)
+	{
+		cache.indices[cache.count++] = index;
+		return;
+	}
+
+	// Hand half of the cache back so the next few destroys stay local too
+	for (int i = TextureIndexCache::kCapacity / 2; i < TextureIndexCache::kCapacity; ++i)
+		PushFreeTextureIndex(cache.indices[i]);
+	cache.count = TextureIndexCache::kCapacity / 2;
+	cache.indices[cache.count++] = index;
+}
+
+// Index for a new texture, from this thread's cache, the shared stack or never used indices in that order
+static bool AcquireTextureIndex(uint32_t* outIndex)
+{
+	if (TakeTextureIndex(outIndex))
+		return true;
+
+	const uint32_t index = s_FreshTextureIndex.fetch_add(1, std::memory_order_relaxed);
+	if (index >= (uint32_t)kMaxTextures)
+	{
+		s_FreshTextureIndex.fetch_sub(1, std::memory_order_relaxed);
+		return false;
+	}
+	*outIndex = index;
+	return true;
+}
+
+// Marks the index alive once the backend created its texture and returns the handle for it
+static int PublishTextureHandle(uint32_t index)
+{
+	uint32_t generation = s_TextureSlotState[index].load(std::memory_order_relaxed) >> 1;
+	if (generation == 0)
+		generation = 1;
+	s_TextureSlotState[index].store((generation << 1) | 1, std::memory_order_release);
+	return MakeTextureHandle(index, generation);
+}
+
+// Marks the texture of handle dead. Only one caller wins the swap, destroying a stale handle or the same handle twice
+// returns false. The index must be handed to ReturnTextureIndex once the backend destroyed its texture.
+static bool RetireTextureHandle(int handle, uint32_t* outIndex)
+{
+	if (handle <= 0)
+		return false;
+
+	const uint32_t index = TextureHandleIndex(handle);
+	const uint32_t generation = (uint32_t)handle >> kTextureIndexBits;
+	uint32_t alive = (generation << 1) | 1;
+	uint32_t nextGeneration = (generation + 1) & kTextureGenerationMask;
+	if (nextGeneration == 0)
+		nextGeneration = 1;
+	if (!s_TextureSlotState[index].compare_exchange_strong(alive, nextGeneration << 1, std::memory_order_acq_rel))
+		return false;
+
+	*outIndex = index;
+	return true;
+}
+
+// Turns the mip count passed to the exports into what the backends expect, see DGTextureDesc::mipCount
+static int ResolveMipCount(int width, int height, int mipCount)
+{
+	const int fullCount = FullMipCount(width, height);
+	if (mipCount < 0 || mipCount > fullCount)
+		return fullCount;
+	return mipCount > 1 ? mipCount : 1;
+}
+
+static int CreateTextureInternal(int width, int height, int format, int mipCount)
+{
+	uint32_t index;
+	if (!AcquireTextureIndex(&index))
+		return -1;
+
+	if (!s_CurrentAPI->CreateTexture(width, height, format, ResolveMipCount(width, height, mipCount), (int)index) || s_CurrentAPI->GetTexturePointer((int)index) == nullptr)
+	{
+		//Texture creation failed
+		ReturnTextureIndex(index);
+		return -1;
+	}
+
+	return PublishTextureHandle(index);
+}
+
+static void DestroyTextureInternal(int handle)
+{
+	uint32_t index;
+	if (!RetireTextureHandle(handle, &index))
+		return;
+
+	s_CurrentAPI->DestroyTexture((int)index);
+	ReturnTextureIndex(index);
+}
+
+// Marks every texture of the old device dead and forgets the free indices, including the ones cached by threads.
+// Generations are kept so handles of the old device stay stale after indices are handed out again.
+static void ResetTextureHandles()
+{
+	s_TextureHandleEpoch.fetch_add(1, std::memory_order_acq_rel);
+	const uint32_t used = s_FreshTextureIndex.load(std::memory_order_acquire);
+	for (uint32_t i = 0; i < used && i < (uint32_t)kMaxTextures; ++i)
+	{
+		const uint32_t state = s_TextureSlotState[i].load(std::memory_order_relaxed);
+		if (state & 1)
+		{
+			uint32_t nextGeneration = ((state >> 1) + 1) & kTextureGenerationMask;
+			if (nextGeneration == 0)
+				nextGeneration = 1;
+			s_TextureSlotState[i].store(nextGeneration << 1, std::memory_order_relaxed);
+		}
+	}
+	s_FreeTextureHead.store(0, std::memory_order_relaxed);
+	s_FreshTextureIndex.store(0, std::memory_order_release);
+}
+
+// Copies the rowCount rows of dataRowPitch bytes the backend reads into memory owned by outCommand, which is released by
+// ReleaseCommandData once the render thread has recorded it. The callers check that data holds that many bytes.
+static void FillUploadCommand(int type, void* textureHandle, int layer, int x, int y, int width, int height, const void* data, int rowCount, int dataRowPitch, DGCommand* outCommand)
+{
+	const size_t size = (size_t)dataRowPitch * rowCount;
+	unsigned char* copy = new unsigned char[size];
+	memcpy(copy, data, size);
+
+	memset(outCommand, 0, sizeof(DGCommand));
+	outCommand->type = type;
+	outCommand->destination = textureHandle;
+	outCommand->destinationLayer = layer;
+	outCommand->destinationX = x;
+	outCommand->destinationY = y;
+	outCommand->width = width;
+	outCommand->height = height;
+	outCommand->data = copy;
+	outCommand->dataRowPitch = dataRowPitch;
+}
+
+// Releases the memory a queued command owns once the render thread is done with it
+static void ReleaseCommandData(const DGCommand& command)
+{
+	if (command.type == kDGCommandUpload || command.type == kDGCommandUploadCompressed)
+		delete[] (unsigned char*)command.data;
+	else if (command.type == kDGCommandGenerate)
+		delete (DGGenerateParams*)command.data;
+}
+
+// Fills outCommand with a kDGCommandUpload of CPU pixel data into a rectangle of an array layer of textureHandle. Rows of
+// data are dataRowPitch bytes apart, compressed formats are uploaded as rows of blocks. dataRowPitch must hold a row of
+// width pixels and dataSize every row the rectangle covers, when the backend knows the texture format. The rows are copied
+// into memory the plugin owns until the queued command is recorded on the render thread, so the caller may reuse data
+// right away. Returns 1 on success and 0 when the arguments are invalid.
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API CreateUploadCommand(void* textureHandle, int layer, int x, int y, int width, int height, const void* data, int dataSize, int dataRowPitch, DGCommand* outCommand)
+{
+	if (s_CurrentAPI == NULL || textureHandle == NULL || data == NULL || outCommand == NULL || layer < 0 || x < 0 || y < 0 || width <= 0 || height <= 0 || dataSize <= 0 || dataRowPitch <= 0)
+		return 0;
+
+	// Backends read one row of data per row of blocks
+	int blockBytes = 0, blockWidth = 1, blockHeight = 1;
+	if (s_CurrentAPI->GetTextureBlockInfo(textureHandle, &blockBytes, &blockWidth, &blockHeight) &&
+		(int64_t)dataRowPitch < (int64_t)(width + blockWidth - 1) / blockWidth * blockBytes)
+		return 0;
+	const int rowCount = (height + blockHeight - 1) / blockHeight;
+	if ((int64_t)dataSize < (int64_t)rowCount * dataRowPitch)
+		return 0;
+
+	FillUploadCommand(kDGCommandUpload, textureHandle, layer, x, y, width, height, data, rowCount, dataRowPitch, outCommand);
+	return 1;
+}
+
+// Fills outCommand with a kDGCommandUploadCompressed of RGBA32 pixels into a rectangle of an array layer of a BC1, BC3 or
+// BC7 texture. The pixels are copied like CreateUploadCommand does and encoded into blocks on the render thread.
+// x and y must be multiples of 4 and rgbaSize at least height rows of rgbaRowPitch bytes, quality is a DGCompressQuality.
+// Returns 1 on success and 0 when the arguments are invalid.
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API CreateCompressedUploadCommand(void* textureHandle, int layer, int x, int y, int width, int height, const void* rgba, int rgbaSize, int rgbaRowPitch, int quality, DGCommand* outCommand)
+{
+	if (s_CurrentAPI == NULL || textureHandle == NULL || rgba == NULL || outCommand == NULL || layer < 0 || x < 0 || y < 0 || width <= 0 || height <= 0 || rgbaSize <= 0 || rgbaRowPitch < width * 4)
+		return 0;
+	if (x % 4 != 0 || y % 4 != 0 || (quality != kDGCompressFast && quality != kDGCompressHigh))
+		return 0;
+	if ((int64_t)rgbaSize < (int64_t)height * rgbaRowPitch)
+		return 0;
+
+	FillUploadCommand(kDGCommandUploadCompressed, textureHandle, layer, x, y, width, height, rgba, height, rgbaRowPitch, outCommand);
+	outCommand->quality = quality;
+	return 1;
+}
+
+// Returns the handle of the new texture or -1 on failure. mipCount works like DGTextureDesc::mipCount. Safe to call from
+// any thread, the native texture is created on the calling thread and never on Unity's render thread.
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API CreateNativeTexture(int width, int height, int format, int mipCount)
+{
+	if (s_CurrentAPI == NULL || width <= 0 || height <= 0)
+		return -1;
+	return CreateTextureInternal(width, height, format, mipCount);
+}
+
+// Returns the handle of a new texture array with layers layers or -1 on failure. Copies, clears and uploads address its
+// layers, DestroyNativeTexture destroys it. Safe to call from any thread like CreateNativeTexture.
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API CreateNativeTextureArray(int width, int height, int layers, int format)
+{
+	if (s_CurrentAPI == NULL || width <= 0 || height <= 0 || layers <= 0)
+		return -1;
+
+	uint32_t index;
+	if (!AcquireTextureIndex(&index))
+		return -1;
+
+	if (!s_CurrentAPI->CreateTextureArray(width, height, layers, format, (int)index) || s_CurrentAPI->GetTexturePointer((int)index) == nullptr)
+	{
+		ReturnTextureIndex(index);
+		return -1;
+	}
+
+	return PublishTextureHandle(index);
+}
+
+// Stale handles and handles that were already destroyed are ignored. Safe to call from any thread.
+extern "C" UNITY_INTERFACE_EXPORT void UNITY_INTERFACE_API DestroyNativeTexture(int textureHandle)
+{
+	if (s_CurrentAPI != NULL)
+		DestroyTextureInternal(textureHandle);
+}
+
+// Creates count textures with a single call, for loading hundreds of textures at once. Handles are written to outHandles
+// and native pointers to outPointers (may be NULL), failed entries get -1 and NULL. Returns how many were created.
+// Safe to call from any thread.
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API CreateNativeTextures(const DGTextureDesc* descs, int count, int* outHandles, void** outPointers)
+{
+	if (s_CurrentAPI == NULL || descs == NULL || outHandles == NULL || count <= 0)
+		return 0;
+
+	std::vector<DGTextureDesc> resolved(descs, descs + count);
+	std::vector<int> indices(count);
+	std::vector<int> requested(count);
+	for (int i = 0; i < count; ++i)
+	{
+		uint32_t index;
+		if (descs[i].width > 0 && descs[i].height > 0 && AcquireTextureIndex(&index))
+		{
+			indices[i] = (int)index;
+			resolved[i].mipCount = ResolveMipCount(descs[i].width, descs[i].height, descs[i].mipCount);
+		}
+		else
+		{
+			indices[i] = -1;
+		}
+		requested[i] = indices[i];
+	}
+
+	s_CurrentAPI->CreateTextures(resolved.data(), indices.data(), count);
+
+	int created = 0;
+	for (int i = 0; i < count; ++i)
+	{
+		void* pointer = indices[i] >= 0 ? s_CurrentAPI->GetTexturePointer(indices[i]) : NULL;
+		if (pointer != NULL)
+		{
+			outHandles[i] = PublishTextureHandle((uint32_t)indices[i]);
+			++created;
+		}
+		else
+		{
+			//Texture creation failed
+			if (requested[i] >= 0)
+				ReturnTextureIndex((uint32_t)requested[i]);
+			outHandles[i] = -1;
+		}
+		if (outPointers != NULL)
+			outPointers[i] = pointer;
+	}
+	return created;
+}
+
+// Destroys count textures with a single call. Stale handles and handles that were already destroyed are ignored.
+// Safe to call from any thread.
+extern "C" UNITY_INTERFACE_EXPORT void UNITY_INTERFACE_API DestroyNativeTextures(const int* handles, int count)
+{
+	if (s_CurrentAPI == NULL || handles == NULL || count <= 0)
+		return;
+
+	std::vector<int> indices(count);
+	for (int i = 0; i < count; ++i)
+	{
+		uint32_t index;
+		indices[i] = RetireTextureHandle(handles[i], &index) ? (int)index : -1;
+	}
+
+	s_CurrentAPI->DestroyTextures(indices.data(), count);
+
+	for (int i = 0; i < count; ++i)
+	{
+		if (indices[i] >= 0)
+			ReturnTextureIndex((uint32_t)indices[i]);
+	}
+}
+
+// Destroyed textures are kept for reuse by a later CreateNativeTexture with the same size and format. Sets how many
+// are kept at most, freeing pooled textures beyond the new capacity right away.
+extern "C" UNITY_INTERFACE_EXPORT void UNITY_INTERFACE_API SetTexturePoolCapacity(int capacity)
+{
+	if (s_CurrentAPI != NULL)
+		s_CurrentAPI->SetTexturePoolCapacity(capacity);
+}
+
+// Frees pooled textures, oldest first, until at most maxPooled remain.
+extern "C" UNITY_INTERFACE_EXPORT void UNITY_INTERFACE_API TrimTexturePool(int maxPooled)
+{
+	if (s_CurrentAPI != NULL)
+		s_CurrentAPI->TrimTexturePool(maxPooled);
+}
+
+// Returns NULL for stale handles. Safe to call from any thread.
+extern "C" UNITY_INTERFACE_EXPORT void* UNITY_INTERFACE_API GetNativeTexturePointer(int textureHandle)
+{
+	if (s_CurrentAPI == NULL || !IsTextureAlive(textureHandle))
+		return NULL;
+	return s_CurrentAPI->GetTexturePointer((int)TextureHandleIndex(textureHandle));
+}
+
+// DGConvertOption flags the current graphics API applies in kDGCommandConvert.
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API GetSupportedConvertOptions()
+{
+	return s_CurrentAPI != NULL ? s_CurrentAPI->GetSupportedConvertOptions() : 0;
+}
+
+// Whether the current graphics API can encode BC textures on the GPU with kDGCommandCompress.
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API GetSupportsCompressTexture()
+{
+	return s_CurrentAPI != NULL && s_CurrentAPI->SupportsCompressTexture() ? 1 : 0;
+}
+
+// Whether the current graphics API can fill textures with procedural patterns through kDGCommandGenerate.
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API GetSupportsGenerateTexture()
+{
+	return s_CurrentAPI != NULL && s_CurrentAPI->SupportsGenerateTexture() ? 1 : 0;
+}
+
+// Gradients have no cells, only the noises have octaves
+static bool ValidateGenerateParams(const DGGenerateParams& params)
+{
+	if (params.generator < 0 || params.generator >= kDGGeneratorCount || params.x < 0 || params.y < 0 || params.width <= 0 || params.height <= 0)
+		return false;
+
+	const bool cells = params.generator != kDGGenerateLinearGradient && params.generator != kDGGenerateRadialGradient;
+	const bool fractal = params.generator <= kDGGenerateSimplexNoise;
+	if (cells && !(params.cellSize > 0.0f))
+		return false;
+	return !fractal || (params.octaves >= 1 && params.octaves <= 16 && params.lacunarity > 0.0f);
+}
+
+// Fills outCommand with a kDGCommandGenerate that fills a rectangle of an array layer of textureHandle with a noise,
+// gradient or pattern computed on the GPU. params is copied into memory the plugin owns until the queued command is
+// recorded on the render thread. Returns 1 on success and 0 when the arguments are invalid or the graphics API can't
+// generate textures.
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API CreateGenerateCommand(void* textureHandle, int layer, const DGGenerateParams* params, DGCommand* outCommand)
+{
+	if (s_CurrentAPI == NULL || textureHandle == NULL || params == NULL || outCommand == NULL || layer < 0 || !s_CurrentAPI->SupportsGenerateTexture())
+		return 0;
+	if (!ValidateGenerateParams(*params))
+		return 0;
+
+	memset(outCommand, 0, sizeof(DGCommand));
+	outCommand->type = kDGCommandGenerate;
+	outCommand->destination = textureHandle;
+	outCommand->destinationLayer = layer;
+	outCommand->data = new DGGenerateParams(*params);
+	return 1;
+}
+
+
+
+// --------------------------------------------------------------------------
+// Command optimizer
+// Rewrites a run of validated copy/clear commands before it is recorded. Writes that are completely overwritten
+// later in the run without being read in between are dropped, which covers repeated clears and clears followed by a
+// full copy. Consecutive copies between the same textures are merged when their rectangles abut and dropped when repeated.
+// Every array layer of a texture is tracked on its own.
+// Render thread only, DrainCommandQueue is its only caller. The scratch state below is reused by every run without locking.
+
+
+// Texture and array layer
+typedef pair<void*, int> OptimizerLayer;
+
+struct OptimizerLayerHash
+{
+	size_t operator()(const OptimizerLayer& layer) const { return hash<void*>()(layer.first) ^ ((size_t)layer.second * 0x9e3779b9u); }
+};
+
+static unordered_map<void*, pair<int, int> > s_OptimizerTextureSizes;
+static unordered_set<OptimizerLayer, OptimizerLayerHash> s_OptimizerOverwritten;
+static vector<bool> s_OptimizerDead;
+
+// Whether a copy, blit or convert writes every pixel of its destination
+static bool CopyCoversDestination(const DGCommand& command)
+{
+	if (command.type != kDGCommandCopy && command.type != kDGCommandBlit && command.type != kDGCommandConvert && command.type != kDGCommandCompress)
+		return false;
+	if (command.destinationX != 0 || command.destinationY != 0)
+		return false;
+	const int width = command.type == kDGCommandBlit ? command.destinationWidth : command.width;
+	const int height = command.type == kDGCommandBlit ? command.destinationHeight : command.height;
+
+	unordered_map<void*, pair<int, int> >::iterator it = s_OptimizerTextureSizes.find(command.destination);
+	if (it == s_OptimizerTextureSizes.end())
+	{
+		pair<int, int> size(0, 0);
+		if (!s_CurrentAPI->GetTextureSize(command.destination, &size.first, &size.second))
+			size = pair<int, int>(0, 0);
+		it = s_OptimizerTextureSizes.insert(make_pair(command.destination, size)).first;
+	}
+
+	return it->second.first > 0 && width >= it->second.first && height >= it->second.second;
+}
+
+// Appends command to output, merging it into the previous copy when possible
+static void AppendCopy(const DGCommand& command, vector<DGCommand>& output)
+{
+	if (!output.empty() && command.source != command.destination)
+	{
+		DGCommand& last = output.back();
+		if (last.type == kDGCommandCopy && last.source == command.source && last.destination == command.destination &&
+			last.sourceLayer == command.sourceLayer && last.destinationLayer == command.destinationLayer)
+		{
+			const int sourceOffsetX = command.sourceX - last.sourceX;
+			const int sourceOffsetY = command.sourceY - last.sourceY;
+			const bool sameOffset = sourceOffsetX == command.destinationX - last.destinationX && sourceOffsetY == command.destinationY - last.destinationY;
+			if (sameOffset)
+			{
+				// Already copied by the previous command
+				if (sourceOffsetX >= 0 && sourceOffsetY >= 0 && sourceOffsetX + command.width <= last.width && sourceOffsetY + command.height <= last.height)
+					return;
+				if (sourceOffsetY == 0 && command.height == last.height && sourceOffsetX == last.width)
+				{
+					last.width += command.width;
+					return;
+				}
+				if (sourceOffsetX == 0 && command.width == last.width && sourceOffsetY == last.height)
+				{
+					last.height += command.height;
+					return;
+				}
+			}
+		}
+	}
+
+	output.push_back(command);
+}
+
+static vector<DGCommand> s_OptimizerMerged;
+
+static void OptimizeCommands(const DGCommand* commands, int count, vector<DGCommand>& output)
+{
+	// Merge first so copies that only cover a texture together can still make earlier writes dead
+	s_OptimizerMerged.clear();
+	for (int i = 0; i < count; ++i)
+	{
+		if (commands[i].type == kDGCommandCopy)
+			AppendCopy(commands[i], s_OptimizerMerged);
+		else
+			s_OptimizerMerged.push_back(commands[i]);
+	}
+
+	const int mergedCount = (int)s_OptimizerMerged.size();
+	s_OptimizerTextureSizes.clear();
+	s_OptimizerOverwritten.clear();
+	s_OptimizerDead.assign(mergedCount, false);
+
+	// Walk backwards tracking textures that are completely overwritten later on without being read first
+	for (int i = mergedCount - 1; i >= 0; --i)
+	{
+		const DGCommand& command = s_OptimizerMerged[i];
+		if (command.type == kDGCommandGenerateMips)
+		{
+			// Writes the lower levels that copies and clears never touch, and reads the top level of every layer
+			for (unordered_set<OptimizerLayer, OptimizerLayerHash>::iterator it = s_OptimizerOverwritten.begin(); it != s_OptimizerOverwritten.end();)
+			{
+				if (it->first == command.destination)
+					it = s_OptimizerOverwritten.erase(it);
+				else
+					++it;
+			}
+			continue;
+		}
+		if (s_OptimizerOverwritten.count(OptimizerLayer(command.destination, command.destinationLayer)) != 0)
+		{
+			s_OptimizerDead[i] = true;
+			continue;
+		}
+
+		if (command.type == kDGCommandClear || CopyCoversDestination(command))
+			s_OptimizerOverwritten.insert(OptimizerLayer(command.destination, command.destinationLayer));
+		if (command.type == kDGCommandCopy || command.type == kDGCommandBlit || command.type == kDGCommandConvert || command.type == kDGCommandCompress)
+			s_OptimizerOverwritten.erase(OptimizerLayer(command.source, command.sourceLayer));
+	}
+
+	output.clear();
+	for (int i = 0; i < mergedCount; ++i)
+	{
+		if (!s_OptimizerDead[i])
+			output.push_back(s_OptimizerMerged[i]);
+	}
+}
+
+static vector<DGCommand> s_OptimizedCommands;
+
+static void SubmitOptimizedCommands(const DGCommand* commands, int count)
+{
+	OptimizeCommands(commands, count, s_OptimizedCommands);
+	if (!s_OptimizedCommands.empty())
+		s_CurrentAPI->SubmitCommands(s_OptimizedCommands.data(), (int)s_OptimizedCommands.size());
+}
+
+
+
+
+// --------------------------------------------------------------------------
+// Readback
+// RequestReadback hands out a ticket on the main thread, the matching kDGCommandReadback command records the copy on the
+// render thread and every kDGRenderEventFlushCommands event polls recorded readbacks until the GPU has finished them.
+// The main thread never waits, TryGetReadback simply reports that the data is not there yet.
+
+
+enum ReadbackState
+{
+	kReadbackFree = 0,
+	kReadbackRequested,		// ticket handed out, copy not recorded yet
+	kReadbackRecorded,		// copy recorded, waiting for the GPU
+	kReadbackReady,			// data can be read by the main thread
+	kReadbackConsumed,		// data was read, memory is released on the render thread
+	kReadbackFailed,
+};
+
+static const int kMaxReadbacks = 1024; // must be a power of two
+
+struct ReadbackSlot
+{
+	std::atomic<int> state;
+	std::atomic<bool> abandoned;	// released by the main thread before it completed
+	std::atomic<bool> queued;		// its kDGCommandReadback went into the render thread queue
+	int ticket;
+	void* texture;
+	int x;
+	int y;
+	int width;
+	int height;
+	const void* data;
+	int size;
+};
+
+static ReadbackSlot s_Readbacks[kMaxReadbacks];
+static int s_ReadbackGeneration = 0;
+
+static ReadbackSlot* FindReadback(int ticket)
+{
+	if (ticket <= 0)
+		return NULL;
+	ReadbackSlot& slot = s_Readbacks[ticket & (kMaxReadbacks - 1)];
+	return slot.ticket == ticket && slot.state.load(std::memory_order_acquire) != kReadbackFree ? &slot : NULL;
+}
+
+// Returns a ticket for TryGetReadback, or 0 when the texture is invalid or too many readbacks are in flight.
+// The copy itself happens once a kDGCommandReadback command with this ticket is executed.
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API RequestReadback(int textureHandle, int x, int y, int width, int height)
+{
+	if (s_CurrentAPI == NULL || !IsTextureAlive(textureHandle) || x < 0 || y < 0 || width <= 0 || height <= 0)
+		return 0;
+
+	for (int i = 0; i < kMaxReadbacks; ++i)
+	{
+		ReadbackSlot& slot = s_Readbacks[i];
+		if (slot.state.load(std::memory_order_acquire) != kReadbackFree)
+			continue;
+
+		s_ReadbackGeneration = (s_ReadbackGeneration + 1) & 0xFFFFF;
+		if (s_ReadbackGeneration == 0)
+			s_ReadbackGeneration = 1;
+
+		slot.ticket = s_ReadbackGeneration * kMaxReadbacks + i;
+		slot.texture = s_CurrentAPI->GetTexturePointer((int)TextureHandleIndex(textureHandle));
+		slot.x = x;
+		slot.y = y;
+		slot.width = width;
+		slot.height = height;
+		slot.data = NULL;
+		slot.size = 0;
+		slot.abandoned.store(false, std::memory_order_relaxed);
+		slot.queued.store(false, std::memory_order_relaxed);
+		slot.state.store(kReadbackRequested, std::memory_order_release);
+		return slot.ticket;
+	}
+
+	return 0;
+}
+
+// Whether the main thread still holds the ticket of a readback, it gives it up by reading or releasing the readback
+static bool IsReadbackLive(ReadbackSlot* slot, int state)
+{
+	return slot != NULL && state != kReadbackConsumed && !slot->abandoned.load(std::memory_order_acquire);
+}
+
+// Size in bytes of a finished readback, 0 while it is still pending and -1 for a failed or unknown ticket.
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API GetReadbackSize(int ticket)
+{
+	ReadbackSlot* slot = FindReadback(ticket);
+	const int state = slot != NULL ? slot->state.load(std::memory_order_acquire) : kReadbackFree;
+	if (!IsReadbackLive(slot, state))
+		return -1;
+
+	if (state == kReadbackReady)
+		return slot->size;
+	return state == kReadbackFailed ? -1 : 0;
+}
+
+// Copies a finished readback into destination and releases the ticket. Returns the number of bytes copied,
+// 0 while the readback is still pending, -1 when it failed (the ticket is released), -2 when destinationSize is too
+// small and -3 for a ticket that is unknown or was already read or released.
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API TryGetReadback(int ticket, void* destination, int destinationSize)
+{
+	ReadbackSlot* slot = FindReadback(ticket);
+	const int state = slot != NULL ? slot->state.load(std::memory_order_acquire) : kReadbackFree;
+	if (!IsReadbackLive(slot, state))
+		return -3;
+
+	if (state == kReadbackFailed)
+	{
+		slot->state.store(kReadbackFree, std::memory_order_release);
+		return -1;
+	}
+	if (state != kReadbackReady)
+		return 0;
+	if (destination == NULL || destinationSize < slot->size)
+		return -2;
+
+	memcpy(destination, slot->data, slot->size);
+	const int size = slot->size;
+	slot->state.store(kReadbackConsumed, std::memory_order_release);
+	return size;
+}
+
+// Gives up on a readback without reading it. Returns 1 when the ticket was released, 0 for a ticket that is unknown or
+// was already read or released. Called on the thread that queues commands, like EnqueueCommandBatch.
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API ReleaseReadback(int ticket)
+{
+	ReadbackSlot* slot = FindReadback(ticket);
+	if (slot == NULL)
+		return 0;
+
+	int state = kReadbackReady;
+	if (slot->state.compare_exchange_strong(state, kReadbackConsumed, std::memory_order_acq_rel))
+		return 1;
+	if (state == kReadbackConsumed)
+		return 0;
+	state = kReadbackFailed;
+	if (slot->state.compare_exchange_strong(state, kReadbackFree, std::memory_order_acq_rel))
+		return 1;
+
+	// No command for it reached the render thread queue, so nothing there would ever come back for it. A command still
+	// waiting in the managed queue finds the ticket gone and is skipped by EnqueueCommandBatch.
+	state = kReadbackRequested;
+	if (!slot->queued.load(std::memory_order_acquire) && slot->state.compare_exchange_strong(state, kReadbackFree, std::memory_order_acq_rel))
+		return 1;
+
+	// Still in flight, the render thread releases it once it gets there
+	return slot->abandoned.exchange(true, std::memory_order_acq_rel) ? 0 : 1;
+}
+
+static bool ValidateReadback(int ticket)
+{
+	ReadbackSlot* slot = FindReadback(ticket);
+	return slot != NULL && slot->state.load(std::memory_order_acquire) == kReadbackRequested && !slot->abandoned.load(std::memory_order_acquire);
+}
+
+static void RecordReadbackCommand(int ticket)
+{
+	ReadbackSlot* slot = FindReadback(ticket);
+	if (slot == NULL || slot->state.load(std::memory_order_acquire) != kReadbackRequested)
+		return;
+
+	if (slot->abandoned.load(std::memory_order_acquire))
+	{
+		slot->state.store(kReadbackFree, std::memory_order_release);
+		return;
+	}
+
+	const bool recorded = s_CurrentAPI->RecordReadback(ticket, slot->texture, slot->x, slot->y, slot->width, slot->height);
+	slot->state.store(recorded ? kReadbackRecorded : kReadbackFailed, std::memory_order_release);
+}
+
+// Render thread only
+static void PollReadbacks()
+{
+	for (int i = 0; i < kMaxReadbacks; ++i)
+	{
+		ReadbackSlot& slot = s_Readbacks[i];
+		int state = slot.state.load(std::memory_order_acquire);
+		if (state == kReadbackRecorded)
+		{
+			const void* data = NULL;
+			const int size = s_CurrentAPI->PollReadback(slot.ticket, &data);
+			if (size == 0)
+				continue;
+
+			if (size > 0)
+			{
+				slot.data = data;
+				slot.size = size;
+				state = kReadbackReady;
+			}
+			else
+			{
+				state = kReadbackFailed;
+			}
+			slot.state.store(state, std::memory_order_release);
+		}
+
+		if (state == kReadbackConsumed || ((state == kReadbackReady || state == kReadbackFailed) && slot.abandoned.load(std::memory_order_acquire)))
+		{
+			if (state != kReadbackFailed)
+				s_CurrentAPI->ReleaseReadback(slot.ticket);
+			slot.state.store(kReadbackFree, std::memory_order_release);
+		}
+	}
+}
+
+
+
+
+// --------------------------------------------------------------------------
+// Texture atlases
+// Packs sprites into pages of one size and format with MaxRects, placing each sprite in the free rectangle that leaves
+// the shortest side over. Pages are plugin textures created on demand. Adding and repacking only hand out the copies
+// to make, grouped by page and source, which the caller queues like any other command so they keep their order.
+// Main thread only.
+
+
+struct AtlasRect
+{
+	int x;
+	int y;
+	int width;
+	int height;
+};
+
+struct AtlasPage
+{
+	int textureHandle;
+	vector<AtlasRect> freeRects;
+};
+
+struct AtlasEntry
+{
+	int page;				// -1 for removed entries
+	AtlasRect rect;			// including padding
+};
+
+struct Atlas
+{
+	bool alive;
+	int pageWidth;
+	int pageHeight;
+	int format;
+	int padding;
+	vector<AtlasPage> pages;
+	vector<AtlasEntry> entries;
+	vector<int> freeEntries;
+	vector<int> retiredPages;	// texture handles of pages replaced by AtlasRepack
+};
+
+static vector<Atlas> s_Atlases;
+static vector<AtlasRect> s_AtlasSplitRects;
+static vector<int> s_AtlasOrder;
+
+static Atlas* GetAtlas(int atlas)
+{
+	if (atlas < 0 || atlas >= (int)s_Atlases.size() || !s_Atlases[atlas].alive)
+		return NULL;
+	return &s_Atlases[atlas];
+}
+
+static bool AtlasRectsOverlap(const AtlasRect& a, const AtlasRect& b)
+{
+	return a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+static bool AtlasRectContains(const AtlasRect& outer, const AtlasRect& inner)
+{
+	return inner.x >= outer.x && inner.y >= outer.y && inner.x + inner.width <= outer.x + outer.width && inner.y + inner.height <= outer.y + outer.height;
+}
+
+// Removes rect from the free rectangles, splitting every free rectangle it overlaps into the parts left around it
+static void AtlasCarveFreeRects(vector<AtlasRect>& freeRects, const AtlasRect& rect)
+{
+	s_AtlasSplitRects.clear();
+	for (size_t i = 0; i < freeRects.size();)
+	{
+		const AtlasRect free = freeRects[i];
+		if (!AtlasRectsOverlap(free, rect))
+		{
+			++i;
+			continue;
+		}
+
+		if (rect.x > free.x)
+		{
+			const AtlasRect left = { free.x, free.y, rect.x - free.x, free.height };
+			s_AtlasSplitRects.push_back(left);
+		}
+		if (rect.x + rect.width < free.x + free.width)
+		{
+			const AtlasRect right = { rect.x + rect.width, free.y, free.x + free.width - rect.x - rect.width, free.height };
+			s_AtlasSplitRects.push_back(right);
+		}
+		if (rect.y > free.y)
+		{
+			const AtlasRect top = { free.x, free.y, free.width, rect.y - free.y };
+			s_AtlasSplitRects.push_back(top);
+		}
+		if (rect.y + rect.height < free.y + free.height)
+		{
+			const AtlasRect bottom = { free.x, rect.y + rect.height, free.width, free.y + free.height - rect.y - rect.height };
+			s_AtlasSplitRects.push_back(bottom);
+		}
+
+		freeRects[i] = freeRects.back();
+		freeRects.pop_back();
+	}
+
+	// Only keep maximal rectangles
+	for (size_t i = 0; i < s_AtlasSplitRects.size(); ++i)
+	{
+		const AtlasRect& split = s_AtlasSplitRects[i];
+		bool contained = false;
+		for (size_t j = 0; j < freeRects.size() && !contained; ++j)
+			contained = AtlasRectContains(freeRects[j], split);
+		if (contained)
+			continue;
+
+		for (size_t j = 0; j < freeRects.size();)
+		{
+			if (AtlasRectContains(split, freeRects[j]))
+			{
+				freeRects[j] = freeRects.back();
+				freeRects.pop_back();
+			}
+			else
+			{
+				++j;
+			}
+		}
+		freeRects.push_back(split);
+	}
+}
+
+// Best short side fit. Returns false when no free rectangle of the page is large enough.
+static bool AtlasPlaceInPage(AtlasPage& page, int width, int height, AtlasRect* outRect)
+{
+	int bestIndex = -1;
+	int bestShortSide = INT_MAX;
+	int bestLongSide = INT_MAX;
+	for (size_t i = 0; i < page.freeRects.size(); ++i)
+	{
+		const AtlasRect& free = page.freeRects[i];
+		if (free.width < width || free.height < height)
+			continue;
+
+		const int leftoverX = free.width - width;
+		const int leftoverY = free.height - height;
+		const int shortSide = leftoverX < leftoverY ? leftoverX : leftoverY;
+		const int longSide = leftoverX < leftoverY ? leftoverY : leftoverX;
+		if (shortSide < bestShortSide || (shortSide == bestShortSide && longSide < bestLongSide))
+		{
+			bestIndex = (int)i;
+			bestShortSide = shortSide;
+			bestLongSide = longSide;
+		}
+	}
+	if (bestIndex < 0)
+		return false;
 
-extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API CopyTextures(void* textureHandle, int x, int y, int w, int h, void* textureHandle2, int x2, int y2)
+	const AtlasRect rect = { page.freeRects[bestIndex].x, page.freeRects[bestIndex].y, width, height };
+	AtlasCarveFreeRects(page.freeRects, rect);
+	*outRect = rect;
+	return true;
+}
+
+static int AtlasAddPage(Atlas& atlas, vector<AtlasPage>& pages, DGCommand* outCommands, int* commandCount)
 {
-	s_CurrentAPI->DoCopyTexture(textureHandle, x, y, w, h, textureHandle2, x2, y2);
+	const int textureHandle = CreateTextureInternal(atlas.pageWidth, atlas.pageHeight, atlas.format, 1);
+	if (textureHandle < 0)
+		return -1;
+
+	AtlasPage page;
+	page.textureHandle = textureHandle;
+	const AtlasRect whole = { 0, 0, atlas.pageWidth, atlas.pageHeight };
+	page.freeRects.push_back(whole);
+	pages.push_back(page);
+
+	// New textures start out undefined, the padding between sprites has to be transparent
+	DGCommand& clear = outCommands[(*commandCount)++];
+	memset(&clear, 0, sizeof(clear));
+	clear.type = kDGCommandClear;
+	clear.destination = s_CurrentAPI->GetTexturePointer(TextureHandleIndex(textureHandle));
+	return (int)pages.size() - 1;
 }
 
-extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API CreateNativeTexture(int width, int height, int format)
+// Places a sprite of width x height in the first page it fits, adding a page when none has room
+static int AtlasPlace(Atlas& atlas, vector<AtlasPage>& pages, int width, int height, AtlasRect* outRect, DGCommand* outCommands, int* commandCount)
 {
-	int textureIndex;
-	if (m_FreeIndexCount != 0)
+	const int paddedWidth = width + atlas.padding;
+	const int paddedHeight = height + atlas.padding;
+	if (paddedWidth > atlas.pageWidth || paddedHeight > atlas.pageHeight)
+		return -1;
+
+	for (size_t i = 0; i < pages.size(); ++i)
 	{
-		textureIndex = m_FreeTextureIndexs.back();
-        m_FreeTextureIndexs.pop_back();
-        m_FreeIndexCount--;
+		if (AtlasPlaceInPage(pages[i], paddedWidth, paddedHeight, outRect))
+			return (int)i;
 	}
-	else
+
+	const int page = AtlasAddPage(atlas, pages, outCommands, commandCount);
+	if (page < 0 || !AtlasPlaceInPage(pages[page], paddedWidth, paddedHeight, outRect))
+		return -1;
+	return page;
+}
+
+// Copies are sorted by page and then source so consecutive ones share their textures
+static bool CompareAtlasCopies(const DGCommand& a, const DGCommand& b)
+{
+	if (a.destination != b.destination)
+		return a.destination < b.destination;
+	return a.source < b.source;
+}
+
+static void SortAtlasCopies(DGCommand* commands, int count)
+{
+	int start = 0;
+	while (start < count)
+	{
+		// Clears of new pages stay in front of the copies into them
+		while (start < count && commands[start].type != kDGCommandCopy)
+			++start;
+		int end = start;
+		while (end < count && commands[end].type == kDGCommandCopy)
+			++end;
+		std::stable_sort(commands + start, commands + end, CompareAtlasCopies);
+		start = end;
+	}
+}
+
+static int AtlasCreateEntry(Atlas& atlas)
+{
+	if (!atlas.freeEntries.empty())
+	{
+		const int entry = atlas.freeEntries.back();
+		atlas.freeEntries.pop_back();
+		return entry;
+	}
+	atlas.entries.push_back(AtlasEntry());
+	return (int)atlas.entries.size() - 1;
+}
+
+static void AtlasDestroyPages(const vector<AtlasPage>& pages)
+{
+	for (size_t i = 0; i < pages.size(); ++i)
+		DestroyTextureInternal(pages[i].textureHandle);
+}
+
+// Returns the id of a new atlas or -1 on failure. Pages are pageWidth x pageHeight textures of format, padding pixels
+// are left free to the right of and below every sprite.
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API CreateAtlas(int pageWidth, int pageHeight, int format, int padding)
+{
+	if (s_CurrentAPI == NULL || pageWidth <= 0 || pageHeight <= 0 || padding < 0)
+		return -1;
+
+	int atlas = 0;
+	while (atlas < (int)s_Atlases.size() && s_Atlases[atlas].alive)
+		++atlas;
+	if (atlas == (int)s_Atlases.size())
+		s_Atlases.push_back(Atlas());
+
+	Atlas& created = s_Atlases[atlas];
+	created.alive = true;
+	created.pageWidth = pageWidth;
+	created.pageHeight = pageHeight;
+	created.format = format;
+	created.padding = padding;
+	return atlas;
+}
+
+// Destroys every page of the atlas, including the ones retired by AtlasRepack.
+extern "C" UNITY_INTERFACE_EXPORT void UNITY_INTERFACE_API DestroyAtlas(int atlas)
+{
+	Atlas* target = GetAtlas(atlas);
+	if (target == NULL)
+		return;
+
+	AtlasDestroyPages(target->pages);
+	for (size_t i = 0; i < target->retiredPages.size(); ++i)
+		DestroyTextureInternal(target->retiredPages[i]);
+	*target = Atlas();
+}
+
+// Packs count sprites, largest first, and writes where each one went to outRects in the order given. Sprites that are
+// larger than a page or need a page that could not be created get entry -1. The clears of new pages and the copies of
+// the sprites are written to outCommands, which needs room for 2 * count commands, and their number is returned.
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API AtlasAdd(int atlas, const DGAtlasSprite* sprites, int count, DGAtlasRect* outRects, DGCommand* outCommands)
+{
+	Atlas* target = GetAtlas(atlas);
+	if (target == NULL || count <= 0 || sprites == NULL || outRects == NULL || outCommands == NULL)
+		return 0;
+
+	s_AtlasOrder.resize(count);
+	for (int i = 0; i < count; ++i)
+		s_AtlasOrder[i] = i;
+	std::stable_sort(s_AtlasOrder.begin(), s_AtlasOrder.end(), [sprites](int a, int b)
+	{
+		return (int64_t)sprites[a].width * sprites[a].height > (int64_t)sprites[b].width * sprites[b].height;
+	});
+
+	int commandCount = 0;
+	for (int i = 0; i < count; ++i)
+	{
+		const int index = s_AtlasOrder[i];
+		const DGAtlasSprite& sprite = sprites[index];
+		DGAtlasRect& outRect = outRects[index];
+		outRect.entry = -1;
+
+		AtlasRect rect;
+		const int page = sprite.source != NULL && sprite.width > 0 && sprite.height > 0 && sprite.x >= 0 && sprite.y >= 0 ?
+			AtlasPlace(*target, target->pages, sprite.width, sprite.height, &rect, outCommands, &commandCount) : -1;
+		if (page < 0)
+			continue;
+
+		const int entry = AtlasCreateEntry(*target);
+		target->entries[entry].page = page;
+		target->entries[entry].rect = rect;
+
+		outRect.entry = entry;
+		outRect.page = page;
+		outRect.x = rect.x;
+		outRect.y = rect.y;
+		outRect.width = sprite.width;
+		outRect.height = sprite.height;
+
+		DGCommand& copy = outCommands[commandCount++];
+		memset(&copy, 0, sizeof(copy));
+		copy.type = kDGCommandCopy;
+		copy.source = sprite.source;
+		copy.destination = s_CurrentAPI->GetTexturePointer(TextureHandleIndex(target->pages[page].textureHandle));
+		copy.sourceX = sprite.x;
+		copy.sourceY = sprite.y;
+		copy.width = sprite.width;
+		copy.height = sprite.height;
+		copy.destinationX = rect.x;
+		copy.destinationY = rect.y;
+	}
+
+	SortAtlasCopies(outCommands, commandCount);
+	return commandCount;
+}
+
+// Frees the space of a sprite for later additions. Its pixels stay until they are overwritten.
+extern "C" UNITY_INTERFACE_EXPORT void UNITY_INTERFACE_API AtlasRemove(int atlas, int entry)
+{
+	Atlas* target = GetAtlas(atlas);
+	if (target == NULL || entry < 0 || entry >= (int)target->entries.size() || target->entries[entry].page < 0)
+		return;
+
+	AtlasEntry& removed = target->entries[entry];
+	vector<AtlasRect>& freeRects = target->pages[removed.page].freeRects;
+	for (size_t i = 0; i < freeRects.size();)
+	{
+		if (AtlasRectContains(removed.rect, freeRects[i]))
+		{
+			freeRects[i] = freeRects.back();
+			freeRects.pop_back();
+		}
+		else
+		{
+			++i;
+		}
+	}
+	freeRects.push_back(removed.rect);
+
+	removed.page = -1;
+	target->freeEntries.push_back(entry);
+}
+
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API AtlasGetPageCount(int atlas)
+{
+	Atlas* target = GetAtlas(atlas);
+	return target != NULL ? (int)target->pages.size() : 0;
+}
+
+// Returns the texture handle of a page or -1. Pages belong to the atlas, never destroy them directly.
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API AtlasGetPageTexture(int atlas, int page)
+{
+	Atlas* target = GetAtlas(atlas);
+	if (target == NULL || page < 0 || page >= (int)target->pages.size())
+		return -1;
+	return target->pages[page].textureHandle;
+}
+
+// Number of sprites in the atlas, the number of rectangles AtlasRepack writes.
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API AtlasGetEntryCount(int atlas)
+{
+	Atlas* target = GetAtlas(atlas);
+	return target != NULL ? (int)(target->entries.size() - target->freeEntries.size()) : 0;
+}
+
+// Packs every sprite again, largest first, into new pages to get rid of the holes left by AtlasRemove. Sprites keep
+// their entry ids. The new rectangles are written to outRects, which needs room for AtlasGetEntryCount rectangles, and
+// the commands copying the sprites out of the old pages to outCommands, which needs room for twice that. Returns the
+// number of commands, or -1 when the sprites no longer fit in which case nothing changed. The old pages are destroyed
+// by AtlasReleaseRetiredPages once the returned commands have been queued.
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API AtlasRepack(int atlas, DGAtlasRect* outRects, DGCommand* outCommands)
+{
+	Atlas* target = GetAtlas(atlas);
+	if (target == NULL || outRects == NULL || outCommands == NULL)
+		return -1;
+
+	s_AtlasOrder.clear();
+	for (int i = 0; i < (int)target->entries.size(); ++i)
+	{
+		if (target->entries[i].page >= 0)
+			s_AtlasOrder.push_back(i);
+	}
+	const vector<AtlasEntry>& entries = target->entries;
+	std::stable_sort(s_AtlasOrder.begin(), s_AtlasOrder.end(), [&entries](int a, int b)
+	{
+		return (int64_t)entries[a].rect.width * entries[a].rect.height > (int64_t)entries[b].rect.width * entries[b].rect.height;
+	});
+
+	vector<AtlasPage> pages;
+	vector<AtlasEntry> placed(s_AtlasOrder.size());
+	int commandCount = 0;
+	for (size_t i = 0; i < s_AtlasOrder.size(); ++i)
+	{
+		const AtlasEntry& entry = entries[s_AtlasOrder[i]];
+		placed[i].page = AtlasPlace(*target, pages, entry.rect.width - target->padding, entry.rect.height - target->padding, &placed[i].rect, outCommands, &commandCount);
+		if (placed[i].page < 0)
+		{
+			AtlasDestroyPages(pages);
+			return -1;
+		}
+	}
+
+	// Clears of the new pages come first, the copies follow
+	for (size_t i = 0; i < s_AtlasOrder.size(); ++i)
+	{
+		const int id = s_AtlasOrder[i];
+		AtlasEntry& entry = target->entries[id];
+
+		DGCommand& copy = outCommands[commandCount++];
+		memset(&copy, 0, sizeof(copy));
+		copy.type = kDGCommandCopy;
+		copy.source = s_CurrentAPI->GetTexturePointer(TextureHandleIndex(target->pages[entry.page].textureHandle));
+		copy.destination = s_CurrentAPI->GetTexturePointer(TextureHandleIndex(pages[placed[i].page].textureHandle));
+		copy.sourceX = entry.rect.x;
+		copy.sourceY = entry.rect.y;
+		copy.width = entry.rect.width - target->padding;
+		copy.height = entry.rect.height - target->padding;
+		copy.destinationX = placed[i].rect.x;
+		copy.destinationY = placed[i].rect.y;
+
+		entry = placed[i];
+
+		DGAtlasRect& outRect = outRects[i];
+		outRect.entry = id;
+		outRect.page = entry.page;
+		outRect.x = entry.rect.x;
+		outRect.y = entry.rect.y;
+		outRect.width = copy.width;
+		outRect.height = copy.height;
+	}
+	SortAtlasCopies(outCommands, commandCount);
+
+	for (size_t i = 0; i < target->pages.size(); ++i)
+		target->retiredPages.push_back(target->pages[i].textureHandle);
+	target->pages.swap(pages);
+	return commandCount;
+}
+
+// Destroys the pages replaced by AtlasRepack. Commands queued before still finish before their memory is released.
+extern "C" UNITY_INTERFACE_EXPORT void UNITY_INTERFACE_API AtlasReleaseRetiredPages(int atlas)
+{
+	Atlas* target = GetAtlas(atlas);
+	if (target == NULL)
+		return;
+
+	for (size_t i = 0; i < target->retiredPages.size(); ++i)
+		DestroyTextureInternal(target->retiredPages[i]);
+	target->retiredPages.clear();
+}
+
+
+// --------------------------------------------------------------------------
+// Command batches
+// A whole array of commands is validated with one call instead of one call per operation, then queued for the render
+// thread, which is the only thread recording GPU work. Everything is validated up front so a bad command never leaves
+// a half queued batch behind.
+
+
+static bool ValidateSwizzle(int swizzle)
+{
+	for (int channel = 0; channel < 4; ++channel)
+	{
+		if (((swizzle >> (channel * 4)) & 15) > kDGSwizzleOne)
+			return false;
+	}
+	return (swizzle >> 16) == 0;
+}
+
+// Whether a copy reads pixels it writes itself, which neither Vulkan nor Metal define
+static bool CopyOverlapsItself(const DGCommand& command)
+{
+	return command.source == command.destination && command.sourceLayer == command.destinationLayer &&
+		command.sourceX < command.destinationX + command.width && command.destinationX < command.sourceX + command.width &&
+		command.sourceY < command.destinationY + command.height && command.destinationY < command.sourceY + command.height;
+}
+
+// Commands that go through the render thread queue
+static bool ValidateQueuedCommand(const DGCommand& command)
+{
+	switch (command.type)
+	{
+	case kDGCommandCopy:
+		return command.source != NULL && command.destination != NULL &&
+			command.width > 0 && command.height > 0 &&
+			command.sourceX >= 0 && command.sourceY >= 0 &&
+			command.destinationX >= 0 && command.destinationY >= 0 &&
+			command.sourceLayer >= 0 && command.destinationLayer >= 0 &&
+			!CopyOverlapsItself(command);
+	case kDGCommandBlit:
+		return command.source != NULL && command.destination != NULL &&
+			command.width > 0 && command.height > 0 && command.destinationWidth > 0 && command.destinationHeight > 0 &&
+			command.sourceX >= 0 && command.sourceY >= 0 &&
+			command.destinationX >= 0 && command.destinationY >= 0 &&
+			command.sourceLayer >= 0 && command.destinationLayer >= 0 &&
+			(command.filter == kDGFilterNearest || command.filter == kDGFilterLinear);
+	case kDGCommandConvert:
+		return command.source != NULL && command.destination != NULL &&
+			command.width > 0 && command.height > 0 &&
+			command.sourceX >= 0 && command.sourceY >= 0 &&
+			command.destinationX >= 0 && command.destinationY >= 0 &&
+			command.sourceLayer >= 0 && command.destinationLayer >= 0 &&
+			((command.convertOptions & kDGConvertSwizzle) == 0 || ValidateSwizzle(command.swizzle)) &&
+			s_CurrentAPI != NULL && (command.convertOptions & ~s_CurrentAPI->GetSupportedConvertOptions()) == 0;
+	case kDGCommandCompress:
+		return command.source != NULL && command.destination != NULL &&
+			command.width > 0 && command.height > 0 &&
+			command.sourceX >= 0 && command.sourceY >= 0 &&
+			command.destinationX >= 0 && command.destinationY >= 0 &&
+			command.destinationX % 4 == 0 && command.destinationY % 4 == 0 &&
+			command.sourceLayer >= 0 && command.destinationLayer >= 0 &&
+			(command.quality == kDGCompressFast || command.quality == kDGCompressHigh) &&
+			s_CurrentAPI != NULL && s_CurrentAPI->SupportsCompressTexture();
+	case kDGCommandClear:
+		return command.destination != NULL && command.destinationLayer >= 0;
+	case kDGCommandClearRect:
+		return command.destination != NULL && command.destinationLayer >= 0 && command.width > 0 && command.height > 0;
+	case kDGCommandGenerateMips:
+		return command.destination != NULL;
+	case kDGCommandReadback:
+		return ValidateReadback(command.ticket);
+	case kDGCommandUpload:
+		return command.destination != NULL && command.data != NULL && command.destinationLayer >= 0 &&
+			command.destinationX >= 0 && command.destinationY >= 0 && command.width > 0 && command.height > 0 && command.dataRowPitch > 0;
+	case kDGCommandUploadCompressed:
+		return command.destination != NULL && command.data != NULL && command.destinationLayer >= 0 &&
+			command.destinationX >= 0 && command.destinationY >= 0 && command.destinationX % 4 == 0 && command.destinationY % 4 == 0 &&
+			command.width > 0 && command.height > 0 && command.dataRowPitch >= command.width * 4 &&
+			(command.quality == kDGCompressFast || command.quality == kDGCompressHigh);
+	case kDGCommandGenerate:
+		return command.destination != NULL && command.data != NULL && command.destinationLayer >= 0 &&
+			ValidateGenerateParams(*(const DGGenerateParams*)command.data) && s_CurrentAPI != NULL && s_CurrentAPI->SupportsGenerateTexture();
+	default:
+		return false;
+	}
+}
+
+static bool ValidateCommand(const DGCommand& command, vector<int>& destroyedIndices)
+{
+	if (command.type == kDGCommandCreate)
+		return command.width > 0 && command.height > 0;
+	if (command.type != kDGCommandDestroy)
+		return ValidateQueuedCommand(command);
+
+	if (!IsTextureAlive(command.textureIndex))
+		return false;
+	// Destroying the same texture twice in one batch would hand its index out twice
+	for (size_t i = 0; i < destroyedIndices.size(); ++i)
+	{
+		if (destroyedIndices[i] == command.textureIndex)
+			return false;
+	}
+	destroyedIndices.push_back(command.textureIndex);
+	return true;
+}
+
+static bool IsRecordedCommand(int type)
+{
+	return type == kDGCommandCopy || type == kDGCommandClear || type == kDGCommandClearRect || type == kDGCommandGenerateMips ||
+		type == kDGCommandBlit || type == kDGCommandConvert || type == kDGCommandCompress;
+}
+
+// Commands that go through the render thread queue, everything but create and destroy
+static bool IsQueuedCommand(int type)
+{
+	return IsRecordedCommand(type) || type == kDGCommandReadback || type == kDGCommandUpload || type == kDGCommandUploadCompressed || type == kDGCommandGenerate;
+}
+
+// Render thread only. Consecutive copies, clears, blits, converts, compressions and mip generations are recorded in one go,
+// readbacks, uploads and generated patterns split the batch into runs to keep ordering
+static void ExecuteCommands(const DGCommand* cmds, int count)
+{
+	int runStart = 0;
+	for (int i = 0; i <= count; ++i)
+	{
+		if (i < count && IsRecordedCommand(cmds[i].type))
+			continue;
+
+		if (i > runStart)
+			SubmitOptimizedCommands(cmds + runStart, i - runStart);
+		runStart = i + 1;
+
+		if (i == count)
+			break;
+
+		if (cmds[i].type == kDGCommandUpload)
+		{
+			s_CurrentAPI->UploadTexture(cmds[i].destination, cmds[i].destinationLayer, cmds[i].destinationX, cmds[i].destinationY, cmds[i].width, cmds[i].height, cmds[i].data, cmds[i].dataRowPitch);
+			ReleaseCommandData(cmds[i]);
+		}
+		else if (cmds[i].type == kDGCommandUploadCompressed)
+		{
+			s_CurrentAPI->UploadCompressedTexture(cmds[i].destination, cmds[i].destinationLayer, cmds[i].destinationX, cmds[i].destinationY, cmds[i].width, cmds[i].height, cmds[i].data, cmds[i].dataRowPitch, cmds[i].quality);
+			ReleaseCommandData(cmds[i]);
+		}
+		else if (cmds[i].type == kDGCommandGenerate)
+		{
+			s_CurrentAPI->GenerateTexture(cmds[i].destination, cmds[i].destinationLayer, *(const DGGenerateParams*)cmds[i].data);
+			ReleaseCommandData(cmds[i]);
+		}
+		else
+		{
+			RecordReadbackCommand(cmds[i].ticket);
+		}
+	}
+}
+
+static vector<int> s_DestroyedIndices;
+
+// Returns -1 when every command is valid, otherwise the index of the first invalid command. Checks a whole batch before
+// any of it is run with SubmitCommandBatch or queued with EnqueueCommandBatch, so a bad command never leaves half a batch
+// behind. Callers split a checked batch into runs of create/destroy commands for SubmitCommandBatch and runs of the rest
+// for EnqueueCommandBatch.
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API ValidateCommandBatch(const DGCommand* cmds, int count)
+{
+	if (count <= 0)
+		return -1;
+	if (s_CurrentAPI == NULL || cmds == NULL)
+		return 0;
+
+	s_DestroyedIndices.clear();
+	for (int i = 0; i < count; ++i)
+	{
+		if (!ValidateCommand(cmds[i], s_DestroyedIndices))
+			return i;
+	}
+	return -1;
+}
+
+// Returns -1 when every command can be queued with EnqueueCommandBatch, otherwise the index of the first invalid command.
+// Create and destroy commands are never queued and count as invalid. Called when commands are added to the managed queue,
+// so a bad command is reported to its caller instead of being found once the queue is flushed.
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API ValidateQueuedCommands(const DGCommand* cmds, int count)
+{
+	if (count <= 0)
+		return -1;
+	if (s_CurrentAPI == NULL || cmds == NULL)
+		return 0;
+
+	for (int i = 0; i < count; ++i)
 	{
-		textureIndex = m_TextureCount;
+		if (!ValidateQueuedCommand(cmds[i]))
+			return i;
 	}
+	return -1;
+}
 
-    if(s_CurrentAPI->CreateTexture(width, height, format, textureIndex) && s_CurrentAPI->GetTexturePointer(textureIndex) != nullptr)
-    {
-        m_TextureCount++;
-        return textureIndex;
-    }
-    
-    //Texture creation failed
-    m_FreeTextureIndexs.push_back(textureIndex);
-    m_FreeIndexCount++;
-    return -1;
+// Releases the memory a command built by CreateUploadCommand, CreateCompressedUploadCommand or CreateGenerateCommand owns
+// when it is dropped instead of queued.
+extern "C" UNITY_INTERFACE_EXPORT void UNITY_INTERFACE_API ReleaseCommand(DGCommand* command)
+{
+	if (command == NULL)
+		return;
+	ReleaseCommandData(*command);
+	command->data = NULL;
 }
 
-extern "C" UNITY_INTERFACE_EXPORT void UNITY_INTERFACE_API DestroyNativeTexture(int textureIndex)
+// Runs create and destroy commands right away on the calling thread, they record nothing. Every other command is
+// recorded on the render thread and rejected here, queue those with EnqueueCommandBatch.
+// Returns -1 when every command was executed, otherwise the index of the first invalid command in which case nothing is executed.
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API SubmitCommandBatch(const DGCommand* cmds, int count)
 {
-	m_TextureCount--;
-	m_FreeTextureIndexs.push_back(textureIndex);
-	m_FreeIndexCount++;
-	s_CurrentAPI->DestroyTexture(textureIndex);
+	for (int i = 0; cmds != NULL && i < count; ++i)
+	{
+		if (IsQueuedCommand(cmds[i].type))
+			return i;
+	}
+	const int invalid = ValidateCommandBatch(cmds, count);
+	if (invalid >= 0)
+		return invalid;
+
+	for (int i = 0; i < count; ++i)
+	{
+		if (cmds[i].type == kDGCommandCreate)
+		{
+			int textureIndex = CreateTextureInternal(cmds[i].width, cmds[i].height, cmds[i].format, 1);
+			if (cmds[i].outTextureIndex != NULL)
+				*cmds[i].outTextureIndex = textureIndex;
+		}
+		else
+		{
+			DestroyTextureInternal(cmds[i].textureIndex);
+		}
+	}
+	return -1;
 }
 
-extern "C" UNITY_INTERFACE_EXPORT void* UNITY_INTERFACE_API GetNativeTexturePointer(int textureIndex)
+
+
+
+// --------------------------------------------------------------------------
+// Render thread command queue
+// Lock-free single producer/single consumer ring buffer. The main thread queues copies, clears, blits, mip generations,
+// readbacks and uploads without waiting on the render thread and the kDGRenderEventFlushCommands plugin event drains them on
+// Unity's render thread.
+// Create and destroy are not queued, they still run immediately on the calling thread.
+
+
+static const uint32_t kCommandQueueCapacity = 16384; // must be a power of two
+
+struct CommandQueue
+{
+	alignas(64) std::atomic<uint32_t> head;	// next slot to write, only advanced by the producer
+	alignas(64) std::atomic<uint32_t> tail;	// next slot to read, only advanced by the consumer
+	alignas(64) DGCommand commands[kCommandQueueCapacity];
+};
+
+static CommandQueue s_CommandQueue;
+
+// Returns the number of commands taken from cmds. Commands were checked with ValidateQueuedCommands when they were added
+// to the managed queue, those that went stale since, like readbacks released in between, are released and skipped.
+// Queuing stops when the queue is full, in which case the caller should issue kDGRenderEventFlushCommands and queue the
+// rest once the render thread caught up.
+extern "C" UNITY_INTERFACE_EXPORT int UNITY_INTERFACE_API EnqueueCommandBatch(const DGCommand* cmds, int count)
 {
-	return s_CurrentAPI->GetTexturePointer(textureIndex);
+	if (cmds == NULL || count <= 0)
+		return 0;
+
+	const uint32_t head = s_CommandQueue.head.load(std::memory_order_relaxed);
+	const uint32_t tail = s_CommandQueue.tail.load(std::memory_order_acquire);
+	const uint32_t freeSlots = kCommandQueueCapacity - (head - tail);
+
+	uint32_t queued = 0;
+	int taken = 0;
+	while (queued < freeSlots && taken < count)
+	{
+		const DGCommand& command = cmds[taken++];
+		if (!ValidateQueuedCommand(command))
+		{
+			ReleaseCommandData(command);
+			continue;
+		}
+
+		if (command.type == kDGCommandReadback)
+			FindReadback(command.ticket)->queued.store(true, std::memory_order_release);
+		s_CommandQueue.commands[(head + queued) & (kCommandQueueCapacity - 1)] = command;
+		queued++;
+	}
+
+	s_CommandQueue.head.store(head + queued, std::memory_order_release);
+	return taken;
 }
 
-extern "C" UNITY_INTERFACE_EXPORT void UNITY_INTERFACE_API SetTextureColor(float red, float green, float blue, float alpha, void* targetTexture)
+static void DrainCommandQueue()
 {
-    return s_CurrentAPI->SetTextureColor(red, green, blue, alpha, targetTexture);
+	const uint32_t tail = s_CommandQueue.tail.load(std::memory_order_relaxed);
+	const uint32_t head = s_CommandQueue.head.load(std::memory_order_acquire);
+	if (head == tail)
+		return;
+
+	const uint32_t first = tail & (kCommandQueueCapacity - 1);
+	const uint32_t count = head - tail;
+	const uint32_t firstRun = count < kCommandQueueCapacity - first ? count : kCommandQueueCapacity - first;
+	if (count == firstRun)
+	{
+		ExecuteCommands(s_CommandQueue.commands + first, (int)count);
+	}
+	else
+	{
+		// The optimizer needs the whole flush in one piece when the queued range wraps around the end of the ring
+		static vector<DGCommand> s_WrappedCommands;
+		s_WrappedCommands.assign(s_CommandQueue.commands + first, s_CommandQueue.commands + kCommandQueueCapacity);
+		s_WrappedCommands.insert(s_WrappedCommands.end(), s_CommandQueue.commands, s_CommandQueue.commands + (count - firstRun));
+		ExecuteCommands(s_WrappedCommands.data(), (int)count);
+	}
+
+	s_CommandQueue.tail.store(head, std::memory_order_release);
 }
 
 
@@ -96,6 +1684,7 @@ extern "C" void	UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API UnityPluginLoad(IUnit
 extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API UnityPluginUnload()
 {
 	s_Graphics->UnregisterDeviceEventCallback(OnGraphicsDeviceEvent);
+	ShutdownBCEncoder();
 }
 
 // --------------------------------------------------------------------------
@@ -127,8 +1716,19 @@ static void UNITY_INTERFACE_API OnGraphicsDeviceEvent(UnityGfxDeviceEventType ev
 		s_CurrentAPI = NULL;
 		s_DeviceType = kUnityGfxRendererNull;
 
-		m_TextureCount = 0;
-		m_FreeIndexCount = 0;
+		ResetTextureHandles();
+
+		// Anything still queued refers to textures of the old device, only the memory it owns is released
+		const uint32_t head = s_CommandQueue.head.load(std::memory_order_acquire);
+		for (uint32_t i = s_CommandQueue.tail.load(std::memory_order_relaxed); i != head; ++i)
+			ReleaseCommandData(s_CommandQueue.commands[i & (kCommandQueueCapacity - 1)]);
+		s_CommandQueue.tail.store(head, std::memory_order_release);
+		for (int i = 0; i < kMaxReadbacks; ++i)
+		{
+			const int state = s_Readbacks[i].state.load(std::memory_order_acquire);
+			if (state != kReadbackFree)
+				s_Readbacks[i].state.store(state == kReadbackConsumed ? kReadbackFree : kReadbackFailed, std::memory_order_release);
+		}
 	}
 }
 
@@ -137,8 +1737,8 @@ static void UNITY_INTERFACE_API OnGraphicsDeviceEvent(UnityGfxDeviceEventType ev
 // --------------------------------------------------------------------------
 // OnRenderEvent
 // This will be called for GL.IssuePluginEvent script calls; eventID will
-// be the integer passed to IssuePluginEvent. In this example, we just ignore
-// that value.
+// be the integer passed to IssuePluginEvent. kDGRenderEventFlushCommands
+// executes the command queue, any other value runs the sample code below.
 
 
 static void DrawColoredTriangle()
@@ -194,39 +1794,6 @@ static void ModifyTexturePixels()
 	*/
 
 
-	/*
-	const float t = g_Time * 4.0f;
-
-	unsigned char* dst = (unsigned char*)textureDataPtr;
-	for (int y = 0; y < height; ++y)
-	{
-		unsigned char* ptr = dst;
-		for (int x = 0; x < width; ++x)
-		{
-			// Simple "plasma effect": several combined sine waves
-			int vv = int(
-				(127.0f + (127.0f * sinf(x / 7.0f + t))) +
-				(127.0f + (127.0f * sinf(y / 5.0f - t))) +
-				(127.0f + (127.0f * sinf((x + y) / 6.0f - t))) +
-				(127.0f + (127.0f * sinf(sqrtf(float(x*x + y*y)) / 4.0f - t)))
-				) / 4;
-
-			// Write the texture pixel
-			ptr[0] = vv;
-			ptr[1] = vv;
-			ptr[2] = vv;
-			ptr[3] = vv;
-
-			// To next pixel (our pixels are 4 bpp)
-			ptr += 4;
-		}
-
-		// To next image row
-		dst += textureRowPitch;
-	}
-	*/
-
-
 	//s_CurrentAPI->EndModifyTexture(textureHandle, width, height, textureRowPitch, textureDataPtr);
 
     /*
@@ -248,9 +1815,19 @@ static void UNITY_INTERFACE_API OnRenderEvent(int eventID)
 	if (s_CurrentAPI == NULL)
 		return;
 
-	DrawColoredTriangle();
-	ModifyTexturePixels();
-	//ModifyVertexBuffer();
+	switch (eventID)
+	{
+	case kDGRenderEventFlushCommands:
+		DrainCommandQueue();
+		PollReadbacks();
+		s_CurrentAPI->CollectGarbage();
+		break;
+	default:
+		DrawColoredTriangle();
+		ModifyTexturePixels();
+		//ModifyVertexBuffer();
+		break;
+	}
 }
 
 
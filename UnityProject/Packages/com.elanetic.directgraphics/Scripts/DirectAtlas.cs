@@ -0,0 +1,308 @@
+using System;
+using System.Collections;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+using System.Diagnostics;
+
+using UnityEngine;
+using Debug = UnityEngine.Debug;
+
+namespace Elanetic.Graphics
+{
+    /// <summary>
+    /// A sprite packed into a DirectAtlas.
+    /// </summary>
+    public struct DirectAtlasEntry
+    {
+        /// <summary>
+        /// Id of the sprite within its atlas, -1 when it did not fit. Pass it to DirectAtlas.Remove.
+        /// </summary>
+        public int id;
+        public int page;
+        public RectInt rect;
+        public Rect uvRect;
+
+        public bool isValid { get { return id >= 0; } }
+    }
+
+    /// <summary>
+    /// Packs sprites into atlas pages on the GPU. Pages are native textures of one size and format created on demand, sprites are placed with MaxRects and copied into the pages on the GPU.
+    /// The copies are queued and execute on the rendering thread at the end of the frame or when calling DirectGraphics.Flush, so they keep their order with other queued copies and clears.
+    /// Call Destroy to cleanup the pages. Automatically destroyed upon Application.quitting event and in editor on exit play mode.
+    /// </summary>
+    public class DirectAtlas
+    {
+        #region External Functions
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern int CreateAtlas(int pageWidth, int pageHeight, int format, int padding);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern void DestroyAtlas(int atlas);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern int AtlasAdd(int atlas, [In] DGAtlasSprite[] sprites, int count, [Out] DGAtlasRect[] outRects, [Out] DGCommand[] outCommands);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern void AtlasRemove(int atlas, int entry);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern int AtlasGetPageCount(int atlas);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern int AtlasGetPageTexture(int atlas, int page);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern int AtlasGetEntryCount(int atlas);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern int AtlasRepack(int atlas, [Out] DGAtlasRect[] outRects, [Out] DGCommand[] outCommands);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern void AtlasReleaseRetiredPages(int atlas);
+        #endregion
+
+        public int pageWidth { get; private set; }
+        public int pageHeight { get; private set; }
+        public TextureFormat format { get; private set; }
+        public int padding { get; private set; }
+
+        public bool isDestroyed { get; private set; }
+
+        public int pageCount { get { return m_Pages.Count; } }
+
+        /// <summary>
+        /// Number of sprites currently in the atlas.
+        /// </summary>
+        public int entryCount { get { return AtlasGetEntryCount(m_Atlas); } }
+
+        private int m_Atlas;
+        private List<Texture2D> m_Pages = new List<Texture2D>();
+
+        static private DGAtlasSprite[] m_Sprites = new DGAtlasSprite[1];
+        static private DGAtlasRect[] m_Rects = new DGAtlasRect[1];
+        static private DGCommand[] m_Commands = new DGCommand[2];
+
+        /// <summary>
+        /// Create an empty atlas. Pages of pageWidth x pageHeight are only created once a sprite needs them.
+        /// padding pixels are left clear to the right of and below every sprite so filtering does not bleed between neighbours.
+        /// </summary>
+        public DirectAtlas(int pageWidth, int pageHeight, TextureFormat textureFormat, int padding = 1)
+        {
+#if DEBUG
+            DirectGraphics.ValidateTextureArguments(pageWidth, pageHeight, textureFormat);
+            if(padding < 0)
+            {
+                throw new ArgumentException("Atlas padding can't be negative. Inputted padding: " + padding.ToString(), nameof(padding));
+            }
+#endif
+            m_Atlas = CreateAtlas(pageWidth, pageHeight, DirectGraphics.GetNativeTextureFormat(textureFormat), padding);
+            if(m_Atlas < 0)
+            {
+                throw new SystemException("Atlas creation failed.");
+            }
+
+            this.pageWidth = pageWidth;
+            this.pageHeight = pageHeight;
+            format = textureFormat;
+            this.padding = padding;
+
+            DirectGraphics.m_AllAtlases.Add(this);
+        }
+
+        public DirectAtlasEntry Add(Texture2D source, RectInt sourceRect)
+        {
+            return Add(source.GetNativeTexturePtr(), sourceRect);
+        }
+
+        /// <summary>
+        /// Pack a rectangle of a native texture of the same format as the atlas. Adding many sprites at once with the other Add function packs tighter.
+        /// </summary>
+        public DirectAtlasEntry Add(IntPtr sourceNativePointer, RectInt sourceRect)
+        {
+            m_Sprites[0] = new DGAtlasSprite() { source = sourceNativePointer, x = sourceRect.x, y = sourceRect.y, width = sourceRect.width, height = sourceRect.height };
+            AddSprites(1);
+            return ToEntry(m_Rects[0]);
+        }
+
+        /// <summary>
+        /// Pack many rectangles of native textures at once, largest first. results must be at least as long as sourceRects.
+        /// Sprites that are larger than a page get an entry with id -1.
+        /// </summary>
+        public void Add(IntPtr[] sourceNativePointers, RectInt[] sourceRects, DirectAtlasEntry[] results)
+        {
+#if DEBUG
+            if(sourceNativePointers.Length != sourceRects.Length || results.Length < sourceRects.Length)
+            {
+                throw new ArgumentException("Every source rectangle needs a source texture and a result.");
+            }
+#endif
+            int count = sourceRects.Length;
+            if(m_Sprites.Length < count)
+            {
+                m_Sprites = new DGAtlasSprite[count];
+                m_Rects = new DGAtlasRect[count];
+            }
+            for(int i = 0; i < count; i++)
+            {
+                RectInt sourceRect = sourceRects[i];
+                m_Sprites[i] = new DGAtlasSprite() { source = sourceNativePointers[i], x = sourceRect.x, y = sourceRect.y, width = sourceRect.width, height = sourceRect.height };
+            }
+
+            AddSprites(count);
+
+            for(int i = 0; i < count; i++)
+                results[i] = ToEntry(m_Rects[i]);
+        }
+
+        /// <summary>
+        /// Free the space of a sprite for later sprites. Its pixels stay in the page until they are overwritten.
+        /// </summary>
+        public void Remove(int id)
+        {
+            AtlasRemove(m_Atlas, id);
+        }
+
+        /// <summary>
+        /// Pack every sprite again into new pages to get rid of the holes left by Remove. Sprites keep their ids but move, their new places are written to results which must be at least entryCount long.
+        /// The page textures are replaced so textures returned by GetPageTexture before are destroyed. Returns false and changes nothing when page creation failed.
+        /// </summary>
+        public bool Repack(DirectAtlasEntry[] results)
+        {
+            int count = entryCount;
+#if DEBUG
+            if(results.Length < count)
+            {
+                throw new ArgumentException("Inputted array is too small for every entry of the atlas. Required size: " + count.ToString(), nameof(results));
+            }
+#endif
+            if(m_Rects.Length < count)
+                m_Rects = new DGAtlasRect[count];
+            if(m_Commands.Length < count * 2)
+                m_Commands = new DGCommand[count * 2];
+
+            int commandCount = AtlasRepack(m_Atlas, m_Rects, m_Commands);
+            if(commandCount < 0) return false;
+
+            //The copies out of the old pages have to reach the rendering thread before the old pages are released.
+            DirectGraphics.QueueCommands(m_Commands, commandCount);
+            DirectGraphics.Flush();
+            AtlasReleaseRetiredPages(m_Atlas);
+
+            DestroyPageTextures();
+            SyncPages();
+
+            for(int i = 0; i < count; i++)
+                results[i] = ToEntry(m_Rects[i]);
+            return true;
+        }
+
+        /// <summary>
+        /// The Texture2D of a page. Owned by the atlas, do not destroy it.
+        /// </summary>
+        public Texture2D GetPageTexture(int page)
+        {
+            return m_Pages[page];
+        }
+
+        /// <summary>
+        /// Destroy every page. Destruction is immediate, the native plugin keeps the GPU memory alive until the GPU has finished every frame that used the pages.
+        /// </summary>
+        public void Destroy()
+        {
+            if(isDestroyed) return;
+
+            isDestroyed = true;
+            DirectGraphics.m_AllAtlases.Remove(this);
+
+            //Queued copies may still reference the pages.
+            DirectGraphics.Flush();
+            DestroyPageTextures();
+            DestroyAtlas(m_Atlas);
+        }
+
+        private void AddSprites(int count)
+        {
+#if DEBUG
+            if(isDestroyed)
+            {
+                throw new InvalidOperationException("Can't add sprites to a destroyed DirectAtlas.");
+            }
+#endif
+            if(m_Commands.Length < count * 2)
+                m_Commands = new DGCommand[count * 2];
+
+            int commandCount = AtlasAdd(m_Atlas, m_Sprites, count, m_Rects, m_Commands);
+            DirectGraphics.QueueCommands(m_Commands, commandCount);
+            SyncPages();
+        }
+
+        //Wraps pages created by the native atlas since the last call.
+        private void SyncPages()
+        {
+            int nativePageCount = AtlasGetPageCount(m_Atlas);
+            for(int i = m_Pages.Count; i < nativePageCount; i++)
+            {
+                IntPtr nativePointer = DirectGraphics.GetTexturePointer(AtlasGetPageTexture(m_Atlas, i));
+                Texture2D page = Texture2D.CreateExternalTexture(pageWidth, pageHeight, format, false, true, nativePointer);
+                page.filterMode = FilterMode.Point;
+                m_Pages.Add(page);
+            }
+        }
+
+        private void DestroyPageTextures()
+        {
+            //Unity's textures are destroyed first so Unity stops referencing the native textures before the plugin releases them.
+            for(int i = 0; i < m_Pages.Count; i++)
+                UnityEngine.Object.DestroyImmediate(m_Pages[i]);
+            m_Pages.Clear();
+        }
+
+        private DirectAtlasEntry ToEntry(DGAtlasRect rect)
+        {
+            DirectAtlasEntry entry = new DirectAtlasEntry();
+            entry.id = rect.entry;
+            if(rect.entry < 0) return entry;
+
+            entry.page = rect.page;
+            entry.rect = new RectInt(rect.x, rect.y, rect.width, rect.height);
+            entry.uvRect = new Rect((float)rect.x / pageWidth, (float)rect.y / pageHeight, (float)rect.width / pageWidth, (float)rect.height / pageHeight);
+            return entry;
+        }
+    }
+}
@@ -9,6 +9,8 @@ using System.Diagnostics;
 using UnityEditor;
 #endif
 using UnityEngine;
+using UnityEngine.LowLevel;
+using UnityEngine.PlayerLoop;
 using UnityEngine.Rendering;
 using Debug = UnityEngine.Debug;
 
@@ -31,35 +33,168 @@ namespace Elanetic.Graphics
 #else
         [DllImport("RenderingPlugin")]
 #endif
-        static private extern void CopyTextures(IntPtr texture, int x, int y, int w, int h, IntPtr texture2, int x2, int y2);
+        static private extern int CreateNativeTexture(int width, int height, int format, int mipCount);
 
 #if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
 	[DllImport ("__Internal")]
 #else
         [DllImport("RenderingPlugin")]
 #endif
-        static private extern int CreateNativeTexture(int width, int height, int format);
+        static internal extern IntPtr DestroyNativeTexture(int textureHandle);
 
 #if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
 	[DllImport ("__Internal")]
 #else
         [DllImport("RenderingPlugin")]
 #endif
-        static internal extern IntPtr DestroyNativeTexture(int textureIndex);
+        static internal extern IntPtr GetNativeTexturePointer(int textureHandle);
 
 #if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
 	[DllImport ("__Internal")]
 #else
         [DllImport("RenderingPlugin")]
 #endif
-        static internal extern IntPtr GetNativeTexturePointer(int textureIndex);
+        static private extern int ValidateCommandBatch([In] DGCommand[] commands, int count);
 
 #if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
 	[DllImport ("__Internal")]
 #else
         [DllImport("RenderingPlugin")]
 #endif
-        static private extern void SetTextureColor(float red, float green, float blue, float alpha, IntPtr targetTexture);
+        static private extern int SubmitCommandBatch([In] ref DGCommand commands, int count);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern int ValidateQueuedCommands([In] ref DGCommand commands, int count);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern void ReleaseCommand(ref DGCommand command);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern int EnqueueCommandBatch(IntPtr commands, int count);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern IntPtr GetRenderEventFunc();
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern int RequestReadback(int textureHandle, int x, int y, int width, int height);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern int GetReadbackSize(int ticket);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern int TryGetReadback(int ticket, [Out] byte[] destination, int destinationSize);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal", EntryPoint = "ReleaseReadback")]
+#else
+        [DllImport("RenderingPlugin", EntryPoint = "ReleaseReadback")]
+#endif
+        static private extern int ReleaseNativeReadback(int ticket);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern int CreateUploadCommand(IntPtr texture, int layer, int x, int y, int width, int height, [In] byte[] data, int dataSize, int dataRowPitch, out DGCommand command);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern int CreateCompressedUploadCommand(IntPtr texture, int layer, int x, int y, int width, int height, [In] byte[] rgba, int rgbaSize, int rgbaRowPitch, int quality, out DGCommand command);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal", EntryPoint = "SetTexturePoolCapacity")]
+#else
+        [DllImport("RenderingPlugin", EntryPoint = "SetTexturePoolCapacity")]
+#endif
+        static private extern void SetNativeTexturePoolCapacity(int capacity);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal", EntryPoint = "TrimTexturePool")]
+#else
+        [DllImport("RenderingPlugin", EntryPoint = "TrimTexturePool")]
+#endif
+        static private extern void TrimNativeTexturePool(int maxPooled);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern int CreateNativeTextures([In] DGTextureDesc[] descs, int count, [Out] int[] outHandles, [Out] IntPtr[] outPointers);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern void DestroyNativeTextures([In] int[] handles, int count);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern int CreateNativeTextureArray(int width, int height, int layers, int format);
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern int GetSupportedConvertOptions();
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern int GetSupportsCompressTexture();
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern int GetSupportsGenerateTexture();
+
+#if(UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+        [DllImport("RenderingPlugin")]
+#endif
+        static private extern int CreateGenerateCommand(IntPtr texture, int layer, ref DGGenerateParams parameters, out DGCommand command);
         #endregion
 
         static private readonly GraphicsDeviceType[] SUPPORTED_GRAPHICS_API =
@@ -70,6 +205,15 @@ namespace Elanetic.Graphics
 
         static private int[] TEXTURE_FORMAT_LOOKUP;
         static private List<DirectTexture2D> m_AllTextures = new List<DirectTexture2D>(500);
+        static internal List<DirectAtlas> m_AllAtlases = new List<DirectAtlas>();
+
+        //Scratch arrays for CreateTextures, DestroyTextures and ClearTextures, grown as needed.
+        static private DGTextureDesc[] m_BatchDescs = new DGTextureDesc[0];
+        static private int[] m_BatchHandles = new int[0];
+        static private IntPtr[] m_BatchPointers = new IntPtr[0];
+
+        //Native texture handles hold the texture index in the low bits and a generation counter above it. Must match kTextureIndexBits in the native plugin's RenderingPlugin.cpp.
+        private const int TEXTURE_INDEX_MASK = (1 << 20) - 1;
 
         static DirectGraphics()
         {
@@ -113,40 +257,181 @@ namespace Elanetic.Graphics
         /// </summary>
         static public DirectTexture2D CreateTexture(int width, int height, TextureFormat textureFormat)
         {
+            return CreateTexture(width, height, textureFormat, 1);
+        }
+
+        /// <summary>
+        /// Create a DirectTexture2D with mipCount mip levels. Pass -1 for the full chain down to 1x1, larger counts are clamped to it.
+        /// Copies and clears only change the top level, call GenerateMips afterwards to rebuild the lower levels on the GPU.
+        /// </summary>
+        static public DirectTexture2D CreateTexture(int width, int height, TextureFormat textureFormat, int mipCount)
+        {
+            int textureHandle = CreateTextureHandle(width, height, textureFormat, mipCount);
+            return CreateTextureFromHandle(textureHandle, width, height, textureFormat, mipCount);
+        }
+
+        /// <summary>
+        /// Create only the native texture and return its handle. Safe to call from any thread such as job or worker threads, the native texture is created on the calling thread without waiting for the rendering thread.
+        /// DirectGraphics must have been used once on the main thread beforehand so its static state is initialized.
+        /// Pass the handle to CreateTextureFromHandle on the main thread to get a DirectTexture2D, or destroy it with DestroyTextureHandle.
+        /// </summary>
+        static public int CreateTextureHandle(int width, int height, TextureFormat textureFormat, int mipCount = 1)
+        {
 #if DEBUG
-            if(!IsSupported())
+            ValidateTextureArguments(width, height, textureFormat);
+#endif
+            int textureHandle = CreateNativeTexture(width, height, TEXTURE_FORMAT_LOOKUP[(int)textureFormat], mipCount);
+
+            if(textureHandle < 0)
             {
-                //See supported APIs under the constant variable DirectGraphics.SUPPORTED_GRAPHICS_API.
-                throw new NotSupportedException("DirectGraphics is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'. Choose a supported Graphics API by going to Project Settings -> Other Settings and disable Auto Graphics API for the platform you are currently targeting and disable any non-supported APIs.");
+                //Comment out this exception if implementing a new graphics API for debugging purposes. Sometimes if your lucky you'll get a stack trace from Unity's editor log file for the dll.
+                throw new SystemException("Texture creation failed. Usually occurs when graphics memory has run out or unsupported input texture size or texture format.");
             }
-            if(((int)textureFormat) < 0 || ((int)textureFormat) > 74)
+
+            return textureHandle;
+        }
+
+        /// <summary>
+        /// Create a native texture array of layers same sized layers and return its handle. Safe to call from any thread like CreateTextureHandle.
+        /// Address its layers with the layer overloads of CopyTexture, ClearTexture and UploadTexture through GetTexturePointer, and destroy it with DestroyTextureHandle.
+        /// </summary>
+        static public int CreateTextureArrayHandle(int width, int height, int layers, TextureFormat textureFormat)
+        {
+#if DEBUG
+            ValidateTextureArguments(width, height, textureFormat);
+            if(layers <= 0)
             {
-                throw new ArgumentException("Inputted texture format '" + textureFormat.ToString() + "' is not a valid texture format.", nameof(textureFormat));
+                throw new ArgumentException("The layer count of the texture array to be created must be more than zero. Inputted layer count: " + layers.ToString(), nameof(layers));
             }
-            if(TEXTURE_FORMAT_LOOKUP[(int)textureFormat] == 0)
+#endif
+            int textureHandle = CreateNativeTextureArray(width, height, layers, TEXTURE_FORMAT_LOOKUP[(int)textureFormat]);
+
+            if(textureHandle < 0)
             {
-                throw new ArgumentException("Inputted texture format '" + textureFormat.ToString() + "' is invalid.", nameof(textureFormat));
+                //Comment out this exception if implementing a new graphics API for debugging purposes. Sometimes if your lucky you'll get a stack trace from Unity's editor log file for the dll.
+                throw new SystemException("Texture array creation failed. Usually occurs when graphics memory has run out or unsupported input texture size, layer count or texture format.");
             }
-            if(TEXTURE_FORMAT_LOOKUP[(int)textureFormat] == -1)
+
+            return textureHandle;
+        }
+
+        /// <summary>
+        /// Create a Texture2DArray to fill with the layer overloads of CopyTexture, ClearTexture and UploadTexture, for example to put hundreds of same sized tiles into one texture and one material.
+        /// Unity can't wrap a native texture array so the array is created and owned by Unity without a CPU copy of its pixels. Destroy it with Object.Destroy.
+        /// </summary>
+        static public Texture2DArray CreateTextureArray(int width, int height, int layers, TextureFormat textureFormat)
+        {
+#if DEBUG
+            ValidateTextureArguments(width, height, textureFormat);
+#endif
+            Texture2DArray textureArray = new Texture2DArray(width, height, layers, textureFormat, false);
+            textureArray.Apply(false, true);
+            return textureArray;
+        }
+
+        /// <summary>
+        /// Create count textures with two native calls instead of two per texture, for loading hundreds of textures at once. The textures are written to outTextures.
+        /// Either every texture is created or none is and an exception is thrown. Must be called on the main thread.
+        /// </summary>
+        static public void CreateTextures(DGTextureDesc[] descs, int count, DirectTexture2D[] outTextures)
+        {
+#if DEBUG
+            if(count < 0 || count > descs.Length || count > outTextures.Length)
             {
-                throw new ArgumentException("Inputted texture format '" + textureFormat.ToString() + "' has not been implemented in Elanetic.Graphics.Internal.NativeTextureFormatLookup.", nameof(textureFormat));
+                throw new ArgumentOutOfRangeException(nameof(count), "Count must be between zero and the length of both arrays. Inputted count: " + count.ToString());
             }
-            if(width <= 0 || height <= 0)
+            for(int i = 0; i < count; i++)
             {
-                throw new ArgumentException("The width and height of the texture to be created must be more than zero. Inputted size: " + width.ToString() + ", " + height.ToString());
+                ValidateTextureArguments(descs[i].width, descs[i].height, descs[i].format);
+            }
+#endif
+            if(count == 0) return;
+
+            if(m_BatchDescs.Length < count)
+            {
+                m_BatchDescs = new DGTextureDesc[count];
+                m_BatchHandles = new int[count];
+                m_BatchPointers = new IntPtr[count];
+            }
+            //The plugin takes native formats, translate them into a separate array so the caller's descriptions are left untouched.
+            for(int i = 0; i < count; i++)
+            {
+                m_BatchDescs[i].width = descs[i].width;
+                m_BatchDescs[i].height = descs[i].height;
+                m_BatchDescs[i].format = (TextureFormat)TEXTURE_FORMAT_LOOKUP[(int)descs[i].format];
+                m_BatchDescs[i].mipCount = descs[i].mipCount;
+            }
+
+            int created = CreateNativeTextures(m_BatchDescs, count, m_BatchHandles, m_BatchPointers);
+            if(created != count)
+            {
+                DestroyNativeTextures(m_BatchHandles, count);
+                throw new SystemException("Creation of " + (count - created).ToString() + " out of " + count.ToString() + " textures failed. Usually occurs when graphics memory has run out or unsupported input texture size or texture format.");
+            }
+
+            for(int i = 0; i < count; i++)
+            {
+                outTextures[i] = RegisterTexture(new DirectTexture2D(m_BatchHandles[i], descs[i].width, descs[i].height, descs[i].format, HasMipChain(descs[i].mipCount), m_BatchPointers[i]));
+            }
+        }
+
+        /// <summary>
+        /// Destroy count textures with a single native call. Already destroyed textures are skipped. Must be called on the main thread.
+        /// </summary>
+        static public void DestroyTextures(DirectTexture2D[] textures, int count)
+        {
+#if DEBUG
+            if(count < 0 || count > textures.Length)
+            {
+                throw new ArgumentOutOfRangeException(nameof(count), "Count must be between zero and the length of the textures array. Inputted count: " + count.ToString());
             }
 #endif
-            SyncRenderingThread();
+            //Queued commands may still reference these textures, see DestroyDirectTexture.
+            if(m_PendingCommandCount > 0)
+                Flush();
 
-            int textureIndex = CreateNativeTexture(width, height, TEXTURE_FORMAT_LOOKUP[(int)textureFormat]);
+            if(m_BatchHandles.Length < count)
+                m_BatchHandles = new int[count];
 
-            if(textureIndex < 0)
+            int destroyed = 0;
+            for(int i = 0; i < count; i++)
             {
-                //Comment out this exception if implementing a new graphics API for debugging purposes. Sometimes if your lucky you'll get a stack trace from Unity's editor log file for the dll.
-                throw new SystemException("Texture creation failed. Usually occurs when graphics memory has run out or unsupported input texture size or texture format.");
+                DirectTexture2D texture = textures[i];
+                if(texture == null || !texture.DestroyUnityTexture()) continue;
+
+                m_AllTextures[texture.textureHandle & TEXTURE_INDEX_MASK] = null;
+                m_BatchHandles[destroyed++] = texture.textureHandle;
+            }
+
+            if(destroyed > 0)
+                DestroyNativeTextures(m_BatchHandles, destroyed);
+        }
+
+        /// <summary>
+        /// Wrap a native texture created with CreateTextureHandle in a DirectTexture2D. Must be called on the main thread with the same size, format and mip count the handle was created with.
+        /// The DirectTexture2D takes ownership of the handle, destroy it with DirectTexture2D.Destroy from then on.
+        /// </summary>
+        static public DirectTexture2D CreateTextureFromHandle(int textureHandle, int width, int height, TextureFormat textureFormat, int mipCount = 1)
+        {
+            IntPtr nativePointer = GetNativeTexturePointer(textureHandle);
+#if DEBUG
+            if(nativePointer == IntPtr.Zero)
+            {
+                throw new ArgumentException("Texture handle '" + textureHandle.ToString() + "' does not refer to a living native texture.", nameof(textureHandle));
             }
+#endif
+            return RegisterTexture(new DirectTexture2D(textureHandle, width, height, textureFormat, HasMipChain(mipCount), nativePointer));
+        }
+
+        //Mip counts of 0 and 1 create a single level, negative ones the full chain.
+        static private bool HasMipChain(int mipCount)
+        {
+            return mipCount < 0 || mipCount > 1;
+        }
 
-            DirectTexture2D directTexture = new DirectTexture2D(textureIndex, width, height, textureFormat, GetNativeTexturePointer(textureIndex));
+        static private DirectTexture2D RegisterTexture(DirectTexture2D directTexture)
+        {
+            int textureIndex = directTexture.textureHandle & TEXTURE_INDEX_MASK;
             if(textureIndex >= m_AllTextures.Count)
             {
                 while(textureIndex > m_AllTextures.Count)
@@ -160,6 +445,55 @@ namespace Elanetic.Graphics
             return directTexture;
         }
 
+        /// <summary>
+        /// Native pointer of a texture handle or IntPtr.Zero when the handle has been destroyed. Safe to call from any thread.
+        /// </summary>
+        static public IntPtr GetTexturePointer(int textureHandle)
+        {
+            return GetNativeTexturePointer(textureHandle);
+        }
+
+        /// <summary>
+        /// Destroy a native texture that was never passed to CreateTextureFromHandle. Safe to call from any thread, stale handles are ignored.
+        /// Commands already queued on the main thread that use the texture still finish before its memory is released.
+        /// </summary>
+        static public void DestroyTextureHandle(int textureHandle)
+        {
+            DestroyNativeTexture(textureHandle);
+        }
+
+        static internal int GetNativeTextureFormat(TextureFormat textureFormat)
+        {
+            return TEXTURE_FORMAT_LOOKUP[(int)textureFormat];
+        }
+
+#if DEBUG
+        static internal void ValidateTextureArguments(int width, int height, TextureFormat textureFormat)
+        {
+            if(!IsSupported())
+            {
+                //See supported APIs under the constant variable DirectGraphics.SUPPORTED_GRAPHICS_API.
+                throw new NotSupportedException("DirectGraphics is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'. Choose a supported Graphics API by going to Project Settings -> Other Settings and disable Auto Graphics API for the platform you are currently targeting and disable any non-supported APIs.");
+            }
+            if(((int)textureFormat) < 0 || ((int)textureFormat) > 74)
+            {
+                throw new ArgumentException("Inputted texture format '" + textureFormat.ToString() + "' is not a valid texture format.", nameof(textureFormat));
+            }
+            if(TEXTURE_FORMAT_LOOKUP[(int)textureFormat] == 0)
+            {
+                throw new ArgumentException("Inputted texture format '" + textureFormat.ToString() + "' is invalid.", nameof(textureFormat));
+            }
+            if(TEXTURE_FORMAT_LOOKUP[(int)textureFormat] == -1)
+            {
+                throw new ArgumentException("Inputted texture format '" + textureFormat.ToString() + "' has not been implemented in Elanetic.Graphics.Internal.NativeTextureFormatLookup.", nameof(textureFormat));
+            }
+            if(width <= 0 || height <= 0)
+            {
+                throw new ArgumentException("The width and height of the texture to be created must be more than zero. Inputted size: " + width.ToString() + ", " + height.ToString());
+            }
+        }
+#endif
+
         static public void CopyTexture(Texture2D source, Texture2D destination)
         {
             CopyTexture(source.GetNativeTexturePtr(), 0, 0, source.width, source.height, destination.GetNativeTexturePtr(), 0, 0);
@@ -172,6 +506,7 @@ namespace Elanetic.Graphics
 
 
         /// <summary>
+        /// Copies and clears are queued and executed on the rendering thread at the end of the frame or when calling DirectGraphics.Flush.
         /// Cache Texture2D.GetNativeTexturePtr() pointer and use this function since calling the other function is slower.
         /// Make sure to not alter the Texture2D using functions such as SetPixels or GetRawTextureData(Basically altering on the CPU side) otherwise the pointer will become invalid and these CopyTexture function results will be overidden by Texture2D.Apply that you do.
         /// Texture2D.Apply uploads to the GPU overwriting and previous copies.
@@ -186,24 +521,19 @@ namespace Elanetic.Graphics
                 throw new NotSupportedException("DirectGraphics is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'. Choose a supported Graphics API by going to Project Settings -> Other Settings and disable Auto Graphics API for the platform you are currently targeting and disable any non-supported APIs.");
             }
 #endif
-            SyncRenderingThread();
-            CopyTextures(sourceNativePointer, sourceX, sourceY, width, height, destinationNativePointer, destinationX, destinationY);
+            QueueCommand(DGCommand.Copy(sourceNativePointer, sourceX, sourceY, width, height, destinationNativePointer, destinationX, destinationY));
         }
 
-        static public void ClearTexture(Color color, Texture2D targetTexture)
+        static public void CopyTexture(Texture2D source, int sourceX, int sourceY, int width, int height, Texture2DArray destination, int destinationLayer, int destinationX, int destinationY)
         {
-#if DEBUG
-            if(!IsSupported())
-            {
-                //See supported APIs under the constant variable DirectGraphics.SUPPORTED_GRAPHICS_API.
-                throw new NotSupportedException("DirectGraphics is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'. Choose a supported Graphics API by going to Project Settings -> Other Settings and disable Auto Graphics API for the platform you are currently targeting and disable any non-supported APIs.");
-            }
-#endif
-            SyncRenderingThread();
-            SetTextureColor(color.r, color.g, color.b, color.a, targetTexture.GetNativeTexturePtr());
+            CopyTexture(source.GetNativeTexturePtr(), 0, sourceX, sourceY, width, height, destination.GetNativeTexturePtr(), destinationLayer, destinationX, destinationY);
         }
 
-        static public void ClearTexture(Texture2D targetTexture)
+        /// <summary>
+        /// Copy between array layers, pass layer 0 for textures that are no array. Queued like the other CopyTexture functions.
+        /// Layers past the end of a texture array are skipped.
+        /// </summary>
+        static public void CopyTexture(IntPtr sourceNativePointer, int sourceLayer, int sourceX, int sourceY, int width, int height, IntPtr destinationNativePointer, int destinationLayer, int destinationX, int destinationY)
         {
 #if DEBUG
             if(!IsSupported())
@@ -211,12 +541,20 @@ namespace Elanetic.Graphics
                 //See supported APIs under the constant variable DirectGraphics.SUPPORTED_GRAPHICS_API.
                 throw new NotSupportedException("DirectGraphics is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'. Choose a supported Graphics API by going to Project Settings -> Other Settings and disable Auto Graphics API for the platform you are currently targeting and disable any non-supported APIs.");
             }
+            if(sourceLayer < 0 || destinationLayer < 0)
+            {
+                throw new ArgumentOutOfRangeException("Array layers can't be negative. Inputted layers: " + sourceLayer.ToString() + ", " + destinationLayer.ToString());
+            }
 #endif
-            SyncRenderingThread();
-            SetTextureColor(0.0f, 0.0f, 0.0f, 0.0f, targetTexture.GetNativeTexturePtr());
+            QueueCommand(DGCommand.Copy(sourceNativePointer, sourceLayer, sourceX, sourceY, width, height, destinationNativePointer, destinationLayer, destinationX, destinationY));
         }
 
-        static public void ClearTexture(Color color, IntPtr targetTexturePointer)
+        /// <summary>
+        /// Copy many rectangles from the same source texture to the same destination texture. Queued like the other CopyTexture functions, the rendering thread records the regions with as few GPU copy commands as it can.
+        /// Regions writing over each other are copied in order. When copying within one texture a region may not overlap its own source rectangle.
+        /// Returns -1 on success otherwise the index of the first invalid region in which case nothing was queued.
+        /// </summary>
+        static public int CopyTexture(IntPtr sourceNativePointer, IntPtr destinationNativePointer, DGCopyRegion[] regions, int count)
         {
 #if DEBUG
             if(!IsSupported())
@@ -224,12 +562,509 @@ namespace Elanetic.Graphics
                 //See supported APIs under the constant variable DirectGraphics.SUPPORTED_GRAPHICS_API.
                 throw new NotSupportedException("DirectGraphics is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'. Choose a supported Graphics API by going to Project Settings -> Other Settings and disable Auto Graphics API for the platform you are currently targeting and disable any non-supported APIs.");
             }
+            if(regions == null)
+            {
+                throw new ArgumentNullException(nameof(regions));
+            }
+            if(count < 0 || count > regions.Length)
+            {
+                throw new ArgumentOutOfRangeException(nameof(count), "Region count must be between zero and the length of the region array. Inputted count: " + count.ToString());
+            }
 #endif
-            SyncRenderingThread();
-            SetTextureColor(color.r, color.g, color.b, color.a, targetTexturePointer);
+            if(count <= 0)
+                return -1;
+            if(sourceNativePointer == IntPtr.Zero || destinationNativePointer == IntPtr.Zero)
+                return 0;
+
+            for(int i = 0; i < count; i++)
+            {
+                DGCopyRegion region = regions[i];
+                if(region.width <= 0 || region.height <= 0 || region.sourceX < 0 || region.sourceY < 0 || region.destinationX < 0 || region.destinationY < 0)
+                    return i;
+                if(sourceNativePointer == destinationNativePointer &&
+                    region.sourceX < region.destinationX + region.width && region.destinationX < region.sourceX + region.width &&
+                    region.sourceY < region.destinationY + region.height && region.destinationY < region.sourceY + region.height)
+                    return i;
+            }
+
+            for(int i = 0; i < count; i++)
+            {
+                DGCopyRegion region = regions[i];
+                QueueCommand(DGCommand.Copy(sourceNativePointer, region.sourceX, region.sourceY, region.width, region.height, destinationNativePointer, region.destinationX, region.destinationY));
+            }
+            return -1;
+        }
+
+        static public void ClearTexture(Color color, Texture2D targetTexture)
+        {
+#if DEBUG
+            if(!IsSupported())
+            {
+                //See supported APIs under the constant variable DirectGraphics.SUPPORTED_GRAPHICS_API.
+                throw new NotSupportedException("DirectGraphics is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'. Choose a supported Graphics API by going to Project Settings -> Other Settings and disable Auto Graphics API for the platform you are currently targeting and disable any non-supported APIs.");
+            }
+#endif
+            QueueCommand(DGCommand.Clear(color, targetTexture.GetNativeTexturePtr()));
+        }
+
+        static public void ClearTexture(Texture2D targetTexture)
+        {
+#if DEBUG
+            if(!IsSupported())
+            {
+                //See supported APIs under the constant variable DirectGraphics.SUPPORTED_GRAPHICS_API.
+                throw new NotSupportedException("DirectGraphics is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'. Choose a supported Graphics API by going to Project Settings -> Other Settings and disable Auto Graphics API for the platform you are currently targeting and disable any non-supported APIs.");
+            }
+#endif
+            QueueCommand(DGCommand.Clear(Color.clear, targetTexture.GetNativeTexturePtr()));
+        }
+
+        static public void ClearTexture(Color color, IntPtr targetTexturePointer)
+        {
+#if DEBUG
+            if(!IsSupported())
+            {
+                //See supported APIs under the constant variable DirectGraphics.SUPPORTED_GRAPHICS_API.
+                throw new NotSupportedException("DirectGraphics is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'. Choose a supported Graphics API by going to Project Settings -> Other Settings and disable Auto Graphics API for the platform you are currently targeting and disable any non-supported APIs.");
+            }
+#endif
+            QueueCommand(DGCommand.Clear(color, targetTexturePointer));
+        }
+
+        static public void ClearTexture(IntPtr targetTexturePointer)
+        {
+#if DEBUG
+            if(!IsSupported())
+            {
+                //See supported APIs under the constant variable DirectGraphics.SUPPORTED_GRAPHICS_API.
+                throw new NotSupportedException("DirectGraphics is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'. Choose a supported Graphics API by going to Project Settings -> Other Settings and disable Auto Graphics API for the platform you are currently targeting and disable any non-supported APIs.");
+            }
+#endif
+            QueueCommand(DGCommand.Clear(Color.clear, targetTexturePointer));
+        }
+
+        static public void ClearTexture(Color color, Texture2DArray targetTexture, int layer)
+        {
+            ClearTexture(color, targetTexture.GetNativeTexturePtr(), layer);
+        }
+
+        /// <summary>
+        /// Clear a single array layer, the other layers keep their contents. Layers past the end of the texture array are skipped.
+        /// </summary>
+        static public void ClearTexture(Color color, IntPtr targetTexturePointer, int layer)
+        {
+#if DEBUG
+            if(!IsSupported())
+            {
+                //See supported APIs under the constant variable DirectGraphics.SUPPORTED_GRAPHICS_API.
+                throw new NotSupportedException("DirectGraphics is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'. Choose a supported Graphics API by going to Project Settings -> Other Settings and disable Auto Graphics API for the platform you are currently targeting and disable any non-supported APIs.");
+            }
+            if(layer < 0)
+            {
+                throw new ArgumentOutOfRangeException(nameof(layer), "Array layers can't be negative. Inputted layer: " + layer.ToString());
+            }
+#endif
+            QueueCommand(DGCommand.Clear(color, targetTexturePointer, layer));
+        }
+
+        static public int ClearTexture(Color color, Texture2D targetTexture, DGRect[] rects, int count)
+        {
+            return ClearTexture(color, targetTexture.GetNativeTexturePtr(), 0, rects, count);
+        }
+
+        /// <summary>
+        /// Clear many rectangles of an array layer to the same color at once, the rest of the texture keeps its contents. Rectangles are clipped to the texture.
+        /// On compressed textures rectangles have to start on a 4x4 block and end on one unless they reach the right or bottom edge, other rectangles are skipped.
+        /// Queued like ClearTexture, consecutive rectangles of the same layer and color are cleared together on the rendering thread.
+        /// Returns -1 on success otherwise the index of the first invalid rectangle in which case nothing was queued.
+        /// </summary>
+        static public int ClearTexture(Color color, IntPtr targetTexturePointer, int layer, DGRect[] rects, int count)
+        {
+#if DEBUG
+            if(!IsSupported())
+            {
+                //See supported APIs under the constant variable DirectGraphics.SUPPORTED_GRAPHICS_API.
+                throw new NotSupportedException("DirectGraphics is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'. Choose a supported Graphics API by going to Project Settings -> Other Settings and disable Auto Graphics API for the platform you are currently targeting and disable any non-supported APIs.");
+            }
+            if(layer < 0)
+            {
+                throw new ArgumentOutOfRangeException(nameof(layer), "Array layers can't be negative. Inputted layer: " + layer.ToString());
+            }
+            if(rects == null)
+            {
+                throw new ArgumentNullException(nameof(rects));
+            }
+            if(count < 0 || count > rects.Length)
+            {
+                throw new ArgumentOutOfRangeException(nameof(count), "Rectangle count must be between zero and the length of the rectangle array. Inputted count: " + count.ToString());
+            }
+#endif
+            if(count <= 0)
+                return -1;
+            if(targetTexturePointer == IntPtr.Zero || layer < 0)
+                return 0;
+
+            for(int i = 0; i < count; i++)
+            {
+                if(rects[i].width <= 0 || rects[i].height <= 0)
+                    return i;
+            }
+
+            for(int i = 0; i < count; i++)
+                QueueCommand(DGCommand.Clear(color, targetTexturePointer, layer, rects[i]));
+            return -1;
+        }
+
+        /// <summary>
+        /// Clear count textures, each to its own color, for example to reset a pool of textures at once. Queued like ClearTexture, the clears are recorded
+        /// back to back on the rendering thread with as few barriers as the graphics API allows. Only the first layer of texture arrays is cleared.
+        /// Returns -1 on success otherwise the index of the first invalid texture in which case nothing was queued.
+        /// </summary>
+        static public int ClearTextures(Texture2D[] textures, Color[] colors, int count)
+        {
+#if DEBUG
+            if(textures == null)
+            {
+                throw new ArgumentNullException(nameof(textures));
+            }
+            if(count < 0 || count > textures.Length)
+            {
+                throw new ArgumentOutOfRangeException(nameof(count), "Count must be between zero and the length of the textures array. Inputted count: " + count.ToString());
+            }
+#endif
+            if(m_BatchPointers.Length < count)
+                m_BatchPointers = new IntPtr[count];
+
+            for(int i = 0; i < count; i++)
+                m_BatchPointers[i] = textures[i] != null ? textures[i].GetNativeTexturePtr() : IntPtr.Zero;
+
+            return ClearTextures(m_BatchPointers, colors, count);
+        }
+
+        static public int ClearTextures(IntPtr[] texturePointers, Color[] colors, int count)
+        {
+#if DEBUG
+            if(!IsSupported())
+            {
+                //See supported APIs under the constant variable DirectGraphics.SUPPORTED_GRAPHICS_API.
+                throw new NotSupportedException("DirectGraphics is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'. Choose a supported Graphics API by going to Project Settings -> Other Settings and disable Auto Graphics API for the platform you are currently targeting and disable any non-supported APIs.");
+            }
+            if(texturePointers == null)
+            {
+                throw new ArgumentNullException(nameof(texturePointers));
+            }
+            if(colors == null)
+            {
+                throw new ArgumentNullException(nameof(colors));
+            }
+            if(count < 0 || count > texturePointers.Length || count > colors.Length)
+            {
+                throw new ArgumentOutOfRangeException(nameof(count), "Count must be between zero and the length of the texture and color arrays. Inputted count: " + count.ToString());
+            }
+#endif
+            for(int i = 0; i < count; i++)
+            {
+                if(texturePointers[i] == IntPtr.Zero)
+                    return i;
+            }
+
+            for(int i = 0; i < count; i++)
+                QueueCommand(DGCommand.Clear(colors[i], texturePointers[i]));
+            return -1;
+        }
+
+        /// <summary>
+        /// Scale the whole source texture over the whole destination texture. Queued like CopyTexture, the formats may differ.
+        /// </summary>
+        static public void BlitTexture(Texture2D source, Texture2D destination, FilterMode filterMode = FilterMode.Bilinear)
+        {
+            BlitTexture(source.GetNativeTexturePtr(), 0, 0, source.width, source.height, destination.GetNativeTexturePtr(), 0, 0, destination.width, destination.height, filterMode);
+        }
+
+        static public void BlitTexture(Texture2D source, int sourceX, int sourceY, int sourceWidth, int sourceHeight, Texture2D destination, int destinationX, int destinationY, int destinationWidth, int destinationHeight, FilterMode filterMode = FilterMode.Bilinear)
+        {
+            BlitTexture(source.GetNativeTexturePtr(), sourceX, sourceY, sourceWidth, sourceHeight, destination.GetNativeTexturePtr(), destinationX, destinationY, destinationWidth, destinationHeight, filterMode);
+        }
+
+        /// <summary>
+        /// Scale a rectangle of the source texture into a rectangle of the destination texture on the GPU, converting the format when they differ.
+        /// Formats the GPU can't scale, compressed formats for example, fall back to nearest sampling in whole blocks and need the same block size on both sides.
+        /// </summary>
+        static public void BlitTexture(IntPtr sourceNativePointer, int sourceX, int sourceY, int sourceWidth, int sourceHeight, IntPtr destinationNativePointer, int destinationX, int destinationY, int destinationWidth, int destinationHeight, FilterMode filterMode = FilterMode.Bilinear)
+        {
+#if DEBUG
+            if(!IsSupported())
+            {
+                //See supported APIs under the constant variable DirectGraphics.SUPPORTED_GRAPHICS_API.
+                throw new NotSupportedException("DirectGraphics is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'. Choose a supported Graphics API by going to Project Settings -> Other Settings and disable Auto Graphics API for the platform you are currently targeting and disable any non-supported APIs.");
+            }
+            if(sourceWidth <= 0 || sourceHeight <= 0 || destinationWidth <= 0 || destinationHeight <= 0)
+            {
+                throw new ArgumentException("The source and destination rectangles of a blit must be larger than zero. Inputted sizes: " + sourceWidth.ToString() + "x" + sourceHeight.ToString() + ", " + destinationWidth.ToString() + "x" + destinationHeight.ToString());
+            }
+#endif
+            QueueCommand(DGCommand.Blit(sourceNativePointer, sourceX, sourceY, sourceWidth, sourceHeight, destinationNativePointer, destinationX, destinationY, destinationWidth, destinationHeight, filterMode));
+        }
+
+        /// <summary>
+        /// Options ConvertTexture supports on the current Graphics API. Metal and Vulkan support all of them.
+        /// </summary>
+        static public ConvertOptions supportedConvertOptions { get { return (ConvertOptions)GetSupportedConvertOptions(); } }
+
+        static public void ConvertTexture(Texture source, Texture destination, ConvertOptions options = ConvertOptions.None)
+        {
+            ConvertTexture(source.GetNativeTexturePtr(), 0, 0, source.width, source.height, destination.GetNativeTexturePtr(), 0, 0, options);
+        }
+
+        /// <summary>
+        /// Copy a rectangle between textures of different formats on the GPU, instead of reading it back and uploading it again on the CPU.
+        /// Metal handles any combination of RGBA32, BGRA32, R8, RG16, RGBAHalf and RGBAFloat including their sRGB variants with every option. Queued like CopyTexture.
+        /// Vulkan converts formats its GPU can blit between with a blit, which applies no option but the sRGB ones. Swizzle, PremultiplyAlpha and formats without blit support
+        /// go through a compute shader instead, which handles any combination of RGBA32, BGRA32, RGBAHalf and RGBAFloat and the sRGB variants of the first two. Other conversions are skipped.
+        /// The options are applied to the color read from the source in the order Swizzle, SRGBToLinear, PremultiplyAlpha and LinearToSRGB before it is written to the destination.
+        /// </summary>
+        static public void ConvertTexture(IntPtr sourceNativePointer, int sourceX, int sourceY, int width, int height, IntPtr destinationNativePointer, int destinationX, int destinationY, ConvertOptions options = ConvertOptions.None)
+        {
+#if DEBUG
+            ValidateConvertArguments(width, height, options);
+#endif
+            QueueCommand(DGCommand.Convert(sourceNativePointer, sourceX, sourceY, width, height, destinationNativePointer, destinationX, destinationY, options));
+        }
+
+        /// <summary>
+        /// Convert and reorder the channels. Every destination channel takes the source channel given for it, before any of the other options are applied.
+        /// </summary>
+        static public void ConvertTexture(IntPtr sourceNativePointer, int sourceX, int sourceY, int width, int height, IntPtr destinationNativePointer, int destinationX, int destinationY, ConvertOptions options, SwizzleChannel red, SwizzleChannel green, SwizzleChannel blue, SwizzleChannel alpha)
+        {
+            options |= ConvertOptions.Swizzle;
+#if DEBUG
+            ValidateConvertArguments(width, height, options);
+#endif
+            DGCommand command = DGCommand.Convert(sourceNativePointer, sourceX, sourceY, width, height, destinationNativePointer, destinationX, destinationY, options);
+            command.swizzle = (int)red | ((int)green << 4) | ((int)blue << 8) | ((int)alpha << 12);
+            QueueCommand(command);
+        }
+
+#if DEBUG
+        static private void ValidateConvertArguments(int width, int height, ConvertOptions options)
+        {
+            if(!IsSupported())
+            {
+                //See supported APIs under the constant variable DirectGraphics.SUPPORTED_GRAPHICS_API.
+                throw new NotSupportedException("DirectGraphics is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'. Choose a supported Graphics API by going to Project Settings -> Other Settings and disable Auto Graphics API for the platform you are currently targeting and disable any non-supported APIs.");
+            }
+            if(width <= 0 || height <= 0)
+            {
+                throw new ArgumentException("The rectangle to convert must be larger than zero. Inputted size: " + width.ToString() + "x" + height.ToString());
+            }
+            if((options & ~supportedConvertOptions) != 0)
+            {
+                throw new NotSupportedException("Convert options '" + (options & ~supportedConvertOptions).ToString() + "' are not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'.");
+            }
+        }
+#endif
+
+        /// <summary>
+        /// Whether CompressTexture is available on the current Graphics API. Vulkan and Metal on macOS encode block compressed textures on the GPU.
+        /// </summary>
+        static public bool supportsCompressTexture { get { return GetSupportsCompressTexture() != 0; } }
+
+        static public void CompressTexture(Texture source, Texture destination, CompressQuality quality = CompressQuality.Fast)
+        {
+            CompressTexture(source.GetNativeTexturePtr(), 0, 0, source.width, source.height, destination.GetNativeTexturePtr(), 0, 0, quality);
+        }
+
+        /// <summary>
+        /// Encode a rectangle of an uncompressed texture into a DXT1 (BC1), DXT5 (BC3) or BC7 texture on the GPU, one compute thread per 4x4 block. Queued like CopyTexture.
+        /// The destination position must be a multiple of 4. Rectangles that are no multiple of 4 in size repeat their last row and column to fill the edge blocks.
+        /// Vulkan reads RGBA32, BGRA32, RGBAHalf and RGBAFloat sources and the sRGB variants of the first two, other sources leave the destination as it is.
+        /// </summary>
+        static public void CompressTexture(IntPtr sourceNativePointer, int sourceX, int sourceY, int width, int height, IntPtr destinationNativePointer, int destinationX, int destinationY, CompressQuality quality = CompressQuality.Fast)
+        {
+#if DEBUG
+            if(!IsSupported())
+            {
+                //See supported APIs under the constant variable DirectGraphics.SUPPORTED_GRAPHICS_API.
+                throw new NotSupportedException("DirectGraphics is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'. Choose a supported Graphics API by going to Project Settings -> Other Settings and disable Auto Graphics API for the platform you are currently targeting and disable any non-supported APIs.");
+            }
+            if(!supportsCompressTexture)
+            {
+                throw new NotSupportedException("CompressTexture is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'.");
+            }
+            if(width <= 0 || height <= 0)
+            {
+                throw new ArgumentException("The rectangle to compress must be larger than zero. Inputted size: " + width.ToString() + "x" + height.ToString());
+            }
+            if(destinationX % 4 != 0 || destinationY % 4 != 0)
+            {
+                throw new ArgumentException("The destination of a compressed rectangle must be aligned to the 4x4 blocks. Inputted position: " + destinationX.ToString() + ", " + destinationY.ToString());
+            }
+#endif
+            QueueCommand(DGCommand.Compress(sourceNativePointer, sourceX, sourceY, width, height, destinationNativePointer, destinationX, destinationY, quality));
+        }
+
+        /// <summary>
+        /// Rebuild every mip level below the top one from the top level on the GPU. Queued like CopyTexture and ClearTexture, textures without mips are left alone.
+        /// Queue the mip generation of many textures back to back, the GPU then builds their chains together.
+        /// </summary>
+        static public void GenerateMips(Texture2D texture)
+        {
+            GenerateMips(texture.GetNativeTexturePtr());
+        }
+
+        static public void GenerateMips(IntPtr textureNativePointer)
+        {
+#if DEBUG
+            if(!IsSupported())
+            {
+                //See supported APIs under the constant variable DirectGraphics.SUPPORTED_GRAPHICS_API.
+                throw new NotSupportedException("DirectGraphics is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'. Choose a supported Graphics API by going to Project Settings -> Other Settings and disable Auto Graphics API for the platform you are currently targeting and disable any non-supported APIs.");
+            }
+#endif
+            QueueCommand(DGCommand.GenerateMips(textureNativePointer));
+        }
+
+        /// <summary>
+        /// Queue many copy and clear operations at once, validated with a single native call instead of one call per operation. Build the commands with DGCommand.Copy, DGCommand.Blit, DGCommand.Convert, DGCommand.Clear and DGCommand.GenerateMips.
+        /// All commands are validated before any of them are queued, they then execute on the rendering thread in order with the other queued copies and clears.
+        /// Texture creations and destructions in the batch run right away instead, after everything queued before them has been sent to the rendering thread.
+        /// Returns -1 on success otherwise the index of the first invalid command in which case none of the commands were queued.
+        /// </summary>
+        static public int SubmitCommands(DGCommand[] commands, int count)
+        {
+#if DEBUG
+            if(!IsSupported())
+            {
+                //See supported APIs under the constant variable DirectGraphics.SUPPORTED_GRAPHICS_API.
+                throw new NotSupportedException("DirectGraphics is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'. Choose a supported Graphics API by going to Project Settings -> Other Settings and disable Auto Graphics API for the platform you are currently targeting and disable any non-supported APIs.");
+            }
+            if(commands == null)
+            {
+                throw new ArgumentNullException(nameof(commands));
+            }
+            if(count < 0 || count > commands.Length)
+            {
+                throw new ArgumentOutOfRangeException(nameof(count), "Command count must be between zero and the length of the command array. Inputted count: " + count.ToString());
+            }
+#endif
+            int invalid = ValidateCommandBatch(commands, count);
+            if(invalid >= 0)
+                return invalid;
+
+            //Creations and destructions record nothing and run on this thread, everything else is queued for the rendering thread.
+            int start = 0;
+            while(start < count)
+            {
+                bool immediate = commands[start].IsImmediate();
+                int end = start + 1;
+                while(end < count && commands[end].IsImmediate() == immediate)
+                    end++;
+
+                if(immediate)
+                {
+                    //Queued commands may still reference a texture destroyed here.
+                    if(m_PendingCommandCount > 0)
+                        Flush();
+                    SubmitCommandBatch(ref commands[start], end - start);
+                }
+                else
+                {
+                    AppendCommands(commands, start, end - start);
+                }
+                start = end;
+            }
+            return -1;
+        }
+
+        /// <summary>
+        /// Upload pixel data from the CPU into a rectangle of the texture without recreating it like Texture2D.SetPixels and Texture2D.Apply.
+        /// Rows in data are dataRowPitch bytes apart. Compressed formats are uploaded as rows of blocks. Queued like CopyTexture, data is copied right away so the array can be reused as soon as this returns.
+        /// </summary>
+        static public bool UploadTexture(IntPtr targetTexturePointer, int x, int y, int width, int height, byte[] data, int dataRowPitch)
+        {
+            return UploadTexture(targetTexturePointer, 0, x, y, width, height, data, dataRowPitch);
+        }
+
+        /// <summary>
+        /// Upload into a rectangle of an array layer, pass layer 0 for textures that are no array. Layers past the end of the texture array are skipped.
+        /// Returns false when the arguments are invalid, also when dataRowPitch is shorter than a row of the texture or data holds fewer than every row of the rectangle.
+        /// </summary>
+        static public bool UploadTexture(IntPtr targetTexturePointer, int layer, int x, int y, int width, int height, byte[] data, int dataRowPitch)
+        {
+#if DEBUG
+            if(!IsSupported())
+            {
+                //See supported APIs under the constant variable DirectGraphics.SUPPORTED_GRAPHICS_API.
+                throw new NotSupportedException("DirectGraphics is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'. Choose a supported Graphics API by going to Project Settings -> Other Settings and disable Auto Graphics API for the platform you are currently targeting and disable any non-supported APIs.");
+            }
+            if(data == null)
+            {
+                throw new ArgumentNullException(nameof(data));
+            }
+            if(layer < 0 || x < 0 || y < 0 || width <= 0 || height <= 0 || dataRowPitch <= 0)
+            {
+                throw new ArgumentOutOfRangeException("Inputted upload layer, rectangle or row pitch is invalid. Inputted layer: " + layer.ToString() + ", rectangle: " + x.ToString() + ", " + y.ToString() + ", " + width.ToString() + ", " + height.ToString());
+            }
+#endif
+            DGCommand command;
+            if(CreateUploadCommand(targetTexturePointer, layer, x, y, width, height, data, data.Length, dataRowPitch, out command) == 0)
+                return false;
+
+            return QueueCommand(command);
+        }
+
+        static public bool UploadTexture(DirectTexture2D texture, byte[] data, int dataRowPitch)
+        {
+            return UploadTexture(texture.nativePointer, 0, 0, texture.texture.width, texture.texture.height, data, dataRowPitch);
+        }
+
+        /// <summary>
+        /// Whether GenerateTexture is available on the current Graphics API. Metal draws the patterns with a fragment shader, Vulkan with a compute shader.
+        /// </summary>
+        static public bool supportsGenerateTexture { get { return GetSupportsGenerateTexture() != 0; } }
+
+        static public bool GenerateTexture(Texture2D texture, DGGenerateParams parameters)
+        {
+            return GenerateTexture(texture.GetNativeTexturePtr(), 0, parameters);
+        }
+
+        /// <summary>
+        /// Fill a rectangle of a texture with noise, fractal noise, a gradient, a checkerboard or Voronoi cells computed on the GPU, nothing is uploaded from the CPU.
+        /// See the DGGenerateParams factories for the parameters of every pattern. Compressed textures are left as they are.
+        /// Vulkan only draws into RGBA32, BGRA32, RGBAHalf and RGBAFloat textures and the sRGB variants of the first two, other formats are left as they are too.
+        /// Queued like CopyTexture, the pattern is drawn on the rendering thread. Returns false when the parameters are invalid.
+        /// </summary>
+        static public bool GenerateTexture(IntPtr targetTexturePointer, int layer, DGGenerateParams parameters)
+        {
+#if DEBUG
+            if(!IsSupported())
+            {
+                //See supported APIs under the constant variable DirectGraphics.SUPPORTED_GRAPHICS_API.
+                throw new NotSupportedException("DirectGraphics is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'. Choose a supported Graphics API by going to Project Settings -> Other Settings and disable Auto Graphics API for the platform you are currently targeting and disable any non-supported APIs.");
+            }
+            if(!supportsGenerateTexture)
+            {
+                throw new NotSupportedException("GenerateTexture is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'.");
+            }
+            if(layer < 0)
+            {
+                throw new ArgumentOutOfRangeException(nameof(layer), "Array layers can't be negative. Inputted layer: " + layer.ToString());
+            }
+#endif
+            DGCommand command;
+            if(CreateGenerateCommand(targetTexturePointer, layer, ref parameters, out command) == 0)
+                return false;
+
+            return QueueCommand(command);
         }
 
-        static public void ClearTexture(IntPtr targetTexturePointer)
+        /// <summary>
+        /// Upload RGBA32 pixels into a rectangle of a DXT1, DXT5 or BC7 texture, encoding them into blocks on the CPU first. Rows in rgba are rgbaRowPitch bytes apart.
+        /// The plugin spreads the encoding over worker threads and writes the blocks straight into its upload memory, which is much faster than Texture2D.Compress. Blocks are encoded the same way as CompressTexture does on the GPU.
+        /// Queued like CopyTexture, rgba is copied right away and encoded on the rendering thread. Textures of other formats are skipped.
+        /// x and y must be multiples of 4 and rgba must hold height rows of rgbaRowPitch bytes. Returns false when the arguments are invalid.
+        /// </summary>
+        static public bool UploadCompressedTexture(IntPtr targetTexturePointer, int layer, int x, int y, int width, int height, byte[] rgba, int rgbaRowPitch, CompressQuality quality = CompressQuality.Fast)
         {
 #if DEBUG
             if(!IsSupported())
@@ -237,37 +1072,293 @@ namespace Elanetic.Graphics
                 //See supported APIs under the constant variable DirectGraphics.SUPPORTED_GRAPHICS_API.
                 throw new NotSupportedException("DirectGraphics is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'. Choose a supported Graphics API by going to Project Settings -> Other Settings and disable Auto Graphics API for the platform you are currently targeting and disable any non-supported APIs.");
             }
+            if(rgba == null)
+            {
+                throw new ArgumentNullException(nameof(rgba));
+            }
+            if(layer < 0 || x < 0 || y < 0 || width <= 0 || height <= 0 || rgbaRowPitch < width * 4)
+            {
+                throw new ArgumentOutOfRangeException("Inputted upload layer, rectangle or row pitch is invalid. Inputted layer: " + layer.ToString() + ", rectangle: " + x.ToString() + ", " + y.ToString() + ", " + width.ToString() + ", " + height.ToString());
+            }
+            if(x % 4 != 0 || y % 4 != 0)
+            {
+                throw new ArgumentException("The position of a compressed upload must be aligned to the 4x4 blocks. Inputted position: " + x.ToString() + ", " + y.ToString());
+            }
+            if(rgba.Length < (long)rgbaRowPitch * height)
+            {
+                throw new ArgumentException("Inputted pixel data is too small for the rectangle.", nameof(rgba));
+            }
 #endif
-            SyncRenderingThread();
-            SetTextureColor(0.0f, 0.0f, 0.0f, 0.0f, targetTexturePointer);
+            DGCommand command;
+            if(CreateCompressedUploadCommand(targetTexturePointer, layer, x, y, width, height, rgba, rgba.Length, rgbaRowPitch, (int)quality, out command) == 0)
+                return false;
+
+            return QueueCommand(command);
         }
 
-        static private Texture2D m_SyncTexture;
-        static private int m_LastEncodeFrame = -2;
-        static private void SyncRenderingThread()
+        static public bool UploadCompressedTexture(DirectTexture2D texture, byte[] rgba, CompressQuality quality = CompressQuality.Fast)
+        {
+            return UploadCompressedTexture(texture.nativePointer, 0, 0, 0, texture.texture.width, texture.texture.height, rgba, texture.texture.width * 4, quality);
+        }
+
+        /// <summary>
+        /// Destroyed textures are kept by the native plugin and handed back out by CreateTexture when the size and format match, which makes creating the same sized textures over and over cheap.
+        /// Sets how many destroyed textures are kept at most, 64 by default. Zero disables pooling. Textures handed back out keep whatever contents they had.
+        /// </summary>
+        static public void SetTexturePoolCapacity(int capacity)
+        {
+#if DEBUG
+            if(capacity < 0)
+            {
+                throw new ArgumentOutOfRangeException(nameof(capacity), "Texture pool capacity must not be negative. Inputted capacity: " + capacity.ToString());
+            }
+#endif
+            SetNativeTexturePoolCapacity(capacity);
+        }
+
+        /// <summary>
+        /// Free the memory of pooled textures, oldest first, until at most maxPooled remain. Useful after a scene change or on low memory warnings.
+        /// </summary>
+        static public void TrimTexturePool(int maxPooled = 0)
+        {
+            TrimNativeTexturePool(maxPooled);
+        }
+
+        static private int m_OutstandingReadbacks = 0;
+
+        /// <summary>
+        /// Start copying a rectangle of the texture back to the CPU without waiting for the GPU. The copy is queued like CopyTexture so it sees every copy and clear queued before it.
+        /// Poll the returned ticket with DirectGraphics.TryGetReadback every frame, it usually completes a couple of frames later. Every ticket must be either read with TryGetReadback or given up with DirectGraphics.ReleaseReadback.
+        /// Only supported on Vulkan, other Graphics APIs fail the readback.
+        /// </summary>
+        static public int RequestReadback(DirectTexture2D texture, int x, int y, int width, int height)
+        {
+#if DEBUG
+            if(!IsSupported())
+            {
+                //See supported APIs under the constant variable DirectGraphics.SUPPORTED_GRAPHICS_API.
+                throw new NotSupportedException("DirectGraphics is not supported for Graphics API '" + SystemInfo.graphicsDeviceType + "'. Choose a supported Graphics API by going to Project Settings -> Other Settings and disable Auto Graphics API for the platform you are currently targeting and disable any non-supported APIs.");
+            }
+            if(texture == null || texture.isDestroyed)
+            {
+                throw new ArgumentException("Inputted texture is null or destroyed.", nameof(texture));
+            }
+            if(x < 0 || y < 0 || width <= 0 || height <= 0 || x + width > texture.texture.width || y + height > texture.texture.height)
+            {
+                throw new ArgumentOutOfRangeException("The readback rectangle must be within the texture. Inputted rectangle: " + x.ToString() + ", " + y.ToString() + ", " + width.ToString() + ", " + height.ToString());
+            }
+#endif
+            int ticket = RequestReadback(texture.textureHandle, x, y, width, height);
+            if(ticket == 0)
+            {
+                throw new InvalidOperationException("Readback request failed. Too many readbacks are in flight, make sure every ticket is read with TryGetReadback or released with ReleaseReadback.");
+            }
+
+            QueueCommand(DGCommand.Readback(ticket));
+            m_OutstandingReadbacks++;
+            return ticket;
+        }
+
+        static public int RequestReadback(DirectTexture2D texture)
+        {
+            return RequestReadback(texture, 0, 0, texture.texture.width, texture.texture.height);
+        }
+
+        /// <summary>
+        /// Size in bytes of the readback data once it has completed otherwise zero. Use it to allocate the array for TryGetReadback.
+        /// </summary>
+        static public int GetReadbackDataSize(int ticket)
+        {
+            int size = GetReadbackSize(ticket);
+            if(size < 0)
+            {
+                throw new InvalidOperationException("Readback ticket '" + ticket.ToString() + "' is invalid or the readback failed.");
+            }
+            return size;
+        }
+
+        /// <summary>
+        /// Returns true and fills data when the readback has completed in which case the ticket is released. Returns false while the GPU has not finished yet. Never waits on the GPU.
+        /// Rows are tightly packed, compressed formats are returned as their compressed blocks.
+        /// </summary>
+        static public bool TryGetReadback(int ticket, byte[] data)
+        {
+#if DEBUG
+            if(data == null)
+            {
+                throw new ArgumentNullException(nameof(data));
+            }
+#endif
+            int result = TryGetReadback(ticket, data, data.Length);
+            if(result == 0)
+                return false;
+            if(result == -2)
+            {
+                throw new ArgumentException("Inputted array is too small for the readback data. Required size: " + GetReadbackSize(ticket).ToString(), nameof(data));
+            }
+            if(result == -3)
+            {
+                throw new InvalidOperationException("Readback ticket '" + ticket.ToString() + "' is invalid or was already read or released.");
+            }
+
+            m_OutstandingReadbacks--;
+            if(result < 0)
+            {
+                throw new InvalidOperationException("Readback ticket '" + ticket.ToString() + "' is invalid or the readback failed.");
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// Give up on a readback that is no longer needed. Tickets that were already read or released are ignored.
+        /// </summary>
+        static public void ReleaseReadback(int ticket)
+        {
+            if(ReleaseNativeReadback(ticket) != 0)
+                m_OutstandingReadbacks--;
+        }
+
+        //Must match kDGRenderEventFlushCommands in the native plugin's DirectGraphics.h.
+        private const int RENDER_EVENT_FLUSH_COMMANDS = 1;
+
+        static private DGCommand[] m_PendingCommands = new DGCommand[256];
+        static private int m_PendingCommandCount = 0;
+        static private IntPtr m_RenderEventFunc = IntPtr.Zero;
+
+        //Commands are validated as they are queued so Flush only ever waits for room in the native queue. Rejected commands release the memory the plugin holds for them.
+        static private bool QueueCommand(DGCommand command)
+        {
+            if(ValidateQueuedCommands(ref command, 1) >= 0)
+            {
+                ReleaseCommand(ref command);
+                Debug.LogError("DirectGraphics skipped an invalid command. Make sure the texture pointers are valid and the rectangle fits within both textures.");
+                return false;
+            }
+
+            if(m_PendingCommandCount == m_PendingCommands.Length)
+                Array.Resize(ref m_PendingCommands, m_PendingCommands.Length * 2);
+
+            m_PendingCommands[m_PendingCommandCount] = command;
+            m_PendingCommandCount++;
+            return true;
+        }
+
+        static internal void QueueCommands(DGCommand[] commands, int count)
+        {
+            int start = 0;
+            while(start < count)
+            {
+                int invalid = ValidateQueuedCommands(ref commands[start], count - start);
+                int validCount = invalid >= 0 ? invalid : count - start;
+                AppendCommands(commands, start, validCount);
+                if(invalid < 0)
+                    break;
+
+                ReleaseCommand(ref commands[start + invalid]);
+                Debug.LogError("DirectGraphics skipped an invalid command. Make sure the texture pointers are valid and the rectangle fits within both textures.");
+                start += invalid + 1;
+            }
+        }
+
+        //Appends commands that were already validated.
+        static private void AppendCommands(DGCommand[] commands, int start, int count)
+        {
+            if(m_PendingCommandCount + count > m_PendingCommands.Length)
+                Array.Resize(ref m_PendingCommands, Math.Max(m_PendingCommands.Length * 2, m_PendingCommandCount + count));
+
+            Array.Copy(commands, start, m_PendingCommands, m_PendingCommandCount, count);
+            m_PendingCommandCount += count;
+        }
+
+        /// <summary>
+        /// Send all queued copies and clears to the rendering thread. They execute when the rendering thread reaches this point of the frame.
+        /// Called automatically at the end of every frame so this is only needed when the results must be visible to rendering work issued later in the same frame.
+        /// </summary>
+        static public void Flush()
+        {
+            if(m_RenderEventFunc == IntPtr.Zero)
+                m_RenderEventFunc = GetRenderEventFunc();
+
+            if(m_PendingCommandCount == 0)
+            {
+                //Readbacks only complete while the rendering thread keeps receiving flush events.
+                if(m_OutstandingReadbacks > 0)
+                    GL.IssuePluginEvent(m_RenderEventFunc, RENDER_EVENT_FLUSH_COMMANDS);
+                return;
+            }
+
+            int commandSize = Marshal.SizeOf(typeof(DGCommand));
+            GCHandle handle = GCHandle.Alloc(m_PendingCommands, GCHandleType.Pinned);
+            try
+            {
+                IntPtr commands = handle.AddrOfPinnedObject();
+                int submitted = 0;
+                while(submitted < m_PendingCommandCount)
+                {
+                    int taken = EnqueueCommandBatch(new IntPtr(commands.ToInt64() + (long)submitted * commandSize), m_PendingCommandCount - submitted);
+                    if(taken > 0)
+                    {
+                        submitted += taken;
+                        GL.IssuePluginEvent(m_RenderEventFunc, RENDER_EVENT_FLUSH_COMMANDS);
+                        continue;
+                    }
+
+                    //The native queue is full. Wait for the rendering thread to drain it and try again.
+                    m_SyncTexture.GetNativeTexturePtr();
+                }
+            }
+            finally
+            {
+                handle.Free();
+            }
+
+            m_PendingCommandCount = 0;
+        }
+
+        static private void EndOfFrame()
+        {
+            if(m_PendingCommandCount > 0)
+            {
+                Flush();
+                return;
+            }
+
+            //Destroyed textures are only released by the rendering thread while it keeps receiving flush events.
+            if(m_RenderEventFunc == IntPtr.Zero)
+                m_RenderEventFunc = GetRenderEventFunc();
+            GL.IssuePluginEvent(m_RenderEventFunc, RENDER_EVENT_FLUSH_COMMANDS);
+        }
+
+        static private void InitFlushPlayerLoop()
         {
-            if(m_LastEncodeFrame < Time.renderedFrameCount)
+            PlayerLoopSystem playerLoop = PlayerLoop.GetCurrentPlayerLoop();
+            for(int i = 0; i < playerLoop.subSystemList.Length; i++)
             {
-                //As per Unity documentation calling this method syncs the rendering thread to the main thread.
-                //While it is a slow operation, in Metal it has been found that there is some kind of race condition with encoding commands to Unity's command buffer.
-                //The error being: -[MTLIOAccelCommandBuffer validate]:208: failed assertion `commit command buffer with uncommitted encoder'
-                //Very little information on this is found online regarding this issue so it can only be assumed that it is how Unity itself works.
-                //The working hypothesis is that if the Unity's command buffer is committed while trying to create an encoder or actively encoding this assertion will hit and crash Unity. Safety checks don't fix this.
-                //A better fix would be to queue these encodes and then wait for an event for when the command buffer is available. Blocking the main thread like this is slow and bad.
-                //Update: Fixed this for Metal by making another CommandQueue and CommandBuffer as if I know how to program Metal graphics.
+                if(playerLoop.subSystemList[i].type != typeof(PostLateUpdate)) continue;
+
+                PlayerLoopSystem[] subSystems = playerLoop.subSystemList[i].subSystemList;
+                for(int j = 0; j < subSystems.Length; j++)
+                {
+                    if(subSystems[j].type == typeof(DirectGraphics)) return;
+                }
 
-                //Now as for Vulkan... The Unity editor crashes when you open the Build Settings and/or Player Settings. Stacktrace stops at RenderAPI_Vulkan::DoCopyTexture.
-                //Crashes in Vulkan build right away.
-                m_SyncTexture.GetNativeTexturePtr();
-                m_LastEncodeFrame = Time.renderedFrameCount;
+                PlayerLoopSystem[] newSubSystems = new PlayerLoopSystem[subSystems.Length + 1];
+                newSubSystems[0] = new PlayerLoopSystem() { type = typeof(DirectGraphics), updateDelegate = EndOfFrame };
+                Array.Copy(subSystems, 0, newSubSystems, 1, subSystems.Length);
+                playerLoop.subSystemList[i].subSystemList = newSubSystems;
+                PlayerLoop.SetPlayerLoop(playerLoop);
+                return;
             }
         }
+
+        static private Texture2D m_SyncTexture;
         [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.BeforeSceneLoad)]
         static private void InitSyncTexture()
         {
             if(m_SyncTexture != null) return;
 
             m_SyncTexture = new Texture2D(1, 1, TextureFormat.R8, false, false);
+            InitFlushPlayerLoop();
         }
 #if UNITY_EDITOR
         static private void OnPlayModeChanged(PlayModeStateChange state)
@@ -282,14 +1373,21 @@ namespace Elanetic.Graphics
         }
 #endif
 
-        static internal void DestroyDirectTexture(int textureIndex)
+        static internal void DestroyDirectTexture(int textureHandle)
         {
-            m_AllTextures[textureIndex] = null;
-            DestroyNativeTexture(textureIndex);
+            //Queued commands may still reference this texture. The native plugin keeps the texture alive until everything sent to the rendering thread before the destruction has finished on the GPU.
+            if(m_PendingCommandCount > 0)
+                Flush();
+
+            m_AllTextures[textureHandle & TEXTURE_INDEX_MASK] = null;
+            DestroyNativeTexture(textureHandle);
         }
 
         static private void DestroyAllTextures()
         {
+            for(int i = m_AllAtlases.Count - 1; i >= 0; i--)
+                m_AllAtlases[i].Destroy();
+
             for(int i = 0; i < m_AllTextures.Count; i++)
             {
                 if(m_AllTextures[i] != null)
@@ -298,4 +1396,413 @@ namespace Elanetic.Graphics
         }
     }
 
+    /// <summary>
+    /// A single operation for DirectGraphics.SubmitCommands. Mirrors DGCommand in the native plugin's DirectGraphics.h so the field layout must not change.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct DGCommand
+    {
+        internal const int COPY = 0;
+        internal const int CLEAR = 1;
+        internal const int CREATE = 2;
+        internal const int DESTROY = 3;
+        internal const int READBACK = 4;
+        internal const int GENERATE_MIPS = 5;
+        internal const int BLIT = 6;
+        internal const int CONVERT = 7;
+        internal const int COMPRESS = 8;
+        internal const int UPLOAD = 9;
+        internal const int UPLOAD_COMPRESSED = 10;
+        internal const int CLEAR_RECT = 11;
+        internal const int GENERATE = 12;
+
+        internal int type;
+
+        internal IntPtr source;
+        internal IntPtr destination;
+
+        internal int sourceX;
+        internal int sourceY;
+        internal int width;
+        internal int height;
+        internal int destinationX;
+        internal int destinationY;
+
+        internal float red;
+        internal float green;
+        internal float blue;
+        internal float alpha;
+
+        internal int format;
+        internal int textureIndex;
+        internal IntPtr outTextureIndex;
+        internal int ticket;
+
+        internal int destinationWidth;
+        internal int destinationHeight;
+        internal int filter;
+
+        internal int sourceLayer;
+        internal int destinationLayer;
+
+        internal int convertOptions;
+        internal int swizzle;
+        internal int quality;
+
+        internal IntPtr data;
+        internal int dataRowPitch;
+
+        //Creations and destructions run on the calling thread, every other command is queued for the rendering thread.
+        internal bool IsImmediate()
+        {
+            return type == CREATE || type == DESTROY;
+        }
+
+        static public DGCommand Copy(IntPtr sourceNativePointer, int sourceX, int sourceY, int width, int height, IntPtr destinationNativePointer, int destinationX, int destinationY)
+        {
+            DGCommand command = new DGCommand();
+            command.type = COPY;
+            command.source = sourceNativePointer;
+            command.destination = destinationNativePointer;
+            command.sourceX = sourceX;
+            command.sourceY = sourceY;
+            command.width = width;
+            command.height = height;
+            command.destinationX = destinationX;
+            command.destinationY = destinationY;
+            return command;
+        }
+
+        /// <summary>
+        /// Copy between array layers, layer 0 for textures that are no array.
+        /// </summary>
+        static public DGCommand Copy(IntPtr sourceNativePointer, int sourceLayer, int sourceX, int sourceY, int width, int height, IntPtr destinationNativePointer, int destinationLayer, int destinationX, int destinationY)
+        {
+            DGCommand command = Copy(sourceNativePointer, sourceX, sourceY, width, height, destinationNativePointer, destinationX, destinationY);
+            command.sourceLayer = sourceLayer;
+            command.destinationLayer = destinationLayer;
+            return command;
+        }
+
+        /// <summary>
+        /// Scale the source rectangle into the destination rectangle. FilterMode.Point samples the nearest pixel, Bilinear and Trilinear filter linearly.
+        /// </summary>
+        static public DGCommand Blit(IntPtr sourceNativePointer, int sourceX, int sourceY, int sourceWidth, int sourceHeight, IntPtr destinationNativePointer, int destinationX, int destinationY, int destinationWidth, int destinationHeight, FilterMode filterMode)
+        {
+            DGCommand command = new DGCommand();
+            command.type = BLIT;
+            command.source = sourceNativePointer;
+            command.destination = destinationNativePointer;
+            command.sourceX = sourceX;
+            command.sourceY = sourceY;
+            command.width = sourceWidth;
+            command.height = sourceHeight;
+            command.destinationX = destinationX;
+            command.destinationY = destinationY;
+            command.destinationWidth = destinationWidth;
+            command.destinationHeight = destinationHeight;
+            command.filter = filterMode == FilterMode.Point ? 0 : 1;
+            return command;
+        }
+
+        /// <summary>
+        /// Copy the source rectangle into a destination of another format, see DirectGraphics.ConvertTexture. The Swizzle option is only available through DirectGraphics.ConvertTexture.
+        /// </summary>
+        static public DGCommand Convert(IntPtr sourceNativePointer, int sourceX, int sourceY, int width, int height, IntPtr destinationNativePointer, int destinationX, int destinationY, ConvertOptions options)
+        {
+            DGCommand command = new DGCommand();
+            command.type = CONVERT;
+            command.source = sourceNativePointer;
+            command.destination = destinationNativePointer;
+            command.sourceX = sourceX;
+            command.sourceY = sourceY;
+            command.width = width;
+            command.height = height;
+            command.destinationX = destinationX;
+            command.destinationY = destinationY;
+            command.convertOptions = (int)(options & ~ConvertOptions.Swizzle);
+            return command;
+        }
+
+        /// <summary>
+        /// Encode the source rectangle into the blocks of a compressed destination, see DirectGraphics.CompressTexture.
+        /// </summary>
+        static public DGCommand Compress(IntPtr sourceNativePointer, int sourceX, int sourceY, int width, int height, IntPtr destinationNativePointer, int destinationX, int destinationY, CompressQuality quality)
+        {
+            DGCommand command = new DGCommand();
+            command.type = COMPRESS;
+            command.source = sourceNativePointer;
+            command.destination = destinationNativePointer;
+            command.sourceX = sourceX;
+            command.sourceY = sourceY;
+            command.width = width;
+            command.height = height;
+            command.destinationX = destinationX;
+            command.destinationY = destinationY;
+            command.quality = (int)quality;
+            return command;
+        }
+
+        static public DGCommand Clear(Color color, IntPtr targetNativePointer)
+        {
+            DGCommand command = new DGCommand();
+            command.type = CLEAR;
+            command.destination = targetNativePointer;
+            command.red = color.r;
+            command.green = color.g;
+            command.blue = color.b;
+            command.alpha = color.a;
+            return command;
+        }
+
+        static public DGCommand Clear(Color color, IntPtr targetNativePointer, int layer)
+        {
+            DGCommand command = Clear(color, targetNativePointer);
+            command.destinationLayer = layer;
+            return command;
+        }
+
+        static public DGCommand Clear(Color color, IntPtr targetNativePointer, int layer, DGRect rect)
+        {
+            DGCommand command = Clear(color, targetNativePointer, layer);
+            command.type = CLEAR_RECT;
+            command.destinationX = rect.x;
+            command.destinationY = rect.y;
+            command.width = rect.width;
+            command.height = rect.height;
+            return command;
+        }
+
+        static public DGCommand GenerateMips(IntPtr targetNativePointer)
+        {
+            DGCommand command = new DGCommand();
+            command.type = GENERATE_MIPS;
+            command.destination = targetNativePointer;
+            return command;
+        }
+
+        static internal DGCommand Readback(int ticket)
+        {
+            DGCommand command = new DGCommand();
+            command.type = READBACK;
+            command.ticket = ticket;
+            return command;
+        }
+    }
+
+    /// <summary>
+    /// A texture to create with DirectGraphics.CreateTextures. Mirrors DGTextureDesc in the native plugin's DirectGraphics.h, DirectGraphics.CreateTextures translates the format to the native one before it is passed on.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct DGTextureDesc
+    {
+        public int width;
+        public int height;
+        public TextureFormat format;
+        public int mipCount;    //0 or 1 for a single level, -1 for the full chain
+
+        public DGTextureDesc(int width, int height, TextureFormat format, int mipCount = 1)
+        {
+            this.width = width;
+            this.height = height;
+            this.format = format;
+            this.mipCount = mipCount;
+        }
+    }
+
+    /// <summary>
+    /// Per pixel operations of DirectGraphics.ConvertTexture. Mirrors DGConvertOption in the native plugin's DirectGraphics.h.
+    /// </summary>
+    [Flags]
+    public enum ConvertOptions
+    {
+        None = 0,
+        Swizzle = 1,
+        SRGBToLinear = 2,
+        PremultiplyAlpha = 4,
+        LinearToSRGB = 8,
+    }
+
+    /// <summary>
+    /// Source of a destination channel in DirectGraphics.ConvertTexture. Mirrors DGSwizzleChannel in the native plugin's DirectGraphics.h.
+    /// </summary>
+    public enum SwizzleChannel
+    {
+        Red = 0,
+        Green = 1,
+        Blue = 2,
+        Alpha = 3,
+        Zero = 4,
+        One = 5,
+    }
+
+    /// <summary>
+    /// Encoder effort of DirectGraphics.CompressTexture and DirectGraphics.UploadCompressedTexture. Mirrors DGCompressQuality in the native plugin's DirectGraphics.h.
+    /// </summary>
+    public enum CompressQuality
+    {
+        Fast = 0,   //Endpoints from the bounding box of every block
+        High = 1,   //Endpoints along the principal axis of every block, better for gradients
+    }
+
+    /// <summary>
+    /// Patterns of DirectGraphics.GenerateTexture. Mirrors DGGenerator in the native plugin's DirectGraphics.h.
+    /// </summary>
+    public enum TextureGenerator
+    {
+        ValueNoise = 0,     //Random values at the cell corners, smoothly interpolated
+        PerlinNoise = 1,    //Random gradients at the cell corners
+        SimplexNoise = 2,   //Random gradients at the corners of triangular cells, fewer axis aligned artifacts
+        LinearGradient = 3,
+        RadialGradient = 4,
+        Checkerboard = 5,
+        Voronoi = 6,        //Distance to the nearest of one random point per cell
+    }
+
+    /// <summary>
+    /// A sprite to pack with DirectAtlas.Add. Mirrors DGAtlasSprite in the native plugin's DirectGraphics.h.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct DGAtlasSprite
+    {
+        public IntPtr source;
+        public int x;
+        public int y;
+        public int width;
+        public int height;
+    }
+
+    /// <summary>
+    /// Where the native atlas put a sprite. Mirrors DGAtlasRect in the native plugin's DirectGraphics.h.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct DGAtlasRect
+    {
+        public int entry;
+        public int page;
+        public int x;
+        public int y;
+        public int width;
+        public int height;
+    }
+
+    /// <summary>
+    /// Parameters of DirectGraphics.GenerateTexture. Mirrors DGGenerateParams in the native plugin's DirectGraphics.h.
+    /// Patterns are laid out in texture pixels, so neighbouring textures continue each other when start is offset by the texture position.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct DGGenerateParams
+    {
+        public TextureGenerator generator;
+        public int x;           //Rectangle of the texture to fill
+        public int y;
+        public int width;
+        public int height;
+        public Color colorA;    //Color at noise value 0, at the gradient start and of the first checker
+        public Color colorB;
+        public Vector2 start;   //Gradients: start point in pixels, others: offset of the pattern in pixels
+        public Vector2 end;     //Gradients: end point in pixels
+        public float cellSize;  //Noises, checkerboard and Voronoi: size of a cell in pixels
+        public int octaves;     //Noises: layers of fractal Brownian motion, 1 for plain noise
+        public float lacunarity;//Noises: how much smaller the cells get from one octave to the next
+        public float gain;      //Noises: amplitude factor from one octave to the next
+        public uint seed;
+
+        /// <summary>
+        /// Value, Perlin or simplex noise with octaves layers of fractal Brownian motion, or Voronoi cells which ignore the octaves.
+        /// </summary>
+        static public DGGenerateParams Noise(TextureGenerator noise, int x, int y, int width, int height, float cellSize, Color colorA, Color colorB, uint seed = 0, int octaves = 1, float lacunarity = 2.0f, float gain = 0.5f)
+        {
+            DGGenerateParams parameters = new DGGenerateParams();
+            parameters.generator = noise;
+            parameters.x = x;
+            parameters.y = y;
+            parameters.width = width;
+            parameters.height = height;
+            parameters.colorA = colorA;
+            parameters.colorB = colorB;
+            parameters.cellSize = cellSize;
+            parameters.octaves = octaves;
+            parameters.lacunarity = lacunarity;
+            parameters.gain = gain;
+            parameters.seed = seed;
+            return parameters;
+        }
+
+        /// <summary>
+        /// A linear gradient from colorA at start to colorB at end, or a radial one from colorA at start to colorB at the distance of end from start.
+        /// </summary>
+        static public DGGenerateParams Gradient(bool radial, int x, int y, int width, int height, Vector2 start, Vector2 end, Color colorA, Color colorB)
+        {
+            DGGenerateParams parameters = new DGGenerateParams();
+            parameters.generator = radial ? TextureGenerator.RadialGradient : TextureGenerator.LinearGradient;
+            parameters.x = x;
+            parameters.y = y;
+            parameters.width = width;
+            parameters.height = height;
+            parameters.colorA = colorA;
+            parameters.colorB = colorB;
+            parameters.start = start;
+            parameters.end = end;
+            return parameters;
+        }
+
+        static public DGGenerateParams Checkerboard(int x, int y, int width, int height, float cellSize, Color colorA, Color colorB)
+        {
+            DGGenerateParams parameters = new DGGenerateParams();
+            parameters.generator = TextureGenerator.Checkerboard;
+            parameters.x = x;
+            parameters.y = y;
+            parameters.width = width;
+            parameters.height = height;
+            parameters.colorA = colorA;
+            parameters.colorB = colorB;
+            parameters.cellSize = cellSize;
+            return parameters;
+        }
+    }
+
+    /// <summary>
+    /// A rectangle for the DirectGraphics.ClearTexture overloads that take many rectangles. Mirrors DGRect in the native plugin's DirectGraphics.h.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct DGRect
+    {
+        public int x;
+        public int y;
+        public int width;
+        public int height;
+
+        public DGRect(int x, int y, int width, int height)
+        {
+            this.x = x;
+            this.y = y;
+            this.width = width;
+            this.height = height;
+        }
+    }
+
+    /// <summary>
+    /// A rectangle for the DirectGraphics.CopyTexture overload that takes many regions.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct DGCopyRegion
+    {
+        public int sourceX;
+        public int sourceY;
+        public int width;
+        public int height;
+        public int destinationX;
+        public int destinationY;
+
+        public DGCopyRegion(int sourceX, int sourceY, int width, int height, int destinationX, int destinationY)
+        {
+            this.sourceX = sourceX;
+            this.sourceY = sourceY;
+            this.width = width;
+            this.height = height;
+            this.destinationX = destinationX;
+            this.destinationY = destinationY;
+        }
+    }
 }
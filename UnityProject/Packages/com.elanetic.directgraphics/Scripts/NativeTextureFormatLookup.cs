@@ -23,17 +23,17 @@ namespace Elanetic.Graphics.Internal
             -1, // [7] RGB565             -> Unimplemented
              0, // [8] Invalid            
             -1, // [9] R16                -> Unimplemented
-            -1, //[10] DXT1               -> Unimplemented
+           130, //[10] DXT1               -> MTLPixelFormatBC1_RGBA
              0, //[11] Invalid            
            134, //[12] DXT5               -> MTLPixelFormatBC3_RGBA
             -1, //[13] RGBA4444           -> Unimplemented
-            -1, //[14] BGRA32             -> Unimplemented
+            80, //[14] BGRA32             -> MTLPixelFormatBGRA8Unorm
             -1, //[15] RHalf              -> Unimplemented
             -1, //[16] RGHalf             -> Unimplemented
-            -1, //[17] RGBAHalf           -> Unimplemented
+           115, //[17] RGBAHalf           -> MTLPixelFormatRGBA16Float
             -1, //[18] RFloat             -> Unimplemented
             -1, //[19] RGFloat            -> Unimplemented
-            -1, //[20] RGBAFloat          -> Unimplemented
+           125, //[20] RGBAFloat          -> MTLPixelFormatRGBA32Float
             -1, //[21] YUY2               -> Unimplemented
             -1, //[22] RGB9e5Float        -> Unimplemented
              0, //[23] Invalid            
@@ -75,7 +75,7 @@ namespace Elanetic.Graphics.Internal
              0, //[59] Invalid
              0, //[60] Invalid
              0, //[61] Invalid
-            -1, //[62] RG16               -> Unimplemented
+            30, //[62] RG16               -> MTLPixelFormatRG8Unorm
             10, //[63] R8                 -> MTLPixelFormatR8Unorm
             -1, //[64] ETC_RGB4Crunched   -> Unimplemented
             -1, //[65] ETC2_RGBA8Crunched -> Unimplemented
@@ -105,17 +105,17 @@ namespace Elanetic.Graphics.Internal
             -1, // [7] RGB565             -> Unimplemented
              0, // [8] Invalid            
             -1, // [9] R16                -> Unimplemented
-            -1, //[10] DXT1               -> Unimplemented
+           133, //[10] DXT1               -> VK_FORMAT_BC1_RGBA_UNORM_BLOCK
              0, //[11] Invalid
            137, //[12] DXT5               -> VK_FORMAT_BC3_UNORM_BLOCK
             -1, //[13] RGBA4444           -> Unimplemented
-            -1, //[14] BGRA32             -> Unimplemented
+            44, //[14] BGRA32             -> VK_FORMAT_B8G8R8A8_UNORM
             -1, //[15] RHalf              -> Unimplemented
             -1, //[16] RGHalf             -> Unimplemented
-            -1, //[17] RGBAHalf           -> Unimplemented
+            97, //[17] RGBAHalf           -> VK_FORMAT_R16G16B16A16_SFLOAT
             -1, //[18] RFloat             -> Unimplemented
             -1, //[19] RGFloat            -> Unimplemented
-            -1, //[20] RGBAFloat          -> Unimplemented
+           109, //[20] RGBAFloat          -> VK_FORMAT_R32G32B32A32_SFLOAT
             -1, //[21] YUY2               -> Unimplemented
             -1, //[22] RGB9e5Float        -> Unimplemented
              0, //[23] Invalid            
@@ -157,7 +157,7 @@ namespace Elanetic.Graphics.Internal
              0, //[59] Invalid
              0, //[60] Invalid
              0, //[61] Invalid
-            -1, //[62] RG16               -> Unimplemented
+            16, //[62] RG16               -> VK_FORMAT_R8G8_UNORM
              9, //[63] R8                 -> VK_FORMAT_R8_UNORM
             -1, //[64] ETC_RGB4Crunched   -> Unimplemented
             -1, //[65] ETC2_RGBA8Crunched -> Unimplemented